@@ -21,20 +21,235 @@
 #include <set>
 #include <span>
 #include <random>
+#include <numeric>
+#include <limits>
 
 namespace symxx
 {
+  // xoshiro256** (Blackman and Vigna), seeded through splitmix64
+  class Xoshiro256
+  {
+  public:
+    using result_type = uint64_t;
+  private:
+    uint64_t s[4];
+  public:
+    explicit Xoshiro256(uint64_t seed_) { seed(seed_); }
+    
+    void seed(uint64_t seed_)
+    {
+      for (auto &x: s)
+      {
+        seed_ += 0x9e3779b97f4a7c15;
+        uint64_t z = seed_;
+        z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+        z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+        x = z ^ (z >> 31);
+      }
+    }
+    
+    static constexpr result_type min() { return 0; }
+    
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+    
+    result_type operator()()
+    {
+      auto rotl = [](uint64_t x, int k) { return (x << k) | (x >> (64 - k)); };
+      uint64_t ret = rotl(s[1] * 5, 7) * 9;
+      uint64_t t = s[1] << 17;
+      s[2] ^= s[0];
+      s[3] ^= s[1];
+      s[1] ^= s[2];
+      s[0] ^= s[3];
+      s[2] ^= t;
+      s[3] = rotl(s[3], 45);
+      return ret;
+    }
+  };
+  
+  // The generator behind random_digit, and so behind the random witnesses of is_prime
+  // and the random walks of Pollard_Rho. Each thread seeds its own from std::random_device once.
+  Xoshiro256 &factorize_rng()
+  {
+    thread_local Xoshiro256 gen{(static_cast<uint64_t>(std::random_device{}()) << 32) ^ std::random_device{}()};
+    return gen;
+  }
+  
+  // Makes random_digit, is_prime and factorize on this thread repeat the same choices
+  void seed_factorize_rng(uint64_t seed)
+  {
+    factorize_rng().seed(seed);
+  }
+  
   template<typename T>
   T random_digit(T a, T b)//[a,b]
   {
-    std::random_device rd;
-    std::mt19937 gen(rd());
     std::uniform_int_distribution<T> dis{a, b};
-    return dis(gen);
+    return dis(factorize_rng());
+  }
+  
+#if defined(SYMXX_ENABLE_HUGE)
+  template<>
+  inline Huge random_digit(Huge a, Huge b)//[a,b]
+  {
+    // rejection sampling on the bit width of b - a + 1
+    Huge range = b - a + 1;
+    size_t bits = range.bit_width();
+    auto &gen = factorize_rng();
+    std::uniform_int_distribution<digit> dis{0, SYMXX_HUGE_LOW_MASK};
+    while (true)
+    {
+      huge_internal::digit_vector d((bits + SYMXX_HUGE_SHIFT - 1) / SYMXX_HUGE_SHIFT);
+      for (auto &x: d)
+      {
+        x = dis(gen);
+      }
+      d.back() &= SYMXX_HUGE_LOW_MASK >> (d.size() * SYMXX_HUGE_SHIFT - bits);
+      huge_internal::helper::digits_normalize(d);
+      Huge r(std::move(d));
+      if (r < range) return a + r;
+    }
   }
+#endif
   
   namespace factorize_internal
   {
+    template<typename T>
+    std::vector<T> huge_range(int a, int b)//[a,b)
+    {
+      std::vector<T> ret;
+      for (int i = a; i < b; ++i)
+      {
+        ret.emplace_back(i);
+      }
+      return ret;
+    }
+    
+    template<typename T>
+    std::vector<T> huge_range(int n)
+    {
+      return huge_range<T>(0, n);
+    }
+    
+    // root^n == num, with n multiplications
+    template<typename T, typename U>
+    bool is_power(const T &num, const T &root, const U &n)
+    {
+      T p = 1;
+      for (U i = 0; i < n; ++i)
+      {
+        p *= root;
+      }
+      return p == num;
+    }
+    
+    constexpr uint32_t small_prime_limit = 1 << 16;
+    
+    // p divides x iff x * inv <= lim for odd p, which needs no division
+    struct SmallPrime
+    {
+      uint32_t p;
+      // p^-1 mod 2^64
+      uint64_t inv;
+      // (2^64 - 1) / p
+      uint64_t lim;
+    };
+    
+    // The primes below small_prime_limit, sieved on first use
+    const std::vector<SmallPrime> &small_primes()
+    {
+      static const std::vector<SmallPrime> table = []
+      {
+        std::vector<bool> composite(small_prime_limit);
+        std::vector<SmallPrime> ret;
+        for (uint32_t i = 2; i < small_prime_limit; ++i)
+        {
+          if (composite[i]) continue;
+          for (uint32_t j = i * i; j < small_prime_limit; j += i)
+          {
+            composite[j] = true;
+          }
+          // Newton's iteration doubles the correct low bits, from 3 since i * i = 1 mod 8
+          uint64_t inv = i;
+          for (int k = 0; k < 5; ++k)
+          {
+            inv *= 2 - i * inv;
+          }
+          ret.push_back({i, inv, std::numeric_limits<uint64_t>::max() / i});
+        }
+        return ret;
+      }();
+      return table;
+    }
+    
+    template<typename T>
+    bool small_prime_divides(const SmallPrime &sp, const T &n)
+    {
+      if constexpr (std::is_integral_v<T> || adapter_internal::is_int128_v<T>)
+      {
+        bool fits64 = n >= 0;
+        if constexpr (sizeof(T) > sizeof(uint64_t))
+        {
+          fits64 = fits64 && n <= static_cast<T>(std::numeric_limits<uint64_t>::max());
+        }
+        if (fits64)
+        {
+          auto x = static_cast<uint64_t>(n);
+          return sp.p == 2 ? !(x & 1) : x * sp.inv <= sp.lim;
+        }
+      }
+      return n % static_cast<T>(sp.p) == 0;
+    }
+    
+    // Whether a prime not above bound divides n
+    template<typename T>
+    bool has_small_factor(const T &n, uint32_t bound)
+    {
+      for (auto &sp: small_primes())
+      {
+        if (sp.p > bound) break;
+        if (small_prime_divides(sp, n)) return true;
+      }
+      return false;
+    }
+    
+    // p * p > n, where p * p may not fit in a narrow T
+    template<typename T>
+    bool square_exceeds(uint64_t p, const T &n)
+    {
+      if constexpr (std::is_integral_v<T> && sizeof(T) < sizeof(uint64_t))
+      {
+        return static_cast<long long>(p * p) > static_cast<long long>(n);
+      }
+      else
+      {
+        return static_cast<T>(p * p) > n;
+      }
+    }
+    
+    // Moves the prime factors of n below small_prime_limit into ret, and what is left too once
+    // it must be prime. Returns the rest for Pollard-Rho, which is 1 if nothing is left.
+    template<typename T>
+    T trial_divide(T n, std::multiset<T> &ret)
+    {
+      for (auto &sp: small_primes())
+      {
+        if (square_exceeds(sp.p, n)) break;
+        while (small_prime_divides(sp, n))
+        {
+          ret.insert(static_cast<T>(sp.p));
+          n /= static_cast<T>(sp.p);
+        }
+      }
+      // no factor of n is below the first prime whose square exceeded n, or below small_prime_limit
+      if (n != 1 && square_exceeds(small_prime_limit, n))
+      {
+        ret.insert(n);
+        return 1;
+      }
+      return n;
+    }
+    
     // is_prime(), adapted from https://github.com/nishanth17/factor
     // or https://zhuanlan.zhihu.com/p/389061210
     template<typename T>
@@ -64,7 +279,12 @@ namespace symxx
       std::vector<T> w;
 
 #ifdef SYMXX_ENABLE_HUGE
-      static Huge bigint1 = adapter_to_int<Huge>("1000000000000000000000000000000000000");
+      static Huge bigint1 = []
+      {
+        // it outlives any ScratchArena that may be active on the first call
+        huge_internal::ResourceScope global{nullptr};
+        return adapter_to_int<Huge>("1000000000000000000000000000000000000");
+      }();
 #endif
 #ifdef SYMXX_ENABLE_INT128
       static __int128_t bigint2 = adapter_to_int<__int128_t>("1543267864443420616877677640751301");
@@ -76,14 +296,14 @@ namespace symxx
 #endif
       if (false) {}
 #ifdef SYMXX_ENABLE_HUGE
-        else if (n >= bigint1)
-        {
-          auto logn = adapter_log<T>(n);
-          if (!use_probabilistic)
-            w = huge_range(2, 2 * int(logn * adapter_log<T>(logn) / adapter_log<T>(2)));
-          else
-            w = huge_range(tolerance);
-        }
+      else if (std::is_same_v<T, Huge> && bigint1 <= n)
+      {
+        auto logn = adapter_log<T>(n);
+        if (!use_probabilistic)
+          w = huge_range<T>(2, 2 * int(logn * adapter_log<T>(logn) / adapter_log<T>(2)));
+        else
+          w = huge_range<T>(tolerance);
+      }
 #endif
 #ifdef SYMXX_ENABLE_INT128
       else if (n >= bigint2)
@@ -142,10 +362,7 @@ namespace symxx
       else if (n >= 489997)
         // Some Fermat stuff
       {
-        if (!(!(n & 1) || !(n % 3) || !(n % 5) || !(n % 7) || !(n % 11) || !(n % 13) || !(
-            n % 17) || !(n % 19) || !(n % 23) || !(n % 29) || !(n % 31) || !(n % 37) || !(
-            n % 41) || !(n % 43) || !(n % 47) || !(n % 53) || !(n % 59) || !(n % 61) || !(
-            n % 67) || !(n % 71) || !(n % 73) || !(n % 79) || !(n % 83)) && n % 89 && n % 97 && n % 101)
+        if (!has_small_factor(n, 101))
         {
           T hn = n >> 1;
           T nm1 = n - 1;
@@ -164,49 +381,36 @@ namespace symxx
       }
       else if (n >= 42799)
       {
-        return n & 1 && n % 3 && n % 5 && n % 7 && n % 11 && n % 13 && n % 17
-               && n % 19 && n % 23 && n % 29 && n % 31 && n % 37 && n % 41 && n % 43
+        return !has_small_factor(n, 43)
                && adapter_modpow<T>(static_cast<T>(2), n - 1, n) == 1 &&
                adapter_modpow<T>(static_cast<T>(5), n - 1, n) == 1;
       }
       else if (n >= 841)
       {
-        return !(((((!(n & 1) || !(n % 3) || !(n % 5) || !(n % 7) || !(n % 11) || !(
-            n % 13) || !(
-            n % 17)) || !(n % 19)) || !(n % 23) || !(n % 29) || !(n % 31) || !(n % 37) || !(
-            n % 41) || !(n % 43) || !(
-            n % 47)) || !(n % 53) || !(n % 59) || !(n % 61) || !(n % 67) || !(n % 71) || !(
-            n % 73) || !(n % 79)) || !(n % 83) || !(n % 89) || !(n % 97) || !(n % 101) || !(
-            n % 103) || !(adapter_modpow<T>(static_cast<T>(2), n - 1, n) == 1));
+        return !has_small_factor(n, 103) && adapter_modpow<T>(static_cast<T>(2), n - 1, n) == 1;
       }
       else if (n >= 25)
       {
-        return !(!(n & 1) || !(n % 3) || !(n % 5) || !(n % 7) || !(n % 11)) && n % 13 && n % 17 && n % 19 && n % 23;
+        return !has_small_factor(n, 23);
       }
       else if (n >= 4)
       {
-        return n & 1 && n % 3;
+        return !has_small_factor(n, 3);
       }
       else
       {
         return n > 1;
       }
       
-      if (!(n & 1 && n % 3 && n % 5 && n % 7 && n % 11 && n % 13 && n % 17 && n % 19 && n % 23 && n % 29 &&
-            n % 31 && n % 37 && n % 41 && n % 43 && n % 47 && n % 53 && n % 59 && n % 61 && n % 67 && n % 71 &&
-            n % 73 && n % 79 && n % 83 && n % 89))
+      if (has_small_factor(n, 89))
       {
         return false;
       }
       
       // Miller-Rabin
-      T s = 0;
       T d = n - 1;
-      while (!(d & 1))
-      {
-        d >>= 1;
-        s += 1;
-      }
+      size_t s = adapter_trailing_zeros(d);
+      d >>= s;
       for (auto &k: w)
         // Pick a random witness if probabilistic
       {
@@ -228,23 +432,19 @@ namespace symxx
         else
         {
           bool next = true;
-          for (T i = 0; i < s; ++i)
+          for (size_t i = 0; i < s; ++i)
           {
             if (x + 1 == n)
             {
               next = false;
               break;
             }
-            x = adapter_mulmod<T>(x, x, n);
+            x = adapter_sqrmod<T>(x, n);
           }
           if (next)
           {
             return false;
           }
-          else
-          {
-            break;
-          }
         }
       }
       return true;
@@ -253,9 +453,6 @@ namespace symxx
     template<typename T>
     bool is_prime(T n, bool use_probabilistic = false, int tolerance = 30)
     {
-#ifdef SYMXX_ENABLE_HUGE
-      static T bigint1 = adapter_to_int<T>("1000000000000000000000000000000000000");
-#endif
       if (n < 100000)
       {
         return is_prime_slow_path<T>(n);
@@ -269,21 +466,289 @@ namespace symxx
         else
         {
 #ifdef SYMXX_ENABLE_HUGE
-          if (n < bigint1)
-            return is_prime_fast_path<T>(n);
-          else
-            return is_prime_fast_path<T>(n, true, 40);
-#else
-          return is_prime_fast_path<T>(n);
+          if constexpr (std::is_same_v<T, Huge>)
+          {
+            static Huge bigint1 = []
+            {
+              huge_internal::ResourceScope global{nullptr};
+              return adapter_to_int<Huge>("1000000000000000000000000000000000000");
+            }();
+            if (n >= bigint1)
+              return is_prime_fast_path<T>(n, true, 40);
+          }
 #endif
+          return is_prime_fast_path<T>(n);
         }
       }
       symxx_unreachable();
       return false;
     }
     
-    // A C++ implementation of Pollard-Rho,
-    // which is adapted from https://zhuanlan.zhihu.com/p/267884783
+    // Arithmetic modulo an odd n in Montgomery form, x is held as x * R mod n with R = 2^(bits of T),
+    // so that a product needs two multiplications and no division.
+    // T is uint64_t or unsigned __int128; the values are kept in [0, n).
+    template<typename T>
+    class Montgomery
+    {
+      static_assert(std::is_same_v<T, uint64_t> || std::is_same_v<T, unsigned __int128>);
+    private:
+      static constexpr int bits = sizeof(T) * 8;
+      T n;
+      // n * n_inv == 1 mod R
+      T n_inv;
+      // R^2 mod n
+      T r2;
+      
+      // The high half of the double width product a * b
+      static T mul_high(T a, T b)
+      {
+        if constexpr (bits == 64)
+        {
+          return static_cast<T>((static_cast<unsigned __int128>(a) * b) >> 64);
+        }
+        else
+        {
+          using u128 = unsigned __int128;
+          auto a1 = static_cast<uint64_t>(a >> 64), a0 = static_cast<uint64_t>(a);
+          auto b1 = static_cast<uint64_t>(b >> 64), b0 = static_cast<uint64_t>(b);
+          u128 ll = static_cast<u128>(a0) * b0;
+          u128 lh = static_cast<u128>(a0) * b1;
+          u128 hl = static_cast<u128>(a1) * b0;
+          u128 mid = (ll >> 64) + static_cast<uint64_t>(lh) + static_cast<uint64_t>(hl);
+          return static_cast<u128>(a1) * b1 + (lh >> 64) + (hl >> 64) + (mid >> 64);
+        }
+      }
+      
+      // (hi:lo) * R^-1 mod n
+      // Requirements: hi < n
+      T reduce(T hi, T lo) const
+      {
+        // m * n agrees with lo in the low half, so only the high halves need subtracting
+        T m = lo * n_inv;
+        T mn = mul_high(m, n);
+        return hi >= mn ? hi - mn : hi - mn + n;
+      }
+    
+    public:
+      // Requirements: n is odd
+      explicit Montgomery(T n_) : n(n_), n_inv(n_)
+      {
+        // Newton's iteration, each step doubles the correct low bits, from 3 for odd n
+        for (int correct = 3; correct < bits; correct *= 2)
+        {
+          n_inv *= 2 - n * n_inv;
+        }
+        T r1 = (T{0} - n) % n;
+        if constexpr (bits == 64)
+        {
+          r2 = adapter_internal::mulmod64(r1, r1, n);
+        }
+        else
+        {
+          r2 = adapter_internal::mulmod128(r1, r1, n);
+        }
+      }
+      
+      [[nodiscard]] T modulus() const { return n; }
+      
+      [[nodiscard]] T to(T x) const { return mul(x % n, r2); }
+      
+      [[nodiscard]] T from(T x) const { return reduce(0, x); }
+      
+      [[nodiscard]] T mul(T a, T b) const
+      {
+        if constexpr (bits == 64)
+        {
+          auto p = static_cast<unsigned __int128>(a) * b;
+          return reduce(static_cast<T>(p >> 64), static_cast<T>(p));
+        }
+        else
+        {
+          return reduce(mul_high(a, b), a * b);
+        }
+      }
+      
+      [[nodiscard]] T add(T a, T b) const
+      {
+        T s = a + b;
+        return s < a || s >= n ? s - n : s;
+      }
+      
+      [[nodiscard]] T sub(T a, T b) const
+      {
+        return a >= b ? a - b : a - b + n;
+      }
+    };
+    
+    enum class RhoCycle
+    {
+      brent, floyd
+    };
+    
+    // The work done by Pollard_Rho
+    struct RhoStats
+    {
+      // factors found
+      size_t factors = 0;
+      // evaluations of x * x + c
+      size_t iterations = 0;
+      size_t gcds = 0;
+      // batches whose gcd reached n and were walked again one step at a time
+      size_t backtracks = 0;
+      // walks that ended without a factor and were restarted with another c
+      size_t restarts = 0;
+    };
+    
+    // How Pollard_Rho runs on this thread. The counts of every call are added to *stats unless it is nullptr.
+    struct RhoConfig
+    {
+      RhoCycle cycle = RhoCycle::brent;
+      RhoStats *stats = nullptr;
+    };
+    
+    RhoConfig &rho_config()
+    {
+      thread_local RhoConfig config;
+      return config;
+    }
+    
+    // x -> x * x + c with the whole walk in Montgomery form.
+    // R is coprime to n, so p * R shares the same factors with n as p does
+    // and the gcd works on the Montgomery form directly.
+    template<typename U>
+    class MontgomeryRho
+    {
+    private:
+      Montgomery<U> mont;
+      U c;
+    public:
+      using value_type = U;
+      
+      MontgomeryRho(U n, U c_) : mont(n), c(mont.to(c_)) {}
+      
+      [[nodiscard]] U modulus() const { return mont.modulus(); }
+      
+      [[nodiscard]] U one() const { return mont.to(1); }
+      
+      [[nodiscard]] U f(U x) const { return mont.add(mont.mul(x, x), c); }
+      
+      [[nodiscard]] U diff(U a, U b) const { return mont.sub(a, b); }
+      
+      [[nodiscard]] U mul(U a, U b) const { return mont.mul(a, b); }
+      
+      [[nodiscard]] U gcd(U a) const { return std::gcd(a, mont.modulus()); }
+    };
+    
+    // x -> x * x + c through the adapters, for Huge
+    template<typename T>
+    class AdapterRho
+    {
+    private:
+      T n;
+      T c;
+    public:
+      using value_type = T;
+      
+      AdapterRho(T n_, T c_) : n(std::move(n_)), c(std::move(c_)) {}
+      
+      [[nodiscard]] const T &modulus() const { return n; }
+      
+      [[nodiscard]] T one() const { return 1; }
+      
+      [[nodiscard]] T f(const T &x) const { return (adapter_sqrmod<T>(x, n) + c) % n; }
+      
+      [[nodiscard]] T diff(const T &a, const T &b) const { return adapter_abs(a - b); }
+      
+      [[nodiscard]] T mul(const T &a, const T &b) const { return adapter_mulmod<T>(a, b, n); }
+      
+      [[nodiscard]] T gcd(const T &a) const { return adapter_gcd(a, n); }
+    };
+    
+    // The gcds are taken once per this many steps
+    constexpr size_t rho_batch = 128;
+    
+    // Brent's variant: the tortoise x waits at the start of each power-of-two segment while the hare y
+    // walks it, so a step evaluates f once. The differences are multiplied together and their gcd with n
+    // is taken once per batch; when a batch's gcd reaches n, it is walked again with a gcd per step.
+    // Returns a factor of n, or n if the walk closed a cycle without finding one.
+    template<typename Rho>
+    typename Rho::value_type rho_brent(const Rho &rho, RhoStats &stats)
+    {
+      using T = typename Rho::value_type;
+      T y = 0, x, ys, q = rho.one(), g = 1;
+      for (size_t r = 1; g == 1; r *= 2)
+      {
+        x = y;
+        for (size_t i = 0; i < r; ++i)
+        {
+          y = rho.f(y);
+        }
+        stats.iterations += r;
+        for (size_t k = 0; k < r && g == 1; k += rho_batch)
+        {
+          ys = y;
+          size_t steps = std::min(rho_batch, r - k);
+          for (size_t i = 0; i < steps; ++i)
+          {
+            y = rho.f(y);
+            q = rho.mul(q, rho.diff(x, y));
+          }
+          stats.iterations += steps;
+          g = rho.gcd(q);
+          ++stats.gcds;
+        }
+      }
+      if (g == rho.modulus())
+      {
+        ++stats.backtracks;
+        do
+        {
+          ys = rho.f(ys);
+          ++stats.iterations;
+          g = rho.gcd(rho.diff(x, ys));
+          ++stats.gcds;
+        } while (g == 1);
+      }
+      return g;
+    }
+    
+    // Floyd's variant, adapted from https://zhuanlan.zhihu.com/p/267884783
+    // t takes one step and r two; the gcd is taken every rho_batch steps.
+    template<typename Rho>
+    typename Rho::value_type rho_floyd(const Rho &rho, RhoStats &stats)
+    {
+      using T = typename Rho::value_type;
+      T t = 0, r = 0, p = rho.one(), q;
+      do
+      {
+        for (size_t i = 0; i < rho_batch; ++i)
+        {
+          t = rho.f(t), r = rho.f(rho.f(r));
+          stats.iterations += 3;
+          if (t == r || (q = rho.mul(p, rho.diff(t, r))) == 0)
+          {
+            break;
+          }
+          p = q;
+        }
+        T d = rho.gcd(p);
+        ++stats.gcds;
+        if (d > 1)
+        {
+          return d;
+        }
+      } while (t != r);
+      return rho.modulus();
+    }
+    
+    template<typename Rho>
+    typename Rho::value_type rho_walk(const Rho &rho, RhoStats &stats)
+    {
+      return rho_config().cycle == RhoCycle::brent ? rho_brent(rho, stats) : rho_floyd(rho, stats);
+    }
+    
+    // Pollard-Rho with x -> x * x + c. Native integers walk in Montgomery form,
+    // in 64-bit words when num fits in them.
     template<typename T>
     T Pollard_Rho(const T &num)
     {
@@ -295,60 +760,105 @@ namespace symxx
       {
         return num;
       }
+      if (!(num & 1))
+      {
+        return 2;
+      }
+      RhoStats stats;
       while (true)
       {
         T c = random_digit<T>(1, num - 2);
-        auto f = [&c, &num](const T &x)
-        {
-          return (adapter_mulmod<T>(x, x, num) + c % num) % num;
-          // (x * x + c) % num
-        };
-        T t = 0, r = 0, p = 1, q;
-        do
+        T d;
+        if constexpr (std::is_integral_v<T> || adapter_internal::is_int128_v<T>)
         {
-          for (int i = 0; i < 128; ++i)
+          bool fits64 = true;
+          if constexpr (sizeof(T) > sizeof(uint64_t))
           {
-            t = f(t), r = f(f(r));
-            if (t == r || (q = adapter_mulmod<T>(p, symxx::adapter_abs(t - r), num)) == 0)
-            {
-              break;
-            }
-            p = q;
+            fits64 = num <= static_cast<T>(std::numeric_limits<uint64_t>::max());
+          }
+          if (fits64)
+          {
+            MontgomeryRho<uint64_t> rho(static_cast<uint64_t>(num), static_cast<uint64_t>(c));
+            d = static_cast<T>(rho_walk(rho, stats));
+          }
+          else
+          {
+            using u128 = unsigned __int128;
+            MontgomeryRho<u128> rho(static_cast<u128>(num), static_cast<u128>(c));
+            d = static_cast<T>(rho_walk(rho, stats));
           }
-          T d = symxx::adapter_gcd<T>(p, num);
-          if (d > 1)
+        }
+        else
+        {
+          d = rho_walk(AdapterRho<T>(num, c), stats);
+        }
+        if (d != num)
+        {
+          if (auto *total = rho_config().stats)
           {
-            return d;
+            ++stats.factors;
+            total->factors += stats.factors;
+            total->iterations += stats.iterations;
+            total->gcds += stats.gcds;
+            total->backtracks += stats.backtracks;
+            total->restarts += stats.restarts;
           }
-        } while (t != r);
+          return d;
+        }
+        ++stats.restarts;
       }
       symxx_unreachable();
       return 0;
     }
+    
+    // factorize() once the factors below small_prime_limit are gone, which also leaves none
+    // in the roots and in the factors that Pollard-Rho splits off
+    template<typename T>
+    void factorize_rho(T n, std::multiset<T> &ret)
+    {
+      if (n == 1) return;
+      if (is_prime(n))
+      {
+        ret.insert(n);
+        return;
+      }
+      // Pollard-Rho is as slow on p^k as on a product of primes of p's size, so powers are split off first.
+      // r^(a * b) is (r^a)^b, so only prime k need trying, and no root below small_prime_limit is left.
+      for (auto &sp: small_primes())
+      {
+        auto k = static_cast<T>(sp.p);
+        T root = adapter_iroot(n, k);
+        if (root < static_cast<T>(small_prime_limit)) break;
+        if (is_power(n, root, k))
+        {
+          std::multiset<T> factors;
+          factorize_rho(root, factors);
+          for (auto &f: factors)
+          {
+            for (T i = 0; i < k; ++i)
+            {
+              ret.insert(f);
+            }
+          }
+          return;
+        }
+      }
+      T fac = Pollard_Rho<T>(n);
+      n /= fac;
+      factorize_rho(fac, ret);
+      factorize_rho(n, ret);
+    }
   }
   
   template<typename T>
   void factorize(T n, std::multiset<T> &ret)
   {
-    if (n == 1) return;
-    T fac = factorize_internal::Pollard_Rho<T>(n);
-    n /= fac;
-    
-    if (!factorize_internal::is_prime(fac))
-    {
-      factorize(fac, ret);
-    }
-    else
-    {
-      ret.insert(fac);
-    }
-    if (!factorize_internal::is_prime(n))
-    {
-      factorize(n, ret);
-    }
-    else
+    if (n < 2) return;
+    // Pollard-Rho spends about sqrt(p) steps on a factor p, so the small ones are divided out first
+    n = factorize_internal::trial_divide(n, ret);
+    if (n != 1)
     {
-      ret.insert(n);
+      factorize_internal::factorize_rho(n, ret);
     }
   }
 }
@@ -22,11 +22,13 @@
 #include "error.hpp"
 #include <vector>
 #include <array>
+#include <deque>
 #include <string>
 #include <iostream>
 #include <cmath>
 #include <algorithm>
 #include <cstdint>
+#include <limits>
 #include <numeric>
 #include <type_traits>
 #include <tuple>
@@ -34,456 +36,2859 @@
 #include <functional>
 #include <memory>
 #include <optional>
+#include <memory_resource>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <exception>
+#include <bit>
+#include <iterator>
+#include <utility>
 #include <bits/stl_algobase.h>
 
+// Like CPython's PYLONG_BITS_IN_DIGIT, a digit holds 30 bits in a 32-bit word by default.
+// 60 bits in a 64-bit word, with unsigned __int128 products, halves the number of digits.
+#if !defined(SYMXX_HUGE_DIGIT_BITS)
+#define SYMXX_HUGE_DIGIT_BITS 30
+#endif
+#if SYMXX_HUGE_DIGIT_BITS != 30 && SYMXX_HUGE_DIGIT_BITS != 60
+#error "SYMXX_HUGE_DIGIT_BITS must be 30 or 60."
+#endif
+
+// The linear add/sub/cmp kernels have AVX2 versions, picked at runtime when the CPU supports them.
+// Define SYMXX_HUGE_NO_AVX2 to build only the portable loops.
+#if !defined(SYMXX_HUGE_NO_AVX2) && defined(__x86_64__) && defined(__GNUC__)
+#define SYMXX_HUGE_AVX2
+#include <immintrin.h>
+#endif
+
 namespace symxx
 {
+#if SYMXX_HUGE_DIGIT_BITS == 30
   using digit = uint32_t;
   using sdigit = int32_t;
   using twodigits = uint64_t;
   using stwodigits = int64_t;
-  constexpr digit SYMXX_HUGE_SHIFT = 30;
-  constexpr digit SYMXX_HUGE_BASE = static_cast<digit>(1 << SYMXX_HUGE_SHIFT);
-  constexpr digit SYMXX_HUGE_LOW_MASK = static_cast<digit>(SYMXX_HUGE_BASE - 1);
   constexpr digit SYMXX_HUGE_DECIMAL_SHIFT = 9;
   constexpr digit SYMXX_HUGE_DECIMAL_BASE = static_cast<digit>(1000000000);
+#else
+  using digit = uint64_t;
+  using sdigit = int64_t;
+  using twodigits = unsigned __int128;
+  using stwodigits = __int128;
+  constexpr digit SYMXX_HUGE_DECIMAL_SHIFT = 18;
+  constexpr digit SYMXX_HUGE_DECIMAL_BASE = static_cast<digit>(1000000000000000000);
+#endif
+  constexpr digit SYMXX_HUGE_SHIFT = SYMXX_HUGE_DIGIT_BITS;
+  constexpr digit SYMXX_HUGE_BASE = static_cast<digit>(1) << SYMXX_HUGE_SHIFT;
+  constexpr digit SYMXX_HUGE_LOW_MASK = static_cast<digit>(SYMXX_HUGE_BASE - 1);
   constexpr double SYMXX_HUGE_LOG2_10 = 3.32192809488736234;
+  // digits_mul thresholds, measured on the size of the smaller operand
+  constexpr size_t SYMXX_HUGE_KARATSUBA_CUTOFF = SYMXX_HUGE_DIGIT_BITS == 30 ? 70 : 40;
+  constexpr size_t SYMXX_HUGE_SQUARE_CUTOFF = 2 * SYMXX_HUGE_KARATSUBA_CUTOFF;
+  constexpr size_t SYMXX_HUGE_TOOM3_CUTOFF = 300;
+  constexpr size_t SYMXX_HUGE_TOOM4_CUTOFF = 1000;
+  constexpr size_t SYMXX_HUGE_NTT_CUTOFF = SYMXX_HUGE_DIGIT_BITS == 30 ? 3000 : 4000;
+  // digits_divrem threshold, on both the divisor and the quotient size
+  constexpr size_t SYMXX_HUGE_BZ_CUTOFF = 80;
+  // Below this many digits the AVX2 kernels do not pay for their dispatch
+  constexpr size_t SYMXX_HUGE_AVX2_CUTOFF = 16;
+  // digits_to_decimal and digits_from_decimal threshold
+  constexpr size_t SYMXX_HUGE_RADIX_CUTOFF = 100;
+  // digits kept inside a Huge before spilling to the heap
+  constexpr size_t SYMXX_HUGE_INLINE_DIGITS = 2;
+  // Copies of at least this many digits share them instead of copying
+  constexpr size_t SYMXX_HUGE_SHARE_CUTOFF = 256;
+  // Products whose smaller operand has this many digits run their sub-products in parallel
+  constexpr size_t SYMXX_HUGE_PARALLEL_CUTOFF = 1000;
   namespace huge_internal
   {
-    namespace helper
+    // The memory resource that vectors created on this thread take their storage from,
+    // nullptr for new and delete. Set by ScratchArena.
+    std::pmr::memory_resource *&limb_resource()
     {
-      // Shift the digits a[0,m] d bits left/right to z[0,m]
-      // Returns the d bits shifted out of the top.
-      digit digits_left_shift(const std::span<digit> z, const std::span<const digit> a, size_t m, int d)
+      thread_local std::pmr::memory_resource *res = nullptr;
+      return res;
+    }
+    
+    // Sets limb_resource() until the end of the scope.
+    // Caches that outlive the calls filling them use ResourceScope{nullptr}, so that they never
+    // keep storage from a ScratchArena.
+    class ResourceScope
+    {
+    private:
+      std::pmr::memory_resource *prev;
+    public:
+      explicit ResourceScope(std::pmr::memory_resource *r) : prev(std::exchange(limb_resource(), r)) {}
+      
+      ~ResourceScope() { limb_resource() = prev; }
+      
+      ResourceScope(const ResourceScope &) = delete;
+      
+      ResourceScope &operator=(const ResourceScope &) = delete;
+    };
+    
+    // A vector that keeps up to N elements inline and only allocates when it grows past them.
+    // The heap storage comes from a std::pmr::memory_resource, with the semantics of the std::pmr
+    // containers: a copy uses limb_resource(), a move keeps the resource of its source, and a move
+    // assignment between different resources copies the elements.
+    // The heap storage is reference counted, so that share() can hand it out without copying.
+    // A shared vector must be unshare()d before it is written to, which SharedDigits takes care of.
+    template<typename T, size_t N>
+    class SmallVector
+    {
+      static_assert(std::is_trivially_copyable_v<T>);
+    private:
+      // in front of the heap storage
+      struct Header
       {
-        digit carry = 0;
-        for (size_t i = 0; i < m; ++i)
+        std::atomic<size_t> refs;
+      };
+      static_assert(alignof(T) <= alignof(Header) && sizeof(Header) % alignof(T) == 0);
+      
+      T *ptr;
+      size_t sz;
+      size_t cap;
+      std::pmr::memory_resource *res;
+      T buf[N];
+
+    public:
+      using value_type = T;
+      using size_type = size_t;
+      using iterator = T *;
+      using const_iterator = const T *;
+      using reverse_iterator = std::reverse_iterator<iterator>;
+      using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+      SmallVector() : SmallVector(limb_resource()) {}
+      
+      explicit SmallVector(std::pmr::memory_resource *r) : ptr(buf), sz(0), cap(N), res(r) {}
+
+      explicit SmallVector(size_t n, const T &v = T{}) : SmallVector()
+      {
+        assign(n, v);
+      }
+
+      SmallVector(std::initializer_list<T> l) : SmallVector(l.begin(), l.end()) {}
+
+      template<typename It, typename = std::enable_if_t<!std::is_integral_v<It>>>
+      SmallVector(It first, It last) : SmallVector()
+      {
+        insert(end(), first, last);
+      }
+
+      SmallVector(const SmallVector &v) : SmallVector(v.begin(), v.end()) {}
+
+      SmallVector(SmallVector &&v) noexcept: SmallVector(v.res)
+      {
+        steal(v);
+      }
+
+      ~SmallVector()
+      {
+        release();
+      }
+
+      SmallVector &operator=(const SmallVector &v)
+      {
+        if (this != &v)
         {
-          twodigits acc = static_cast<twodigits>(a[i]) << d | carry;
-          z[i] = static_cast<digit>(acc) & SYMXX_HUGE_LOW_MASK;
-          carry = static_cast<digit>(acc >> SYMXX_HUGE_SHIFT);
+          detach();
+          sz = 0;
+          insert(end(), v.begin(), v.end());
         }
-        return carry;
+        return *this;
       }
-  
-      digit digits_right_shift(const std::span<digit> z, const std::span<const digit> a, size_t m, int d)
+
+      SmallVector &operator=(std::initializer_list<T> l)
       {
-        digit carry = 0;
-        digit mask = (static_cast<digit>(1) << d) - 1U;
-        for (auto i = static_cast<long long>(m - 1); i >= 0; --i)
+        detach();
+        sz = 0;
+        insert(end(), l.begin(), l.end());
+        return *this;
+      }
+
+      SmallVector &operator=(SmallVector &&v)
+      {
+        if (this == &v)
         {
-          twodigits acc = static_cast<twodigits>(carry) << SYMXX_HUGE_SHIFT | a[i];
-          carry = static_cast<digit>(acc) & mask;
-          z[i] = static_cast<digit>(acc >> d);
+          return *this;
         }
-        return carry;
+        if (res != v.res)
+        {
+          // The storage of v may not live as long as *this, so copy it
+          detach();
+          sz = 0;
+          insert(end(), v.begin(), v.end());
+          return *this;
+        }
+        release();
+        ptr = buf;
+        sz = 0;
+        cap = N;
+        steal(v);
+        return *this;
       }
-  
-      std::tuple<std::vector<digit>, std::vector<digit>> k_mul_split(const std::span<const digit> n, const size_t &size)
+
+      [[nodiscard]] size_t size() const { return sz; }
+
+      [[nodiscard]] size_t capacity() const { return cap; }
+
+      [[nodiscard]] bool empty() const { return sz == 0; }
+
+      [[nodiscard]] bool is_inline() const { return ptr == buf; }
+      
+      [[nodiscard]] std::pmr::memory_resource *get_resource() const { return res; }
+      
+      // A vector with the same elements, which shares the heap storage when it comes from
+      // limb_resource(), so that it lives as long as a copy would.
+      [[nodiscard]] SmallVector share() const
       {
-        std::vector<digit> low(std::min(n.size(), size));
-        std::vector<digit> high(n.size() - low.size());
-        std::copy(n.begin(), n.begin() + static_cast<long long>(low.size()), low.begin());
-        std::copy(n.begin() + static_cast<long long>(low.size()),
-                  n.begin() + static_cast<long long>( low.size()) + static_cast<long long>(high.size()), high.begin());
-        return {std::move(high), std::move(low)};
+        if (is_inline() || res != limb_resource())
+        {
+          return *this;
+        }
+        header()->refs.fetch_add(1, std::memory_order_relaxed);
+        SmallVector ret(res);
+        ret.ptr = ptr;
+        ret.sz = sz;
+        ret.cap = cap;
+        return ret;
       }
-  
-      //Requirements: x.size() >= y.size()
-      digit digits_inplace_add(const std::span<digit> x, const std::span<const digit> y)
+      
+      // Assigns v to *this, sharing v's heap storage when both have the same resource
+      void share_from(const SmallVector &v)
       {
-        digit carry = 0;
-        for (size_t i = 0; i < x.size(); ++i)
+        if (v.is_inline() || res != v.res)
         {
-          carry += x[i];
-          if (i < y.size())
-          {
-            carry += y[i];
-          }
-          x[i] = carry & SYMXX_HUGE_LOW_MASK;
-          carry >>= SYMXX_HUGE_SHIFT;
+          detach();
+          sz = 0;
+          insert(end(), v.begin(), v.end());
+          return;
         }
-        return carry;
+        if (ptr != v.ptr)
+        {
+          v.header()->refs.fetch_add(1, std::memory_order_relaxed);
+          release();
+          ptr = v.ptr;
+          cap = v.cap;
+        }
+        sz = v.sz;
       }
-  
-      digit digits_inplace_sub(const std::span<digit> x, const std::span<const digit> y)
+      
+      [[nodiscard]] bool is_shared() const
+      {
+        return !is_inline() && header()->refs.load(std::memory_order_acquire) != 1;
+      }
+      
+      // Drops shared storage before *this is overwritten, the other owners keep it
+      void detach()
+      {
+        if (is_shared())
+        {
+          release();
+          ptr = buf;
+          cap = N;
+        }
+      }
+      
+      // Gives *this storage of its own
+      void unshare()
+      {
+        if (is_shared())
+        {
+          T *p = allocate(cap);
+          std::copy(ptr, ptr + sz, p);
+          release();
+          ptr = p;
+        }
+      }
+
+      T *data() { return ptr; }
+
+      const T *data() const { return ptr; }
+
+      iterator begin() { return ptr; }
+
+      iterator end() { return ptr + sz; }
+
+      const_iterator begin() const { return ptr; }
+
+      const_iterator end() const { return ptr + sz; }
+
+      const_iterator cbegin() const { return begin(); }
+
+      const_iterator cend() const { return end(); }
+
+      reverse_iterator rbegin() { return reverse_iterator(end()); }
+
+      reverse_iterator rend() { return reverse_iterator(begin()); }
+
+      const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+
+      const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+      const_reverse_iterator crbegin() const { return rbegin(); }
+
+      const_reverse_iterator crend() const { return rend(); }
+
+      T &operator[](size_t i) { return ptr[i]; }
+
+      const T &operator[](size_t i) const { return ptr[i]; }
+
+      T &front() { return ptr[0]; }
+
+      const T &front() const { return ptr[0]; }
+
+      T &back() { return ptr[sz - 1]; }
+
+      const T &back() const { return ptr[sz - 1]; }
+
+      void clear() { sz = 0; }
+
+      void reserve(size_t n)
+      {
+        if (n > cap)
+        {
+          grow(n);
+        }
+      }
+
+      void resize(size_t n, const T &v = T{})
+      {
+        reserve(n);
+        if (n > sz)
+        {
+          std::fill(ptr + sz, ptr + n, v);
+        }
+        sz = n;
+      }
+
+      void assign(size_t n, const T &v)
+      {
+        sz = 0;
+        resize(n, v);
+      }
+
+      void push_back(const T &v)
+      {
+        if (sz == cap)
+        {
+          grow(2 * cap);
+        }
+        ptr[sz++] = v;
+      }
+
+      T &emplace_back(const T &v)
+      {
+        push_back(v);
+        return back();
+      }
+
+      void pop_back() { --sz; }
+
+      template<typename It>
+      iterator insert(const_iterator pos, It first, It last)
+      {
+        auto offset = static_cast<size_t>(pos - ptr);
+        auto count = static_cast<size_t>(std::distance(first, last));
+        if (sz + count > cap)
+        {
+          grow(std::max(sz + count, 2 * cap));
+        }
+        std::copy_backward(ptr + offset, ptr + sz, ptr + sz + count);
+        std::copy(first, last, ptr + offset);
+        sz += count;
+        return ptr + offset;
+      }
+
+      bool operator==(const SmallVector &v) const
+      {
+        return std::equal(begin(), end(), v.begin(), v.end());
+      }
+
+    private:
+      // Requirements: n > capacity()
+      void grow(size_t n)
+      {
+        n = std::max(n, 2 * N);
+        T *p = allocate(n);
+        std::copy(ptr, ptr + sz, p);
+        release();
+        ptr = p;
+        cap = n;
+      }
+
+      Header *header() const
+      {
+        return reinterpret_cast<Header *>(reinterpret_cast<char *>(ptr) - sizeof(Header));
+      }
+      
+      T *allocate(size_t n)
+      {
+        size_t bytes = sizeof(Header) + n * sizeof(T);
+        void *p = res == nullptr ? ::operator new(bytes) : res->allocate(bytes, alignof(Header));
+        new(p) Header{1};
+        return reinterpret_cast<T *>(static_cast<char *>(p) + sizeof(Header));
+      }
+      
+      // Drops the reference to the heap storage, and frees it with the last one
+      void release()
+      {
+        if (is_inline())
+        {
+          return;
+        }
+        Header *h = header();
+        // The only owner does not need the atomic decrement
+        if (h->refs.load(std::memory_order_acquire) != 1 && h->refs.fetch_sub(1, std::memory_order_acq_rel) != 1)
+        {
+          return;
+        }
+        h->~Header();
+        size_t bytes = sizeof(Header) + cap * sizeof(T);
+        if (res == nullptr)
+        {
+          ::operator delete(h, bytes);
+        }
+        else
+        {
+          res->deallocate(h, bytes, alignof(Header));
+        }
+      }
+
+      // Requirements: *this is inline and empty, and has the same resource as v
+      void steal(SmallVector &v)
+      {
+        if (v.is_inline())
+        {
+          std::copy(v.buf, v.buf + v.sz, buf);
+        }
+        else
+        {
+          ptr = v.ptr;
+          cap = v.cap;
+          v.ptr = v.buf;
+          v.cap = N;
+        }
+        sz = v.sz;
+        v.sz = 0;
+      }
+    };
+
+    using digit_vector = SmallVector<digit, SYMXX_HUGE_INLINE_DIGITS>;
+    
+    // The digits of a Huge. Copies share their heap storage until one of them is written to,
+    // so copying a value, negating it or taking its abs() does not copy the digits.
+    // Writing goes through mut(), which copies them first if they are shared.
+    // Only digits of at least SYMXX_HUGE_SHARE_CUTOFF are ever shared, which keeps the checks off short values.
+    class SharedDigits
+    {
+    private:
+      digit_vector v;
+    public:
+      SharedDigits() = default;
+      
+      SharedDigits(digit_vector d) : v(std::move(d)) {}
+      
+      SharedDigits(std::initializer_list<digit> l) : v(l) {}
+      
+      SharedDigits(const SharedDigits &s) : v(s.size() < SYMXX_HUGE_SHARE_CUTOFF ? s.v : s.v.share()) {}
+      
+      SharedDigits(SharedDigits &&s) noexcept = default;
+      
+      SharedDigits &operator=(const SharedDigits &s)
       {
-        digit borrow = 0;
-        for (size_t i = 0; i < x.size(); ++i)
+        if (this == &s)
+        {
+          return *this;
+        }
+        if (s.size() < SYMXX_HUGE_SHARE_CUTOFF)
         {
-          borrow = x[i] - borrow;
-          if (i < y.size())
+          // copying a few digits into storage we already have beats touching the reference counts
+          if (is_shared())
           {
-            borrow -= y[i];
+            v = digit_vector(v.get_resource());
           }
-          x[i] = borrow & SYMXX_HUGE_LOW_MASK;
-          borrow >>= SYMXX_HUGE_SHIFT;
-          borrow &= 1;
+          v = s.v;
         }
-        return borrow;
+        else
+        {
+          v.share_from(s.v);
+        }
+        return *this;
       }
-  
-      void digits_rem_by1(const std::span<const digit> x, const digit &y, std::vector<digit> &rem)
+      
+      SharedDigits &operator=(SharedDigits &&s) = default;
+      
+      operator std::span<const digit>() const { return {v.data(), v.size()}; }
+      
+      [[nodiscard]] const digit_vector &get() const { return v; }
+      
+      [[nodiscard]] bool is_shared() const { return v.size() >= SYMXX_HUGE_SHARE_CUTOFF && v.is_shared(); }
+      
+      digit_vector &mut()
       {
-        rem.clear();
-        twodigits remtd = 0;
-        for (int size = static_cast<int>(x.size()); --size >= 0;)
-          remtd = ((remtd << SYMXX_HUGE_SHIFT) | x[size]) % y;
-        if(remtd != 0)
-          rem.emplace_back(remtd);
+        if (v.size() >= SYMXX_HUGE_SHARE_CUTOFF)
+        {
+          v.unshare();
+        }
+        return v;
       }
-    }
-    void digits_add(const std::span<const digit> c, const std::span<const digit> d, std::vector<digit> &ret)
-    {
-      ret.clear();
-      auto &a = c.size() > d.size() ? c : d;
-      auto &b = c.size() > d.size() ? d : c;
-      digit carry = 0;
-      for (size_t i = 0; i < a.size(); ++i)
+      
+      // Trades storage with d, a destination that is written to next, so it does not get shared storage
+      void swap(digit_vector &d)
       {
-        carry += a[i];
-        if (i < b.size())
+        std::swap(v, d);
+        if (d.size() >= SYMXX_HUGE_SHARE_CUTOFF && d.is_shared())
         {
-          carry += b[i];
+          d = digit_vector(d.get_resource());
         }
-        ret.emplace_back(carry & SYMXX_HUGE_LOW_MASK);
-        carry >>= SYMXX_HUGE_SHIFT;
       }
-      if (carry != 0)
+      
+      void clear() { v = digit_vector(v.get_resource()); }
+      
+      [[nodiscard]] size_t size() const { return v.size(); }
+      
+      [[nodiscard]] bool empty() const { return v.empty(); }
+      
+      const digit *data() const { return v.data(); }
+      
+      auto begin() const { return v.begin(); }
+      
+      auto end() const { return v.end(); }
+      
+      auto crbegin() const { return v.crbegin(); }
+      
+      auto crend() const { return v.crend(); }
+      
+      const digit &operator[](size_t i) const { return v[i]; }
+      
+      const digit &back() const { return v.back(); }
+    };
+    
+    digit_vector &digits_scratch(size_t i);
+  }
+  
+  // Makes the Huge values and kernel buffers created on this thread take their digits from a pool
+  // until the arena goes out of scope, so that a pass creating many short-lived temporaries reuses
+  // the same blocks instead of going through malloc. Blocks above largest_block bytes come from
+  // upstream each time. Arenas nest, and each one must be destroyed on the thread that made it.
+  // Values that outlive the arena must be assigned to objects created outside of it, which copies
+  // them out; moving them out by construction keeps their storage in the arena.
+  class ScratchArena
+  {
+  private:
+    std::pmr::unsynchronized_pool_resource pool;
+    ScratchArena *prev;
+    std::pmr::memory_resource *prev_resource;
+    // digits_scratch() of this arena, so that it keeps trading storage with the values in it
+    std::array<huge_internal::digit_vector, 2> scratch;
+    
+    friend huge_internal::digit_vector &huge_internal::digits_scratch(size_t i);
+    
+    static ScratchArena *&current()
+    {
+      thread_local ScratchArena *arena = nullptr;
+      return arena;
+    }
+  
+  public:
+    static constexpr size_t largest_block = 1 << 16;
+    
+    explicit ScratchArena(std::pmr::memory_resource *upstream = std::pmr::get_default_resource())
+        : pool(std::pmr::pool_options{0, largest_block}, upstream), prev(std::exchange(current(), this)),
+          prev_resource(std::exchange(huge_internal::limb_resource(), &pool)),
+          scratch{huge_internal::digit_vector(&pool), huge_internal::digit_vector(&pool)} {}
+    
+    ~ScratchArena()
+    {
+      current() = prev;
+      huge_internal::limb_resource() = prev_resource;
+    }
+    
+    ScratchArena(const ScratchArena &) = delete;
+    
+    ScratchArena &operator=(const ScratchArena &) = delete;
+    
+    std::pmr::memory_resource *resource() { return &pool; }
+  };
+  
+  namespace huge_internal
+  {
+    std::atomic<size_t> &mul_threads()
+    {
+      static std::atomic<size_t> n = 1;
+      return n;
+    }
+    
+    // The workers that run the sub-products of parallel multiplications. Worker i only takes
+    // tasks while i + 1 < mul_threads(), so lowering the cap takes effect without restarting them.
+    class TaskPool
+    {
+    private:
+      std::mutex mutex;
+      std::condition_variable cv;
+      std::deque<std::function<void()>> tasks;
+      std::vector<std::thread> workers;
+      bool stopping = false;
+      
+      TaskPool() = default;
+      
+      // Requirements: mutex is locked by lock and tasks is not empty
+      void run_front(std::unique_lock<std::mutex> &lock)
+      {
+        auto task = std::move(tasks.front());
+        tasks.pop_front();
+        lock.unlock();
+        task();
+        lock.lock();
+      }
+      
+      void work(size_t index)
+      {
+        std::unique_lock lock(mutex);
+        while (!stopping)
+        {
+          if (!tasks.empty() && index + 1 < mul_threads().load(std::memory_order_relaxed))
+          {
+            run_front(lock);
+          }
+          else
+          {
+            cv.wait(lock);
+          }
+        }
+      }
+    
+    public:
+      static TaskPool &get()
+      {
+        static TaskPool pool;
+        return pool;
+      }
+      
+      ~TaskPool()
+      {
+        {
+          std::lock_guard lock(mutex);
+          stopping = true;
+        }
+        cv.notify_all();
+        for (auto &w: workers)
+        {
+          w.join();
+        }
+      }
+      
+      // Runs fs and returns once all of them are done, rethrowing the first exception.
+      // The calling thread runs the first task and then takes queued ones while it waits,
+      // so tasks may run parallel products of their own.
+      void run(std::span<const std::function<void()>> fs)
+      {
+        size_t left = fs.size() - 1;
+        std::exception_ptr error;
+        std::unique_lock lock(mutex);
+        while (workers.size() + 1 < mul_threads().load(std::memory_order_relaxed))
+        {
+          workers.emplace_back([this, i = workers.size()] { work(i); });
+        }
+        for (size_t i = 1; i < fs.size(); ++i)
+        {
+          tasks.emplace_back([this, &f = fs[i], &left, &error]
+                             {
+                               std::exception_ptr e;
+                               try
+                               {
+                                 f();
+                               }
+                               catch (...)
+                               {
+                                 e = std::current_exception();
+                               }
+                               std::lock_guard lock(mutex);
+                               if (e && !error) error = e;
+                               --left;
+                               cv.notify_all();
+                             });
+        }
+        cv.notify_all();
+        lock.unlock();
+        try
+        {
+          fs[0]();
+        }
+        catch (...)
+        {
+          lock.lock();
+          if (!error) error = std::current_exception();
+          lock.unlock();
+        }
+        lock.lock();
+        while (left != 0)
+        {
+          if (!tasks.empty())
+          {
+            run_front(lock);
+          }
+          else
+          {
+            cv.wait(lock);
+          }
+        }
+        if (error)
+        {
+          std::rethrow_exception(error);
+        }
+      }
+    };
+    
+    // Runs fs, on the TaskPool when size >= SYMXX_HUGE_PARALLEL_CUTOFF and more than one thread is allowed.
+    // The workers have no ScratchArena, so they must not grow vectors that take their storage from one,
+    // and inside an arena the functions run one after another on this thread.
+    template<typename... F>
+    void parallel_invoke(size_t size, F &&... fs)
+    {
+      if (size < SYMXX_HUGE_PARALLEL_CUTOFF || mul_threads().load(std::memory_order_relaxed) <= 1
+          || limb_resource() != nullptr)
+      {
+        (fs(), ...);
+        return;
+      }
+      const std::array<std::function<void()>, sizeof...(F)> tasks{std::function<void()>(fs)...};
+      TaskPool::get().run(tasks);
+    }
+  }
+  
+  // Lets a multiplication of at least SYMXX_HUGE_PARALLEL_CUTOFF digits run its sub-products on up to n threads,
+  // the calling one included. 0 means std::thread::hardware_concurrency(). The default is 1. The digits of
+  // the product do not depend on it.
+  void set_huge_mul_threads(size_t n)
+  {
+    if (n == 0)
+    {
+      n = std::max(std::thread::hardware_concurrency(), 1U);
+    }
+    huge_internal::mul_threads().store(n, std::memory_order_relaxed);
+  }
+  
+  size_t huge_mul_threads()
+  {
+    return huge_internal::mul_threads().load(std::memory_order_relaxed);
+  }
+  
+  namespace huge_internal
+  {
+
+    namespace helper
+    {
+      // Shift the digits a[0,m] d bits left/right to z[0,m]
+      // Returns the d bits shifted out of the top.
+      digit digits_left_shift(const std::span<digit> z, const std::span<const digit> a, size_t m, int d)
+      {
+        digit carry = 0;
+        for (size_t i = 0; i < m; ++i)
+        {
+          twodigits acc = static_cast<twodigits>(a[i]) << d | carry;
+          z[i] = static_cast<digit>(acc) & SYMXX_HUGE_LOW_MASK;
+          carry = static_cast<digit>(acc >> SYMXX_HUGE_SHIFT);
+        }
+        return carry;
+      }
+  
+      digit digits_right_shift(const std::span<digit> z, const std::span<const digit> a, size_t m, int d)
+      {
+        digit carry = 0;
+        digit mask = (static_cast<digit>(1) << d) - 1U;
+        for (auto i = static_cast<long long>(m - 1); i >= 0; --i)
+        {
+          twodigits acc = static_cast<twodigits>(carry) << SYMXX_HUGE_SHIFT | a[i];
+          carry = static_cast<digit>(acc) & mask;
+          z[i] = static_cast<digit>(acc >> d);
+        }
+        return carry;
+      }
+  
+      std::tuple<digit_vector, digit_vector> k_mul_split(const std::span<const digit> n, const size_t &size)
+      {
+        digit_vector low(std::min(n.size(), size));
+        digit_vector high(n.size() - low.size());
+        std::copy(n.begin(), n.begin() + static_cast<long long>(low.size()), low.begin());
+        std::copy(n.begin() + static_cast<long long>(low.size()),
+                  n.begin() + static_cast<long long>( low.size()) + static_cast<long long>(high.size()), high.begin());
+        return {std::move(high), std::move(low)};
+      }
+  
+      // The linear kernels below work on raw pointers with a known length, so their loops have no
+      // bounds checks or size branches. z may be the same array as a or b.
+      
+      // z = a + b + carry, returns the carry out
+      digit digits_add_n_scalar(digit *z, const digit *a, const digit *b, size_t n, digit carry)
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          carry += a[i] + b[i];
+          z[i] = carry & SYMXX_HUGE_LOW_MASK;
+          carry >>= SYMXX_HUGE_SHIFT;
+        }
+        return carry;
+      }
+      
+      // z = a - b - borrow, returns the borrow out
+      digit digits_sub_n_scalar(digit *z, const digit *a, const digit *b, size_t n, digit borrow)
+      {
+        for (size_t i = 0; i < n; ++i)
+        {
+          borrow = a[i] - b[i] - borrow;
+          z[i] = borrow & SYMXX_HUGE_LOW_MASK;
+          borrow = (borrow >> SYMXX_HUGE_SHIFT) & 1;
+        }
+        return borrow;
+      }
+      
+      // positive for a > b, 0 for a == b, negative for a < b, scanning from the top
+      int digits_cmp_n_scalar(const digit *a, const digit *b, size_t n)
+      {
+        while (n-- > 0)
+        {
+          if (a[n] != b[n])
+          {
+            return a[n] > b[n] ? 1 : -1;
+          }
+        }
+        return 0;
+      }
+
+#if defined(SYMXX_HUGE_AVX2)
+      // With nail bits a lane's carry out is just its top bit, so whole vectors are added at once.
+      // A lane passes an incoming carry on only if it is all ones, which turns the carries of
+      // a vector into one integer addition on its lane masks:
+      //   carry_in = ((generate << 1 | carry) + propagate) ^ propagate
+      // Subtraction is the same with borrows, where a negative lane generates and a zero lane propagates.
+#if SYMXX_HUGE_DIGIT_BITS == 30
+      constexpr size_t avx2_lanes = 8;
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_lane_bits()
+      {
+        return _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+      }
+      
+      __attribute__((target("avx2"))) inline unsigned avx2_top_bits(__m256i v)
+      {
+        return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_eq(__m256i a, __m256i b)
+      {
+        return _mm256_cmpeq_epi32(a, b);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_add(__m256i a, __m256i b)
+      {
+        return _mm256_add_epi32(a, b);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_sub(__m256i a, __m256i b)
+      {
+        return _mm256_sub_epi32(a, b);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_carry_bits(__m256i s)
+      {
+        return _mm256_slli_epi32(s, 1);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_set1(digit d)
+      {
+        return _mm256_set1_epi32(static_cast<int>(d));
+      }
+#else
+      constexpr size_t avx2_lanes = 4;
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_lane_bits()
+      {
+        return _mm256_setr_epi64x(1, 2, 4, 8);
+      }
+      
+      __attribute__((target("avx2"))) inline unsigned avx2_top_bits(__m256i v)
+      {
+        return static_cast<unsigned>(_mm256_movemask_pd(_mm256_castsi256_pd(v)));
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_eq(__m256i a, __m256i b)
+      {
+        return _mm256_cmpeq_epi64(a, b);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_add(__m256i a, __m256i b)
+      {
+        return _mm256_add_epi64(a, b);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_sub(__m256i a, __m256i b)
+      {
+        return _mm256_sub_epi64(a, b);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_carry_bits(__m256i s)
+      {
+        return _mm256_slli_epi64(s, 3);
+      }
+      
+      __attribute__((target("avx2"))) inline __m256i avx2_set1(digit d)
+      {
+        return _mm256_set1_epi64x(static_cast<long long>(d));
+      }
+#endif
+      
+      // all ones in the lanes whose bit is set in m
+      __attribute__((target("avx2"))) inline __m256i avx2_expand(unsigned m)
+      {
+        __m256i bits = avx2_lane_bits();
+        return avx2_eq(_mm256_and_si256(avx2_set1(static_cast<digit>(m)), bits), bits);
+      }
+      
+      __attribute__((target("avx2")))
+      digit digits_add_n_avx2(digit *z, const digit *a, const digit *b, size_t n, digit carry)
+      {
+        const __m256i mask = avx2_set1(SYMXX_HUGE_LOW_MASK);
+        size_t i = 0;
+        for (; i + avx2_lanes <= n; i += avx2_lanes)
+        {
+          __m256i s = avx2_add(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)));
+          unsigned g = avx2_top_bits(avx2_carry_bits(s));
+          unsigned p = avx2_top_bits(avx2_eq(s, mask));
+          unsigned c = (((g << 1) | carry) + p) ^ p;
+          carry = (c >> avx2_lanes) & 1;
+          s = _mm256_and_si256(avx2_sub(s, avx2_expand(c)), mask);
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(z + i), s);
+        }
+        return digits_add_n_scalar(z + i, a + i, b + i, n - i, carry);
+      }
+      
+      __attribute__((target("avx2")))
+      digit digits_sub_n_avx2(digit *z, const digit *a, const digit *b, size_t n, digit borrow)
+      {
+        const __m256i mask = avx2_set1(SYMXX_HUGE_LOW_MASK);
+        const __m256i zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + avx2_lanes <= n; i += avx2_lanes)
+        {
+          __m256i s = avx2_sub(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + i)),
+                               _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + i)));
+          unsigned g = avx2_top_bits(s);
+          unsigned p = avx2_top_bits(avx2_eq(s, zero));
+          unsigned c = (((g << 1) | borrow) + p) ^ p;
+          borrow = (c >> avx2_lanes) & 1;
+          s = _mm256_and_si256(avx2_add(s, avx2_expand(c)), mask);
+          _mm256_storeu_si256(reinterpret_cast<__m256i *>(z + i), s);
+        }
+        return digits_sub_n_scalar(z + i, a + i, b + i, n - i, borrow);
+      }
+      
+      __attribute__((target("avx2")))
+      int digits_cmp_n_avx2(const digit *a, const digit *b, size_t n)
+      {
+        constexpr unsigned all = (1U << avx2_lanes) - 1;
+        while (n >= avx2_lanes)
+        {
+          n -= avx2_lanes;
+          unsigned eq = avx2_top_bits(avx2_eq(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(a + n)),
+                                              _mm256_loadu_si256(reinterpret_cast<const __m256i *>(b + n))));
+          if (eq != all)
+          {
+            size_t i = n + static_cast<size_t>(std::bit_width(~eq & all)) - 1;
+            return a[i] > b[i] ? 1 : -1;
+          }
+        }
+        return digits_cmp_n_scalar(a, b, n);
+      }
+      
+      bool cpu_has_avx2()
+      {
+        static const bool has = __builtin_cpu_supports("avx2");
+        return has;
+      }
+#endif
+      
+      digit digits_add_n(digit *z, const digit *a, const digit *b, size_t n, digit carry = 0)
+      {
+#if defined(SYMXX_HUGE_AVX2)
+        if (n >= SYMXX_HUGE_AVX2_CUTOFF && cpu_has_avx2())
+        {
+          return digits_add_n_avx2(z, a, b, n, carry);
+        }
+#endif
+        return digits_add_n_scalar(z, a, b, n, carry);
+      }
+      
+      digit digits_sub_n(digit *z, const digit *a, const digit *b, size_t n, digit borrow = 0)
+      {
+#if defined(SYMXX_HUGE_AVX2)
+        if (n >= SYMXX_HUGE_AVX2_CUTOFF && cpu_has_avx2())
+        {
+          return digits_sub_n_avx2(z, a, b, n, borrow);
+        }
+#endif
+        return digits_sub_n_scalar(z, a, b, n, borrow);
+      }
+      
+      int digits_cmp_n(const digit *a, const digit *b, size_t n)
+      {
+#if defined(SYMXX_HUGE_AVX2)
+        if (n >= SYMXX_HUGE_AVX2_CUTOFF && cpu_has_avx2())
+        {
+          return digits_cmp_n_avx2(a, b, n);
+        }
+#endif
+        return digits_cmp_n_scalar(a, b, n);
+      }
+      
+      // z = a + carry, stops adding once the carry is gone. Returns the carry out.
+      digit digits_add_1(digit *z, const digit *a, size_t n, digit carry)
+      {
+        size_t i = 0;
+        for (; i < n && carry != 0; ++i)
+        {
+          carry += a[i];
+          z[i] = carry & SYMXX_HUGE_LOW_MASK;
+          carry >>= SYMXX_HUGE_SHIFT;
+        }
+        if (z != a)
+        {
+          std::copy(a + i, a + n, z + i);
+        }
+        return carry;
+      }
+      
+      // z = a - borrow, stops once the borrow is gone. Returns the borrow out.
+      digit digits_sub_1(digit *z, const digit *a, size_t n, digit borrow)
+      {
+        size_t i = 0;
+        for (; i < n && borrow != 0; ++i)
+        {
+          borrow = a[i] - borrow;
+          z[i] = borrow & SYMXX_HUGE_LOW_MASK;
+          borrow = (borrow >> SYMXX_HUGE_SHIFT) & 1;
+        }
+        if (z != a)
+        {
+          std::copy(a + i, a + n, z + i);
+        }
+        return borrow;
+      }
+      
+      //Requirements: x.size() >= y.size()
+      digit digits_inplace_add(const std::span<digit> x, const std::span<const digit> y)
+      {
+        digit carry = digits_add_n(x.data(), x.data(), y.data(), y.size());
+        return digits_add_1(x.data() + y.size(), x.data() + y.size(), x.size() - y.size(), carry);
+      }
+  
+      // x[offset:] += y, the carry only propagates as far as it needs to.
+      // Requirements: the sum fits in x
+      void digits_add_at(digit_vector &x, const std::span<const digit> y, size_t offset)
+      {
+        digit *z = x.data() + offset;
+        digit carry = digits_add_n(z, z, y.data(), y.size());
+        digits_add_1(z + y.size(), z + y.size(), x.size() - offset - y.size(), carry);
+      }
+  
+      //Requirements: x.size() >= y.size()
+      digit digits_inplace_sub(const std::span<digit> x, const std::span<const digit> y)
+      {
+        digit borrow = digits_sub_n(x.data(), x.data(), y.data(), y.size());
+        return digits_sub_1(x.data() + y.size(), x.data() + y.size(), x.size() - y.size(), borrow);
+      }
+  
+      void digits_normalize(digit_vector &a)
+      {
+        while (!a.empty() && a.back() == 0)
+        {
+          a.pop_back();
+        }
+      }
+  
+      // The i-th k-digits piece of n, without its leading zeros.
+      std::span<const digit> toom_split(const std::span<const digit> n, size_t k, size_t i)
+      {
+        if (n.size() <= i * k)
+        {
+          return {};
+        }
+        auto piece = n.subspan(i * k, std::min(k, n.size() - i * k));
+        while (!piece.empty() && piece.back() == 0)
+        {
+          piece = piece.first(piece.size() - 1);
+        }
+        return piece;
+      }
+  
+      // Division by a digit that stays the same over many steps, with multiplications only.
+      // Möller and Granlund, Improved division by invariant integers, Algorithm 4
+      // https://gmplib.org/~tege/division-paper.pdf
+      // It works on 64-bit words, so one step takes 60 bits of the dividend, which are two 30-bit digits.
+      class Reciprocal
+      {
+      private:
+        int shift;
+        // the divisor, shifted until its top bit is set
+        uint64_t d;
+        // floor((2^128 - 1) / d) - 2^64, which is a 128 by 64 bit division whose quotient fits in 64 bits
+        uint64_t v;
+      public:
+        constexpr explicit Reciprocal(uint64_t divisor)
+            : shift(std::countl_zero(divisor)), d(divisor << shift),
+              v(static_cast<uint64_t>((static_cast<unsigned __int128>(~d) << 64 | ~static_cast<uint64_t>(0)) / d)) {}
+        
+        constexpr uint64_t divisor() const { return d >> shift; }
+        
+        // (rem * 2^bits + x) / divisor, and rem becomes the remainder.
+        // Requirements: rem < divisor, x < 2^bits, bits <= 60
+        constexpr uint64_t divrem(uint64_t &rem, uint64_t x, int bits = 60) const
+        {
+          unsigned __int128 u = ((static_cast<unsigned __int128>(rem) << bits) | x) << shift;
+          auto u0 = static_cast<uint64_t>(u);
+          unsigned __int128 q = static_cast<unsigned __int128>(v) * static_cast<uint64_t>(u >> 64) + u;
+          uint64_t q1 = static_cast<uint64_t>(q >> 64) + 1;
+          uint64_t r = u0 - q1 * d;
+          // r is in (q0 - 2^64, q0], so a wrapped r is larger than q0
+          if (r > static_cast<uint64_t>(q))
+          {
+            --q1;
+            r += d;
+          }
+          if (r >= d) [[unlikely]]
+          {
+            ++q1;
+            r -= d;
+          }
+          rem = r >> shift;
+          return q1;
+        }
+      };
+      
+      // x / y to q, which may be null, and returns the remainder
+      digit digits_div_by1(const std::span<const digit> x, const digit &y, digit *q)
+      {
+#if SYMXX_HUGE_DIGIT_BITS == 30
+        // Two digits per step, half of the dependent divisions
+        Reciprocal recip{y};
+        uint64_t rem = 0;
+        size_t i = x.size();
+        for (; i >= 2; i -= 2)
+        {
+          uint64_t t = recip.divrem(rem, static_cast<uint64_t>(x[i - 1]) << SYMXX_HUGE_SHIFT | x[i - 2]);
+          if (q != nullptr)
+          {
+            q[i - 1] = static_cast<digit>(t >> SYMXX_HUGE_SHIFT);
+            q[i - 2] = static_cast<digit>(t) & SYMXX_HUGE_LOW_MASK;
+          }
+        }
+        if (i == 1)
+        {
+          uint64_t t = recip.divrem(rem, x[0], SYMXX_HUGE_SHIFT);
+          if (q != nullptr)
+          {
+            q[0] = static_cast<digit>(t);
+          }
+        }
+        return static_cast<digit>(rem);
+#else
+        // One digit per step, where the hardware division is about as fast as the reciprocal
+        // and does not need its setup
+        const digit d = y;
+        digit rem = 0;
+        for (size_t i = x.size(); i-- > 0;)
+        {
+          twodigits u = static_cast<twodigits>(rem) << SYMXX_HUGE_SHIFT | x[i];
+          auto t = static_cast<digit>(u / d);
+          rem = static_cast<digit>(u) - t * d;
+          if (q != nullptr)
+          {
+            q[i] = t;
+          }
+        }
+        return rem;
+#endif
+      }
+      
+      void digits_rem_by1(const std::span<const digit> x, const digit &y, digit_vector &rem)
+      {
+        rem.clear();
+        digit remd = digits_div_by1(x, y, nullptr);
+        if (remd != 0)
+        {
+          rem.emplace_back(remd);
+        }
+      }
+    }
+    // ret may not share storage with c or d
+    void digits_add(const std::span<const digit> c, const std::span<const digit> d, digit_vector &ret)
+    {
+      auto &a = c.size() > d.size() ? c : d;
+      auto &b = c.size() > d.size() ? d : c;
+      ret.resize(a.size() + 1);
+      digit carry = helper::digits_add_n(ret.data(), a.data(), b.data(), b.size());
+      carry = helper::digits_add_1(ret.data() + b.size(), a.data() + b.size(), a.size() - b.size(), carry);
+      if (carry != 0)
+      {
+        ret.back() = carry;
+      }
+      else
+      {
+        ret.pop_back();
+      }
+    }
+    
+    // ret may not share storage with a or b
+    void digits_sub(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret)
+    {
+      //requirement a >= b
+      ret.resize(a.size());
+      digit borrow = helper::digits_sub_n(ret.data(), a.data(), b.data(), b.size());
+      helper::digits_sub_1(ret.data() + b.size(), a.data() + b.size(), a.size() - b.size(), borrow);
+      helper::digits_normalize(ret);
+    }
+    
+    void digits_simple_mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret)
+    {
+      ret.clear();
+      ret.resize(a.size() + b.size());
+      for (size_t i = 0; i < a.size(); ++i)
+      {
+        twodigits f = a[i];
+        twodigits carry = 0;
+        auto itr = ret.begin() + static_cast<long long>(i);
+        for (auto itb = b.begin(); itb < b.end(); ++itb, ++itr)
+        {
+          carry += *itr + *itb * f;
+          *itr = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+          carry >>= SYMXX_HUGE_SHIFT;
+        }
+        if (carry != 0)
+        {
+          *itr += static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+        }
+      }
+      helper::digits_normalize(ret);
+    }
+    
+    // Each cross product a[i] * a[j] appears twice in a^2, so only computes it once and doubles it.
+    void digits_simple_sqr(const std::span<const digit> a, digit_vector &ret)
+    {
+      ret.clear();
+      ret.resize(2 * a.size());
+      for (size_t i = 0; i < a.size(); ++i)
+      {
+        twodigits f = a[i];
+        auto itr = ret.begin() + static_cast<long long>(2 * i);
+        twodigits carry = *itr + f * f;
+        *itr++ = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+        carry >>= SYMXX_HUGE_SHIFT;
+        // 2 * a[i] still fits in a digit, which keeps the products below one digit by one digit
+        digit f2 = a[i] << 1;
+        for (auto ita = a.begin() + static_cast<long long>(i) + 1; ita < a.end(); ++ita, ++itr)
+        {
+          carry += *itr + static_cast<twodigits>(*ita) * f2;
+          *itr = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+          carry >>= SYMXX_HUGE_SHIFT;
+        }
+        if (carry != 0)
+        {
+          carry += *itr;
+          *itr++ = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+          carry >>= SYMXX_HUGE_SHIFT;
+        }
+        if (carry != 0)
+        {
+          *itr += static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+        }
+      }
+      helper::digits_normalize(ret);
+    }
+    
+    //positive for a>b, 0 for a==b, negative for a<b
+    int digits_cmp(const std::span<const digit> a, const std::span<const digit> b, bool apositive = true,
+                   bool bpositive = true)
+    {
+      sdigit sign =
+          (apositive ? 1 : -1) * static_cast<sdigit>(a.size()) - (bpositive ? 1 : -1) * static_cast<sdigit>(b.size());
+      if (sign == 0)
+      {
+        int diff = helper::digits_cmp_n(a.data(), b.data(), a.size());
+        sign = apositive ? diff : -diff;
+      }
+      // sdigit may be wider than int
+      return (sign > 0) - (sign < 0);
+    }
+    
+    // x += y, reusing x's storage
+    void digits_add_inplace(digit_vector &x, const std::span<const digit> y)
+    {
+      if (x.size() < y.size())
+      {
+        x.resize(y.size());
+      }
+      digit carry = helper::digits_inplace_add(x, y);
+      if (carry != 0)
+      {
+        x.emplace_back(carry);
+      }
+    }
+    
+    // x = |x - y|, reusing x's storage
+    // Returns true if x < y, that is the sign flipped.
+    bool digits_sub_inplace(digit_vector &x, const std::span<const digit> y)
+    {
+      int cmp = digits_cmp(x, y);
+      if (cmp == 0)
+      {
+        x.clear();
+        return false;
+      }
+      if (cmp > 0)
+      {
+        helper::digits_inplace_sub(x, y);
+        helper::digits_normalize(x);
+        return false;
+      }
+      // y is longer than x or has the same size, so it does not live in x's storage
+      x.resize(y.size());
+      helper::digits_sub_n(x.data(), y.data(), x.data(), x.size());
+      helper::digits_normalize(x);
+      return true;
+    }
+    
+    // Destination for results that may alias an operand. It is swapped with the
+    // destination afterwards, so the two keep trading storage instead of allocating.
+    digit_vector &digits_scratch(size_t i)
+    {
+      if (auto *arena = ScratchArena::current())
+      {
+        return arena->scratch[i];
+      }
+      thread_local std::array<digit_vector, 2> scratch{digit_vector(nullptr), digit_vector(nullptr)};
+      return scratch[i];
+    }
+    
+    void digits_mul(const std::span<const digit> c, const std::span<const digit> d, digit_vector &ret);
+    
+    void digits_sqr(const std::span<const digit> a, digit_vector &ret);
+    
+    namespace toom
+    {
+      // Toom-Cook's evaluation and interpolation need signed intermediates.
+      struct Value
+      {
+        digit_vector digits;
+        bool is_positive = true;
+        
+        Value() = default;
+        
+        explicit Value(const std::span<const digit> s) : digits(s.begin(), s.end()) {}
+      };
+      
+      Value add(const Value &a, const Value &b, bool negate_b = false)
+      {
+        Value ret;
+        bool bpositive = negate_b ? !b.is_positive : b.is_positive;
+        if (a.is_positive == bpositive)
+        {
+          digits_add(a.digits, b.digits, ret.digits);
+          ret.is_positive = a.is_positive;
+        }
+        else if (digits_cmp(a.digits, b.digits) >= 0)
+        {
+          digits_sub(a.digits, b.digits, ret.digits);
+          ret.is_positive = a.is_positive;
+        }
+        else
+        {
+          digits_sub(b.digits, a.digits, ret.digits);
+          ret.is_positive = bpositive;
+        }
+        if (ret.digits.empty())
+        {
+          ret.is_positive = true;
+        }
+        return ret;
+      }
+      
+      Value sub(const Value &a, const Value &b)
+      {
+        return add(a, b, true);
+      }
+      
+      // a * 2^d, d < SYMXX_HUGE_SHIFT
+      Value shl(const Value &a, int d)
+      {
+        Value ret;
+        ret.is_positive = a.is_positive;
+        ret.digits.resize(a.digits.size());
+        digit carry = helper::digits_left_shift(ret.digits, a.digits, a.digits.size(), d);
+        if (carry != 0)
+        {
+          ret.digits.emplace_back(carry);
+        }
+        return ret;
+      }
+      
+      // a / b, the division must be exact.
+      Value divexact(const Value &a, digit b)
+      {
+        Value ret;
+        ret.is_positive = a.is_positive;
+        ret.digits.resize(a.digits.size());
+        twodigits rem = 0;
+        for (auto i = static_cast<long long>(a.digits.size()); --i >= 0;)
+        {
+          rem = (rem << SYMXX_HUGE_SHIFT) | a.digits[i];
+          ret.digits[i] = static_cast<digit>(rem / b);
+          rem %= b;
+        }
+        helper::digits_normalize(ret.digits);
+        return ret;
+      }
+      
+      Value mul(const Value &a, const Value &b)
+      {
+        Value ret;
+        digits_mul(a.digits, b.digits, ret.digits);
+        ret.is_positive = ret.digits.empty() || a.is_positive == b.is_positive;
+        return ret;
+      }
+      
+      // ret += c * BASE^(k * i)
+      void accumulate(digit_vector &ret, const Value &c, size_t offset)
+      {
+        if (c.digits.empty())
+        {
+          return;
+        }
+        symxx_assert(c.is_positive, "Unexpected negative Toom-Cook coefficient.");
+        helper::digits_add_at(ret, c.digits, offset);
+      }
+    }
+    
+    // Toom-3, evaluates at 0, 1, -1, -2, inf and interpolates with Bodrato's sequence
+    // Requirements: a.size() <= b.size()
+    void digits_toom3_mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret,
+                          bool square = false)
+    {
+      size_t k = (b.size() + 2) / 3;
+      toom::Value a0(helper::toom_split(a, k, 0)), a1(helper::toom_split(a, k, 1)), a2(helper::toom_split(a, k, 2));
+      toom::Value b0(helper::toom_split(b, k, 0)), b1(helper::toom_split(b, k, 1)), b2(helper::toom_split(b, k, 2));
+      auto evaluate = [](const toom::Value &x0, const toom::Value &x1, const toom::Value &x2)
+      {
+        auto t = toom::add(x0, x2);
+        auto p1 = toom::add(t, x1);
+        auto pm1 = toom::sub(t, x1);
+        auto pm2 = toom::sub(toom::shl(toom::add(pm1, x2), 1), x0);
+        return std::make_tuple(std::move(p1), std::move(pm1), std::move(pm2));
+      };
+      auto[p1, pm1, pm2] = evaluate(a0, a1, a2);
+      toom::Value q1, qm1, qm2;
+      if (!square)
+      {
+        std::tie(q1, qm1, qm2) = evaluate(b0, b1, b2);
+      }
+      toom::Value r0, rinf, r1, rm1, rm2;
+      parallel_invoke(a.size(),
+                      [&] { r0 = toom::mul(a0, square ? a0 : b0); },
+                      [&] { rinf = toom::mul(a2, square ? a2 : b2); },
+                      [&] { r1 = toom::mul(p1, square ? p1 : q1); },
+                      [&] { rm1 = toom::mul(pm1, square ? pm1 : qm1); },
+                      [&] { rm2 = toom::mul(pm2, square ? pm2 : qm2); });
+      
+      auto r3 = toom::divexact(toom::sub(rm2, r1), 3);
+      r1 = toom::divexact(toom::sub(r1, rm1), 2);
+      auto r2 = toom::sub(rm1, r0);
+      r3 = toom::add(toom::divexact(toom::sub(r2, r3), 2), toom::shl(rinf, 1));
+      r2 = toom::sub(toom::add(r2, r1), rinf);
+      r1 = toom::sub(r1, r3);
+      
+      ret.assign(a.size() + b.size(), 0);
+      toom::accumulate(ret, r0, 0);
+      toom::accumulate(ret, r1, k);
+      toom::accumulate(ret, r2, 2 * k);
+      toom::accumulate(ret, r3, 3 * k);
+      toom::accumulate(ret, rinf, 4 * k);
+      helper::digits_normalize(ret);
+    }
+    
+    // Toom-4, evaluates at 0, 1, -1, 2, -2, 1/2, inf
+    // Requirements: a.size() <= b.size()
+    void digits_toom4_mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret,
+                          bool square = false)
+    {
+      size_t k = (b.size() + 3) / 4;
+      std::array<toom::Value, 4> x;
+      std::array<toom::Value, 4> y;
+      for (size_t i = 0; i < 4; ++i)
+      {
+        x[i] = toom::Value(helper::toom_split(a, k, i));
+        y[i] = toom::Value(helper::toom_split(b, k, i));
+      }
+      // p(1), p(-1), p(2), p(-2), 8 * p(1/2)
+      auto evaluate = [](const std::array<toom::Value, 4> &v)
+      {
+        auto even = toom::add(v[0], v[2]);
+        auto odd = toom::add(v[1], v[3]);
+        auto even2 = toom::add(v[0], toom::shl(v[2], 2));
+        auto odd2 = toom::add(toom::shl(v[1], 1), toom::shl(v[3], 3));
+        auto half = toom::add(toom::add(toom::shl(v[0], 3), toom::shl(v[1], 2)), toom::add(toom::shl(v[2], 1), v[3]));
+        return std::array<toom::Value, 5>{toom::add(even, odd), toom::sub(even, odd),
+                                          toom::add(even2, odd2), toom::sub(even2, odd2), std::move(half)};
+      };
+      auto p = evaluate(x);
+      std::array<toom::Value, 5> q;
+      if (!square)
+      {
+        q = evaluate(y);
+      }
+      std::array<toom::Value, 5> r;
+      auto point = [&](size_t i) { return [&, i] { r[i] = toom::mul(p[i], square ? p[i] : q[i]); }; };
+      toom::Value c0, c6;
+      parallel_invoke(a.size(), point(0), point(1), point(2), point(3), point(4),
+                      [&] { c0 = toom::mul(x[0], square ? x[0] : y[0]); },
+                      [&] { c6 = toom::mul(x[3], square ? x[3] : y[3]); });
+      auto &[v1, vm1, v2, vm2, vh] = r;
+      
+      // c2 + c4 and c2 + 4 * c4 from the even parts
+      auto s1 = toom::sub(toom::sub(toom::divexact(toom::add(v1, vm1), 2), c0), c6);
+      auto s2 = toom::divexact(toom::sub(toom::sub(toom::divexact(toom::add(v2, vm2), 2), c0), toom::shl(c6, 6)), 4);
+      auto c4 = toom::divexact(toom::sub(s2, s1), 3);
+      auto c2 = toom::sub(s1, c4);
+      // c1 + c3 + c5, c1 + 4 * c3 + 16 * c5 and 16 * c1 + 4 * c3 + c5 from the odd parts
+      auto t1 = toom::divexact(toom::sub(v1, vm1), 2);
+      auto t2 = toom::divexact(toom::sub(v2, vm2), 4);
+      auto t3 = toom::sub(toom::sub(vh, toom::shl(c0, 6)), toom::add(toom::shl(c2, 4), toom::shl(c4, 2)));
+      t3 = toom::divexact(toom::sub(t3, c6), 2);
+      auto u = toom::divexact(toom::sub(t2, t1), 3);
+      auto w = toom::divexact(toom::sub(toom::shl(t1, 4), t3), 3);
+      auto c3 = toom::divexact(toom::sub(w, u), 3);
+      auto c5 = toom::divexact(toom::sub(u, c3), 5);
+      auto c1 = toom::sub(toom::sub(t1, c3), c5);
+      
+      ret.assign(a.size() + b.size(), 0);
+      toom::accumulate(ret, c0, 0);
+      toom::accumulate(ret, c1, k);
+      toom::accumulate(ret, c2, 2 * k);
+      toom::accumulate(ret, c3, 3 * k);
+      toom::accumulate(ret, c4, 4 * k);
+      toom::accumulate(ret, c5, 5 * k);
+      toom::accumulate(ret, c6, 6 * k);
+      helper::digits_normalize(ret);
+    }
+    
+    // Multiplication by number-theoretic transforms modulo three primes below 2^30,
+    // then recombined with the Chinese remainder theorem.
+    namespace ntt
+    {
+      using residue = uint32_t;
+      using tworesidues = uint64_t;
+      // p = c * 2^k + 1, 3 is a primitive root of all of them
+      constexpr std::array<residue, 3> primes{998244353, 167772161, 469762049};
+      constexpr residue primitive_root = 3;
+      // The transforms work on 30-bit pieces, a digit is split into this many.
+      constexpr size_t piece_bits = 30;
+      constexpr size_t pieces = SYMXX_HUGE_SHIFT / piece_bits;
+      constexpr digit piece_mask = (static_cast<digit>(1) << piece_bits) - 1;
+      // 2^23 is the largest transform 998244353 supports, this is in digits
+      constexpr size_t max_length = (static_cast<size_t>(1) << 23) / pieces;
+      
+      constexpr residue pow_mod(tworesidues a, tworesidues e, residue mod)
+      {
+        tworesidues ret = 1;
+        a %= mod;
+        for (; e != 0; e >>= 1)
+        {
+          if (e & 1) ret = ret * a % mod;
+          a = a * a % mod;
+        }
+        return static_cast<residue>(ret);
+      }
+      
+      template<residue Mod>
+      void transform(std::vector<residue> &a, bool invert)
+      {
+        const size_t n = a.size();
+        for (size_t i = 1, j = 0; i < n; ++i)
+        {
+          size_t bit = n >> 1;
+          for (; j & bit; bit >>= 1)
+          {
+            j ^= bit;
+          }
+          j ^= bit;
+          if (i < j)
+          {
+            std::swap(a[i], a[j]);
+          }
+        }
+        std::vector<residue> roots(n / 2);
+        for (size_t len = 2; len <= n; len <<= 1)
+        {
+          residue w = pow_mod(primitive_root, (Mod - 1) / len, Mod);
+          if (invert)
+          {
+            w = pow_mod(w, Mod - 2, Mod);
+          }
+          size_t half = len >> 1;
+          roots[0] = 1;
+          for (size_t i = 1; i < half; ++i)
+          {
+            roots[i] = static_cast<residue>(static_cast<tworesidues>(roots[i - 1]) * w % Mod);
+          }
+          for (size_t i = 0; i < n; i += len)
+          {
+            for (size_t j = 0; j < half; ++j)
+            {
+              residue u = a[i + j];
+              residue v = static_cast<residue>(static_cast<tworesidues>(a[i + j + half]) * roots[j] % Mod);
+              a[i + j] = u + v >= Mod ? u + v - Mod : u + v;
+              a[i + j + half] = u >= v ? u - v : u + Mod - v;
+            }
+          }
+        }
+        if (invert)
+        {
+          residue n_inv = pow_mod(n, Mod - 2, Mod);
+          for (auto &x: a)
+          {
+            x = static_cast<residue>(static_cast<tworesidues>(x) * n_inv % Mod);
+          }
+        }
+      }
+      
+      template<residue Mod>
+      void split(const std::span<const digit> a, std::vector<residue> &f)
+      {
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+          for (size_t j = 0; j < pieces; ++j)
+          {
+            f[i * pieces + j] = static_cast<residue>((a[i] >> (j * piece_bits)) & piece_mask) % Mod;
+          }
+        }
+      }
+      
+      // the cyclic convolution of a and b's pieces modulo Mod
+      template<residue Mod>
+      std::vector<residue> convolution(const std::span<const digit> a, const std::span<const digit> b, size_t n,
+                                       bool square)
+      {
+        std::vector<residue> fa(n, 0);
+        split<Mod>(a, fa);
+        transform<Mod>(fa, false);
+        if (square)
+        {
+          for (auto &x: fa)
+          {
+            x = static_cast<residue>(static_cast<tworesidues>(x) * x % Mod);
+          }
+        }
+        else
+        {
+          std::vector<residue> fb(n, 0);
+          split<Mod>(b, fb);
+          transform<Mod>(fb, false);
+          for (size_t i = 0; i < n; ++i)
+          {
+            fa[i] = static_cast<residue>(static_cast<tworesidues>(fa[i]) * fb[i] % Mod);
+          }
+        }
+        transform<Mod>(fa, true);
+        return fa;
+      }
+    }
+    
+    // Requirements: a.size() + b.size() <= ntt::max_length
+    void digits_ntt_mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret,
+                        bool square = false)
+    {
+      using ntt::tworesidues;
+      constexpr ntt::residue m0 = ntt::primes[0];
+      constexpr ntt::residue m1 = ntt::primes[1];
+      constexpr ntt::residue m2 = ntt::primes[2];
+      constexpr ntt::residue m0_inv_m1 = ntt::pow_mod(m0, m1 - 2, m1);
+      constexpr ntt::residue m01_inv_m2 = ntt::pow_mod(static_cast<tworesidues>(m0) * m1 % m2, m2 - 2, m2);
+      
+      size_t len = (a.size() + b.size()) * ntt::pieces;
+      size_t n = std::bit_ceil(len - 1);
+      std::vector<ntt::residue> r0, r1, r2;
+      parallel_invoke(a.size(),
+                      [&] { r0 = ntt::convolution<m0>(a, b, n, square); },
+                      [&] { r1 = ntt::convolution<m1>(a, b, n, square); },
+                      [&] { r2 = ntt::convolution<m2>(a, b, n, square); });
+      
+      // Garner's algorithm, each coefficient is below ntt::max_length * 2^60 < m0 * m1 * m2
+      ret.clear();
+      ret.resize(a.size() + b.size());
+      unsigned __int128 carry = 0;
+      for (size_t i = 0; i < len; ++i)
+      {
+        if (i < len - 1)
+        {
+          tworesidues v0 = r0[i];
+          tworesidues v1 = (r1[i] + m1 - v0 % m1) % m1 * m0_inv_m1 % m1;
+          tworesidues v2 = (r2[i] + m2 - (v0 + v1 * m0) % m2) % m2 * m01_inv_m2 % m2;
+          carry += v0 + static_cast<unsigned __int128>(v1) * m0 + static_cast<unsigned __int128>(v2) * m0 * m1;
+        }
+        ret[i / ntt::pieces] |= static_cast<digit>(carry & ntt::piece_mask) << (i % ntt::pieces * ntt::piece_bits);
+        carry >>= ntt::piece_bits;
+      }
+      helper::digits_normalize(ret);
+    }
+    
+    // Multiplies b in a.size()-digits slices so that each product is balanced
+    // Requirements: a.size() <= b.size()
+    void digits_lopsided_mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret)
+    {
+      ret.clear();
+      ret.resize(a.size() + b.size());
+      digit_vector tmp;
+      for (size_t offset = 0; offset < b.size(); offset += a.size())
+      {
+        auto slice = helper::toom_split(b.subspan(offset), a.size(), 0);
+        digits_mul(a, slice, tmp);
+        helper::digits_add_at(ret, tmp, offset);
+      }
+      helper::digits_normalize(ret);
+    }
+    
+    // Requirements: a.size() <= b.size()
+    void digits_karatsuba_mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret,
+                              bool square = false)
+    {
+      size_t shift = b.size() >> 1;
+      auto[ah, al] = helper::k_mul_split(a, shift);
+      decltype(ah) bh, bl;
+      if (!square)
+      {
+        auto s = helper::k_mul_split(b, shift);
+        bh = std::get<0>(s);
+        bl = std::get<1>(s);
+      }
+      digit_vector sa, sb;
+      digits_add(ah, al, sa);
+      if (!square)
+      {
+        digits_add(bh, bl, sb);
+      }
+      digit_vector t1, t2, t3;
+      parallel_invoke(a.size(),
+                      [&] { square ? digits_sqr(ah, t1) : digits_mul(ah, bh, t1); },
+                      [&] { square ? digits_sqr(al, t2) : digits_mul(al, bl, t2); },
+                      [&] { square ? digits_sqr(sa, t3) : digits_mul(sa, sb, t3); });
+      ret.clear();
+      ret.resize(a.size() + b.size());
+      std::copy(t1.begin(), t1.end(), ret.begin() + shift * 2);
+      std::copy(t2.begin(), t2.end(), ret.begin());
+      
+      size_t i = ret.size() - shift;
+      helper::digits_inplace_sub({ret.begin() + shift, i}, t2);
+      helper::digits_inplace_sub({ret.begin() + shift, i}, t1);
+      helper::digits_inplace_add({ret.begin() + shift, i}, t3);
+      helper::digits_normalize(ret);
+    }
+    
+    void digits_mul(const std::span<const digit> c, const std::span<const digit> d, digit_vector &ret)
+    {
+      if (c.empty() || d.empty())
+      {
+        ret.clear();
+        return;
+      }
+      // x * x
+      if (c.data() == d.data() && c.size() == d.size())
+      {
+        digits_sqr(c, ret);
+        return;
+      }
+      ret.clear();
+      auto &a = c.size() < d.size() ? c : d;
+      auto &b = c.size() < d.size() ? d : c;
+      if (a.size() <= SYMXX_HUGE_KARATSUBA_CUTOFF)
+      {
+        digits_simple_mul(a, b, ret);
+        return;
+      }
+      
+      if (a.size() >= SYMXX_HUGE_NTT_CUTOFF && a.size() + b.size() <= ntt::max_length)
+      {
+        digits_ntt_mul(a, b, ret);
+        return;
+      }
+      if (2 * a.size() <= b.size())
+      {
+        digits_lopsided_mul(a, b, ret);
+        return;
+      }
+      // Toom-Cook only pays off when a has a nonempty top piece
+      if (a.size() >= SYMXX_HUGE_TOOM4_CUTOFF && a.size() > 3 * ((b.size() + 3) / 4))
+      {
+        digits_toom4_mul(a, b, ret);
+        return;
+      }
+      if (a.size() >= SYMXX_HUGE_TOOM3_CUTOFF && a.size() > 2 * ((b.size() + 2) / 3))
+      {
+        digits_toom3_mul(a, b, ret);
+        return;
+      }
+      digits_karatsuba_mul(a, b, ret);
+    }
+    
+    void digits_sqr(const std::span<const digit> a, digit_vector &ret)
+    {
+      if (a.empty())
+      {
+        ret.clear();
+        return;
+      }
+      if (a.size() <= SYMXX_HUGE_SQUARE_CUTOFF)
+      {
+        digits_simple_sqr(a, ret);
+      }
+      else if (a.size() >= SYMXX_HUGE_NTT_CUTOFF && 2 * a.size() <= ntt::max_length)
+      {
+        digits_ntt_mul(a, a, ret, true);
+      }
+      else if (a.size() >= SYMXX_HUGE_TOOM4_CUTOFF)
+      {
+        digits_toom4_mul(a, a, ret, true);
+      }
+      else if (a.size() >= SYMXX_HUGE_TOOM3_CUTOFF)
+      {
+        digits_toom3_mul(a, a, ret, true);
+      }
+      else
+      {
+        digits_karatsuba_mul(a, a, ret, true);
+      }
+    }
+    
+    void digits_divrem_by1(const std::span<const digit> c, digit b, digit_vector &res, digit_vector &rem)
+    {
+      res.resize(c.size());
+      digit remd = helper::digits_div_by1(c, b, res.data());
+      helper::digits_normalize(res);
+      if (remd != 0)
+      {
+        rem = {remd};
+      }
+    }
+  
+    void digits_bz_divrem(const std::span<const digit> a, const std::span<const digit> b, digit_vector &res,
+                          digit_vector &rem);
+    
+    void digits_divrem(const std::span<const digit> &a, const std::span<const digit> &b, digit_vector &res,
+                       digit_vector &rem)
+    {
+      res.clear();
+      rem.clear();
+      int cmp = digits_cmp(a, b);
+      if (cmp == 0)
+      {
+        res = {1};
+        return;
+      }
+      else if (cmp < 0)
+      {
+        res.clear();
+        rem.insert(rem.end(), a.begin(), a.end());
+        return;
+      }
+      
+      if (b.size() == 1)
+      {
+        digits_divrem_by1(a, b[0], res, rem);
+        return;
+      }
+      if (b.size() >= SYMXX_HUGE_BZ_CUTOFF && a.size() - b.size() >= SYMXX_HUGE_BZ_CUTOFF)
+      {
+        digits_bz_divrem(a, b, res, rem);
+        return;
+      }
+  
+      size_t sz_a = a.size();
+      size_t sz_b = b.size();
+  
+      digit_vector v(sz_a + 1, 0);
+      digit_vector w(sz_b, 0);
+      int d = SYMXX_HUGE_SHIFT - std::bit_width(b.back());
+      helper::digits_left_shift(w, b, sz_b, d);
+      digit carry = helper::digits_left_shift(v, a, sz_a, d);
+      if (carry != 0 || v[sz_a - 1] >= w[sz_b - 1])
+      {
+        v[sz_a] = carry;
+        sz_a++;
+      }
+  
+      size_t k = sz_a - sz_b;
+      res.resize(k);
+      digit wm1 = w[sz_b - 1];
+      digit wm2 = w[sz_b - 2];
+      helper::Reciprocal recip{wm1};
+      for (auto vk = v.begin() + k, sk = res.begin() + k; vk-- > v.begin();)
+      {
+        digit vtop = *(vk + sz_b);
+        digit q;
+        digit r;
+        if (vtop < wm1)
+        {
+          uint64_t r64 = vtop;
+          q = static_cast<digit>(recip.divrem(r64, *(vk + sz_b - 1), SYMXX_HUGE_SHIFT));
+          r = static_cast<digit>(r64);
+        }
+        else
+        {
+          // vtop == wm1, the quotient estimate may be SYMXX_HUGE_BASE
+          twodigits vv = (static_cast<twodigits>(vtop) << SYMXX_HUGE_SHIFT) | *(vk + sz_b - 1);
+          q = static_cast<digit>(vv / wm1);
+          r = static_cast<digit>(vv % wm1);
+        }
+        
+        while (static_cast<twodigits>(wm2) * q >
+               ((static_cast<twodigits>(r) << SYMXX_HUGE_SHIFT) | *(vk + sz_b - 2)))
+        {
+          --q;
+          r += wm1;
+          if (r >= SYMXX_HUGE_BASE)
+          {
+            break;
+          }
+        }
+        sdigit zhi = static_cast<sdigit>(0);
+        for (size_t i = 0; i < sz_b; ++i)
+        {
+          stwodigits z = static_cast<sdigit>(*(vk + i)) + zhi -
+                         static_cast<stwodigits>(q) * static_cast<stwodigits>(w[i]);
+          *(vk + i) = static_cast<digit>(z) & SYMXX_HUGE_LOW_MASK;
+          // Since C++20, right shift on a signed number is definitely arithmetic right shift.
+          // https://en.cppreference.com/w/cpp/language/operator_arithmetic
+          zhi = static_cast<sdigit>(z >> SYMXX_HUGE_SHIFT);
+        }
+        if (static_cast<sdigit>(vtop) + zhi < 0)
+        {
+          carry = 0;
+          for (size_t i = 0; i < sz_b; ++i)
+          {
+            carry += *(vk + i) + w[i];
+            *(vk + i) = carry & SYMXX_HUGE_LOW_MASK;
+            carry >>= SYMXX_HUGE_SHIFT;
+          }
+          --q;
+        }
+        *--sk = q;
+      }
+      // reuse w to store the rem
+      helper::digits_right_shift(w, v, sz_b, d);
+      std::swap(rem, w);
+      while (!rem.empty() && rem.back() == 0) rem.pop_back();
+      while (!res.empty() && res.back() == 0) res.pop_back();
+    }
+
+    // Burnikel-Ziegler's recursive division, see "Fast Recursive Division" and
+    // RecursiveDivRem in Brent and Zimmermann's "Modern Computer Arithmetic".
+    namespace bz
+    {
+      // n zero digits followed by a
+      digit_vector shifted(const std::span<const digit> a, size_t n)
+      {
+        digit_vector ret(n + a.size(), 0);
+        std::copy(a.begin(), a.end(), ret.begin() + static_cast<long long>(n));
+        helper::digits_normalize(ret);
+        return ret;
+      }
+      
+      // low + high * BASE^n, with low.size() <= n
+      digit_vector join(const std::span<const digit> low, const std::span<const digit> high, size_t n)
+      {
+        digit_vector ret(n + high.size(), 0);
+        std::copy(low.begin(), low.end(), ret.begin());
+        std::copy(high.begin(), high.end(), ret.begin() + static_cast<long long>(n));
+        helper::digits_normalize(ret);
+        return ret;
+      }
+      
+      std::span<const digit> low(const std::span<const digit> a, size_t n)
+      {
+        return helper::toom_split(a, n, 0);
+      }
+      
+      std::span<const digit> high(const std::span<const digit> a, size_t n)
+      {
+        return a.size() <= n ? std::span<const digit>{} : a.subspan(n);
+      }
+      
+      // x -= 1, q != 0
+      void decrement(digit_vector &q)
+      {
+        digit_vector tmp;
+        digits_sub(q, digit_vector{1}, tmp);
+        std::swap(q, tmp);
+      }
+      
+      // a = q * b + r, where b is normalized, a.size() <= 2 * b.size() and a < b * BASE^b.size()
+      void divrem(const std::span<const digit> a, const std::span<const digit> b,
+                  digit_vector &q, digit_vector &r)
+      {
+        size_t n = b.size();
+        if (a.size() <= n || n < SYMXX_HUGE_BZ_CUTOFF || a.size() - n < SYMXX_HUGE_BZ_CUTOFF)
+        {
+          digits_divrem(a, b, q, r);
+          return;
+        }
+        size_t k = (a.size() - n) / 2;
+        auto b1 = high(b, k);
+        auto b0 = low(b, k);
+        // the top half of the quotient
+        digit_vector q1, r1;
+        divrem(high(a, 2 * k), b1, q1, r1);
+        auto x = join(low(a, 2 * k), r1, 2 * k);
+        digit_vector t;
+        digits_mul(q1, b0, t);
+        t = shifted(t, k);
+        if (digits_cmp(x, t) < 0)
+        {
+          auto bk = shifted(b, k);
+          digit_vector tmp;
+          while (digits_cmp(x, t) < 0)
+          {
+            decrement(q1);
+            digits_add(x, bk, tmp);
+            std::swap(x, tmp);
+          }
+        }
+        digit_vector tmp;
+        digits_sub(x, t, tmp);
+        std::swap(x, tmp);
+        // the bottom half
+        digit_vector q0, r0;
+        divrem(high(x, k), b1, q0, r0);
+        r = join(low(x, k), r0, k);
+        digits_mul(q0, b0, t);
+        while (digits_cmp(r, t) < 0)
+        {
+          decrement(q0);
+          digits_add(r, b, tmp);
+          std::swap(r, tmp);
+        }
+        digits_sub(r, t, tmp);
+        std::swap(r, tmp);
+        q = join(q0, q1, k);
+      }
+    }
+    
+    // Requirements: a > b, b.size() >= 2
+    void digits_bz_divrem(const std::span<const digit> a, const std::span<const digit> b, digit_vector &res,
+                          digit_vector &rem)
+    {
+      size_t n = b.size();
+      int d = SYMXX_HUGE_SHIFT - std::bit_width(b.back());
+      digit_vector w(n);
+      digit_vector v(a.size() + 1);
+      helper::digits_left_shift(w, b, n, d);
+      v.back() = helper::digits_left_shift(v, a, a.size(), d);
+      helper::digits_normalize(v);
+      
+      // schoolbook division on n-digit blocks, each step divides a 2n-digit number by w
+      size_t blocks = (v.size() + n - 1) / n;
+      res.assign(blocks * n, 0);
+      digit_vector r;
+      digit_vector q;
+      for (size_t j = blocks; j-- > 0;)
+      {
+        auto x = bz::join(bz::low(std::span<const digit>(v).subspan(j * n), n), r, n);
+        bz::divrem(x, w, q, r);
+        std::copy(q.begin(), q.end(), res.begin() + static_cast<long long>(j * n));
+      }
+      helper::digits_normalize(res);
+      rem.assign(r.size(), 0);
+      helper::digits_right_shift(rem, r, r.size(), d);
+      helper::digits_normalize(rem);
+    }
+    
+    void digits_rem(const std::span<const digit> &a, const std::span<const digit> &b, digit_vector &rem)
+    {
+      rem.clear();
+      if (digits_cmp(a, b) < 0)
+      {
+        rem.insert(rem.end(), a.begin(), a.end());
+        return;
+      }
+      if (b.size() == 1)
+      {
+        helper::digits_rem_by1(a, b[0], rem);
+        return;
+      }
+      else
+      {
+        digit_vector tmp;
+        digits_divrem(a, b, tmp, rem);
+      }
+      return;
+    }
+  
+    // Conversion between base 2^30 and base 10^9, both least significant first.
+    // Large numbers are split by (10^9)^(2^k) and converted recursively.
+    namespace radix
+    {
+      // (10^9)^(2^k)
+      const digit_vector &decimal_power(size_t k)
+      {
+        ResourceScope global{nullptr};
+        thread_local std::deque<digit_vector> powers{{SYMXX_HUGE_DECIMAL_BASE}};
+        while (powers.size() <= k)
+        {
+          digit_vector next;
+          digits_sqr(powers.back(), next);
+          powers.emplace_back(std::move(next));
+        }
+        return powers[k];
+      }
+      
+      void to_decimal_basecase(const std::span<const digit> a, digit_vector &out)
+      {
+#if SYMXX_HUGE_DIGIT_BITS == 60
+        // The compiler turns divisions by a constant into multiplications, but not for unsigned __int128
+        constexpr helper::Reciprocal decimal{SYMXX_HUGE_DECIMAL_BASE};
+#endif
+        out.clear();
+        for (auto rit = a.rbegin(); rit < a.rend(); ++rit)
+        {
+          auto hi = *rit;
+          for (auto &j: out)
+          {
+#if SYMXX_HUGE_DIGIT_BITS == 60
+            hi = decimal.divrem(j, hi);
+#else
+            twodigits z = static_cast<twodigits>(j) << SYMXX_HUGE_SHIFT | hi;
+            hi = static_cast<digit>(z / SYMXX_HUGE_DECIMAL_BASE);
+            j = static_cast<digit>(z - static_cast<twodigits>(hi) * SYMXX_HUGE_DECIMAL_BASE);
+#endif
+          }
+          while (hi != 0)
+          {
+            out.emplace_back(hi % SYMXX_HUGE_DECIMAL_BASE);
+            hi /= SYMXX_HUGE_DECIMAL_BASE;
+          }
+        }
+      }
+      
+      void from_decimal_basecase(const std::span<const digit> dec, digit_vector &out)
+      {
+        out.clear();
+        for (auto rit = dec.rbegin(); rit < dec.rend(); ++rit)
+        {
+          twodigits c = *rit;
+          for (auto &p: out)
+          {
+            c += static_cast<twodigits>(p) * SYMXX_HUGE_DECIMAL_BASE;
+            p = static_cast<digit>(c & SYMXX_HUGE_LOW_MASK);
+            c >>= SYMXX_HUGE_SHIFT;
+          }
+          while (c != 0)
+          {
+            out.emplace_back(static_cast<digit>(c & SYMXX_HUGE_LOW_MASK));
+            c >>= SYMXX_HUGE_SHIFT;
+          }
+        }
+      }
+    }
+    
+    void digits_to_decimal(const std::span<const digit> a, digit_vector &out)
+    {
+      if (a.size() <= SYMXX_HUGE_RADIX_CUTOFF)
+      {
+        radix::to_decimal_basecase(a, out);
+        return;
+      }
+      // (10^9)^(2^k) has about 2^k digits, which is in (a.size() / 4, a.size() / 2]
+      size_t k = std::bit_width(a.size()) - 2;
+      digit_vector q;
+      digit_vector r;
+      digits_divrem(a, radix::decimal_power(k), q, r);
+      digits_to_decimal(r, out);
+      out.resize(static_cast<size_t>(1) << k, 0);
+      digit_vector high;
+      digits_to_decimal(q, high);
+      out.insert(out.end(), high.begin(), high.end());
+    }
+    
+    void digits_from_decimal(const std::span<const digit> dec, digit_vector &out)
+    {
+      if (dec.size() <= SYMXX_HUGE_RADIX_CUTOFF)
+      {
+        radix::from_decimal_basecase(dec, out);
+        return;
+      }
+      // dec = high * (10^9)^(2^k) + low
+      size_t k = std::bit_width(dec.size() - 1) - 1;
+      size_t half = static_cast<size_t>(1) << k;
+      digit_vector low;
+      digit_vector high;
+      digits_from_decimal(dec.first(half), low);
+      digits_from_decimal(dec.subspan(half), high);
+      digits_mul(high, radix::decimal_power(k), out);
+      if (out.size() < low.size())
+      {
+        out.resize(low.size(), 0);
+      }
+      out.emplace_back(0);
+      helper::digits_add_at(out, low, 0);
+      helper::digits_normalize(out);
+    }
+    
+    namespace lehmer
+    {
+      // std::countr_zero does not take unsigned __int128
+      template<typename T>
+      int countr_zero(T x)
+      {
+        if constexpr (sizeof(T) <= sizeof(uint64_t))
+        {
+          return std::countr_zero(static_cast<uint64_t>(x));
+        }
+        else
+        {
+          auto low = static_cast<uint64_t>(x);
+          return low != 0 ? std::countr_zero(low) : 64 + std::countr_zero(static_cast<uint64_t>(x >> 64));
+        }
+      }
+      
+      // Requirements: a.size() <= 2
+      twodigits to_twodigits(const std::span<const digit> a)
+      {
+        twodigits ret = 0;
+        for (auto rit = a.rbegin(); rit < a.rend(); ++rit)
+        {
+          ret = ret << SYMXX_HUGE_SHIFT | *rit;
+        }
+        return ret;
+      }
+      
+      void from_twodigits(twodigits x, digit_vector &ret)
+      {
+        ret.clear();
+        for (; x != 0; x >>= SYMXX_HUGE_SHIFT)
+        {
+          ret.emplace_back(static_cast<digit>(x & SYMXX_HUGE_LOW_MASK));
+        }
+      }
+      
+      // Stein's binary GCD, for values that fit in two digits
+      twodigits binary_gcd(twodigits u, twodigits v)
+      {
+        if (u == 0) return v;
+        if (v == 0) return u;
+        int shift = countr_zero(u | v);
+        u >>= countr_zero(u);
+        do
+        {
+          v >>= countr_zero(v);
+          if (u > v)
+          {
+            std::swap(u, v);
+          }
+          v -= u;
+        } while (v != 0);
+        return u << shift;
+      }
+      
+      // The quotients of the Euclidean algorithm mostly depend on the leading bits only.
+      // c = A * a - B * b and d = D * b - C * a are a later pair of remainders.
+      struct Matrix
+      {
+        stwodigits A;
+        stwodigits B;
+        stwodigits C;
+        stwodigits D;
+      };
+      
+      // Runs the Euclidean algorithm on the leading 2 * SYMXX_HUGE_SHIFT bits of a and b for as long
+      // as its quotients are certain to be those of a and b, then applies the result to a and b.
+      // Returns false if not even one step was certain, and a full Euclidean step is needed instead.
+      // Requirements: a >= b > 0, a.size() > 2
+      bool step(digit_vector &a, digit_vector &b, digit_vector &c, digit_vector &d, Matrix &m)
+      {
+        size_t size_a = a.size();
+        size_t size_b = b.size();
+        int nbits = std::bit_width(a.back());
+        auto at = [size_b](const digit_vector &v, size_t i) { return i < size_b ? static_cast<stwodigits>(v[i]) : 0; };
+        stwodigits x = static_cast<stwodigits>(a[size_a - 1]) << (2 * SYMXX_HUGE_SHIFT - nbits)
+                       | static_cast<stwodigits>(a[size_a - 2]) << (SYMXX_HUGE_SHIFT - nbits)
+                       | static_cast<stwodigits>(a[size_a - 3]) >> nbits;
+        stwodigits y = at(b, size_a - 1) << (2 * SYMXX_HUGE_SHIFT - nbits)
+                       | at(b, size_a - 2) << (SYMXX_HUGE_SHIFT - nbits)
+                       | at(b, size_a - 3) >> nbits;
+        // A, B, C and D never exceed SYMXX_HUGE_LOW_MASK
+        stwodigits A = 1;
+        stwodigits B = 0;
+        stwodigits C = 0;
+        stwodigits D = 1;
+        size_t k = 0;
+        for (;; ++k)
+        {
+          if (y - C == 0)
+          {
+            break;
+          }
+          stwodigits q = (x + (A - 1)) / (y - C);
+          stwodigits s = B + q * D;
+          stwodigits t = x - q * y;
+          if (s > t)
+          {
+            break;
+          }
+          x = y;
+          y = t;
+          t = A + q * C;
+          A = D;
+          B = C;
+          C = s;
+          D = t;
+        }
+        if (k == 0)
+        {
+          return false;
+        }
+        // After an odd number of steps the signs are the other way around
+        if (k & 1)
+        {
+          std::swap(A, B);
+          A = -A;
+          B = -B;
+          std::swap(C, D);
+          C = -C;
+          D = -D;
+        }
+        c.resize(size_a);
+        d.resize(size_a);
+        stwodigits c_carry = 0;
+        stwodigits d_carry = 0;
+        for (size_t i = 0; i < size_a; ++i)
+        {
+          c_carry += A * static_cast<stwodigits>(a[i]) - B * at(b, i);
+          d_carry += D * at(b, i) - C * static_cast<stwodigits>(a[i]);
+          c[i] = static_cast<digit>(c_carry & SYMXX_HUGE_LOW_MASK);
+          d[i] = static_cast<digit>(d_carry & SYMXX_HUGE_LOW_MASK);
+          c_carry >>= SYMXX_HUGE_SHIFT;
+          d_carry >>= SYMXX_HUGE_SHIFT;
+        }
+        helper::digits_normalize(c);
+        helper::digits_normalize(d);
+        std::swap(a, c);
+        std::swap(b, d);
+        m = {A, B, C, D};
+        return true;
+      }
+      
+      // Lehmer's state, kept per thread so that repeated GCDs do not allocate
+      std::array<digit_vector, 4> &scratch()
+      {
+        thread_local std::array<digit_vector, 4> buffers{digit_vector(nullptr), digit_vector(nullptr),
+                                                         digit_vector(nullptr), digit_vector(nullptr)};
+        return buffers;
+      }
+    }
+    
+    // Lehmer's GCD, following CPython's _PyLong_GCD, finished by a binary GCD once
+    // the values fit in two digits.
+    void digits_gcd(const std::span<const digit> x, const std::span<const digit> y, digit_vector &ret)
+    {
+      if (x.size() <= 2 && y.size() <= 2)
+      {
+        lehmer::from_twodigits(lehmer::binary_gcd(lehmer::to_twodigits(x), lehmer::to_twodigits(y)), ret);
+        return;
+      }
+      auto &[a, b, c, d] = lehmer::scratch();
+      bool swap = digits_cmp(x, y) < 0;
+      auto &big = swap ? y : x;
+      auto &small = swap ? x : y;
+      a.clear();
+      a.insert(a.end(), big.begin(), big.end());
+      b.clear();
+      b.insert(b.end(), small.begin(), small.end());
+      lehmer::Matrix m{};
+      while (a.size() > 2 && !b.empty())
+      {
+        if (!lehmer::step(a, b, c, d, m))
+        {
+          digits_rem(a, b, c);
+          std::swap(a, b);
+          std::swap(b, c);
+        }
+      }
+      if (b.empty())
+      {
+        ret = a;
+        return;
+      }
+      lehmer::from_twodigits(lehmer::binary_gcd(lehmer::to_twodigits(a), lehmer::to_twodigits(b)), ret);
+    }
+    
+    template<typename U>
+    std::enable_if_t<std::is_integral_v<std::decay_t<U>>>
+    digits_from_int(const U &val, digit_vector &digits)
+    {
+      U u = val > 0 ? val : static_cast<U>(0) - val;
+      if constexpr (sizeof(U) * 8 <= SYMXX_HUGE_SHIFT)
+      {
+        if (u != 0)
+        {
+          digits.emplace_back(static_cast<digit>(u));
+        }
+      }
+      else
       {
-        ret.emplace_back(carry);
+        for (; u != 0; u >>= static_cast<U>(SYMXX_HUGE_SHIFT))
+        {
+          digits.emplace_back(static_cast<digit>(u & SYMXX_HUGE_LOW_MASK));
+        }
       }
     }
     
-    void digits_sub(const std::span<const digit> a, const std::span<const digit> b, std::vector<digit> &ret)
+    // ret = a << n
+    void digits_lshift(const std::span<const digit> a, size_t n, digit_vector &ret)
     {
-      //requirement a >= b
       ret.clear();
-      digit borrow = 0;
-      for (size_t i = 0; i < a.size(); ++i)
+      if (a.empty())
       {
-        borrow = a[i] - borrow;
-        if (i < b.size())
-        {
-          borrow -= b[i];
-        }
-        ret.emplace_back(borrow & SYMXX_HUGE_LOW_MASK);
-        borrow >>= SYMXX_HUGE_SHIFT;
-        borrow &= 1;
+        return;
       }
+      size_t wordshift = n / SYMXX_HUGE_SHIFT;
+      ret.assign(wordshift + a.size() + 1, 0);
+      ret.back() = helper::digits_left_shift({ret.begin() + static_cast<long long>(wordshift), a.size()}, a, a.size(),
+                                             static_cast<int>(n % SYMXX_HUGE_SHIFT));
+      helper::digits_normalize(ret);
     }
     
-    void digits_simple_mul(const std::span<const digit> a, const std::span<const digit> b, std::vector<digit> &ret)
+    // ret = a >> n
+    void digits_rshift(const std::span<const digit> a, size_t n, digit_vector &ret)
     {
       ret.clear();
-      ret.resize(a.size() + b.size());
-      for (size_t i = 0; i < a.size(); ++i)
-      {
-        twodigits carry = 0;
-        auto itr = ret.begin() + static_cast<long long>(i);
-        for (auto itb = b.begin(); itb < b.end(); ++itb, ++itr)
-        {
-          carry += *itr + *itb * static_cast<twodigits>(a[i]);
-          *itr = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
-          carry >>= SYMXX_HUGE_SHIFT;
-        }
-        if (carry != 0)
-        {
-          *itr += static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
-        }
-      }
-      while (ret.back() == 0)
+      size_t wordshift = n / SYMXX_HUGE_SHIFT;
+      if (wordshift >= a.size())
       {
-        ret.pop_back();
+        return;
       }
+      ret.assign(a.size() - wordshift, 0);
+      helper::digits_right_shift(ret, a.subspan(wordshift), ret.size(), static_cast<int>(n % SYMXX_HUGE_SHIFT));
+      helper::digits_normalize(ret);
     }
     
-    //positive for a>b, 0 for a==b, negative for a<b
-    int digits_cmp(const std::span<const digit> a, const std::span<const digit> b, bool apositive = true,
-                   bool bpositive = true)
+    namespace power
     {
-      sdigit sign =
-          (apositive ? 1 : -1) * static_cast<sdigit>(a.size()) - (bpositive ? 1 : -1) * static_cast<sdigit>(b.size());
-      if (sign == 0)
+      // Window size for sliding window exponentiation, by the exponent's bit length
+      int window_size(size_t bits)
+      {
+        if (bits <= 8) return 1;
+        if (bits <= 24) return 2;
+        if (bits <= 80) return 3;
+        if (bits <= 240) return 4;
+        return 5;
+      }
+      
+      bool exponent_bit(const std::span<const digit> e, size_t i)
+      {
+        return (e[i / SYMXX_HUGE_SHIFT] >> (i % SYMXX_HUGE_SHIFT) & 1) != 0;
+      }
+      
+      // Left-to-right sliding window exponentiation, ret = a^e.
+      // mul(x, y, ret) and sqr(x, ret) never get ret as an operand.
+      // Requirements: e > 0
+      template<typename Mul, typename Sqr>
+      void sliding_window(const std::span<const digit> a, const std::span<const digit> e, digit_vector &ret,
+                          Mul &&mul, Sqr &&sqr)
       {
-        sdigit diff = 0;
-        for (auto i = static_cast<long long>(a.size()); --i >= 0;)
+        size_t bits = (e.size() - 1) * SYMXX_HUGE_SHIFT + std::bit_width(e.back());
+        int k = window_size(bits);
+        // table[i] = a^(2i + 1)
+        std::vector<digit_vector> table(static_cast<size_t>(1) << (k - 1));
+        table[0].insert(table[0].end(), a.begin(), a.end());
+        if (k > 1)
         {
-          diff = static_cast<sdigit>(a[i]) - static_cast<sdigit>(b[i]);
-          if (diff != 0)
+          digit_vector a2;
+          sqr(table[0], a2);
+          for (size_t i = 1; i < table.size(); ++i)
           {
-            break;
+            mul(table[i - 1], a2, table[i]);
           }
         }
-        sign = apositive ? diff : -diff;
+        digit_vector tmp;
+        bool started = false;
+        for (auto i = static_cast<long long>(bits) - 1; i >= 0;)
+        {
+          if (!exponent_bit(e, static_cast<size_t>(i)))
+          {
+            sqr(ret, tmp);
+            std::swap(ret, tmp);
+            --i;
+            continue;
+          }
+          // the longest window e[j, i] of at most k bits that ends with a one
+          long long j = std::max(i - k + 1, 0LL);
+          while (!exponent_bit(e, static_cast<size_t>(j)))
+          {
+            ++j;
+          }
+          size_t w = 0;
+          for (long long l = i; l >= j; --l)
+          {
+            w = w << 1 | static_cast<size_t>(exponent_bit(e, static_cast<size_t>(l)));
+            if (started)
+            {
+              sqr(ret, tmp);
+              std::swap(ret, tmp);
+            }
+          }
+          if (started)
+          {
+            mul(ret, table[w >> 1], tmp);
+            std::swap(ret, tmp);
+          }
+          else
+          {
+            ret = table[w >> 1];
+            started = true;
+          }
+          i = j - 1;
+        }
       }
-      return sign;
     }
     
-    void digits_mul(const std::span<const digit> c, const std::span<const digit> d, std::vector<digit> &ret)
+    // ret = a^n. The power of two in a is split off and applied as a shift at the end.
+    void digits_pow(const std::span<const digit> a, uint64_t n, digit_vector &ret)
     {
-      if (c.empty() || d.empty())
-      {
-        ret.clear();
-        return;
-      }
       ret.clear();
-      auto &a = c.size() < d.size() ? c : d;
-      auto &b = c.size() < d.size() ? d : c;
-      constexpr digit cut_off = 70;
-      constexpr digit square_cut_off = (2 * cut_off);
-      bool eq = (digits_cmp(c, d) == 0);
-      size_t i = eq ? square_cut_off : cut_off;
-      if (a.size() <= i)
+      if (n == 0)
       {
-        if (a.size() == 0)
-          return;
-        else
-        {
-          digits_simple_mul(a, b, ret);
-          return;
-        }
+        ret.emplace_back(1);
+        return;
       }
-      
-      //if (2 * a.size() <= b.size())
-      //  return k_lopsided_mul(a, b);
-      size_t shift = b.size() >> 1;
-      auto[ah, al] = helper::k_mul_split(a, shift);
-      decltype(ah) bh, bl;
-      if (eq)
+      if (a.empty())
       {
-        bh = ah;
-        bl = al;
+        return;
       }
-      else
+      size_t zd = 0;
+      while (a[zd] == 0)
       {
-        auto s = helper::k_mul_split(b, shift);
-        bh = std::get<0>(s);
-        bl = std::get<1>(s);
+        ++zd;
       }
-      ret.resize(a.size() + b.size());
-      std::vector<digit> t1;
-      digits_mul(ah, bh, t1);
-      std::copy(t1.begin(), t1.end(), ret.begin() + shift * 2);
-      
-      std::vector<digit> t2;
-      digits_mul(al, bl, t2);
-      std::copy(t2.begin(), t2.end(), ret.begin());
-      
-      i = ret.size() - shift;
-      helper::digits_inplace_sub({ret.begin() + shift, i}, t2);
-      helper::digits_inplace_sub({ret.begin() + shift, i}, t1);
-      digits_add(ah, al, t1);
-      if (eq)
+      int zb = std::countr_zero(a[zd]);
+      size_t z = zd * SYMXX_HUGE_SHIFT + static_cast<size_t>(zb);
+      digit_vector odd(a.size() - zd);
+      helper::digits_right_shift(odd, a.subspan(zd), odd.size(), zb);
+      helper::digits_normalize(odd);
+      symxx_assert(n <= std::numeric_limits<size_t>::max() / (a.size() * SYMXX_HUGE_SHIFT), "The result is too big.");
+      if (odd.size() == 1 && odd[0] == 1)
       {
-        t2 = t1;
+        ret.emplace_back(1);
       }
       else
       {
-        digits_add(bh, bl, t2);
+        digit_vector e;
+        digits_from_int(n, e);
+        power::sliding_window(odd, e, ret,
+                              [](auto &&x, auto &&y, auto &&r) { digits_mul(x, y, r); },
+                              [](auto &&x, auto &&r) { digits_sqr(x, r); });
       }
-      
-      std::vector<digit> t3;
-      digits_mul(t1, t2, t3);
-      helper::digits_inplace_add({ret.begin() + shift, i}, t3);
-      while (ret.back() == 0)
+      if (z == 0)
       {
-        ret.pop_back();
+        return;
       }
+      digit_vector odd_power;
+      std::swap(ret, odd_power);
+      digits_lshift(odd_power, z * static_cast<size_t>(n), ret);
     }
     
-    void digits_divrem_by1(const std::span<const digit> c, digit b, std::vector<digit> &res, std::vector<digit> &rem)
+    // Multiplication modulo a fixed odd n of k digits in Montgomery form, x * R mod n with R = BASE^k.
+    // The reduction is interleaved with the product one digit at a time, like CIOS in
+    // Koc, Acar and Kaliski, "Analyzing and Comparing Montgomery Multiplication Algorithms".
+    class Montgomery
     {
-      digit remd = 0;
-      res.resize(c.size());
-      for (int i = c.size() - 1; i >= 0; --i)
-      {
-        twodigits dividend = (static_cast<twodigits>(remd) << SYMXX_HUGE_SHIFT) | c[i];
-        digit quotient = static_cast<digit>(dividend / b);
-        remd = dividend % b;
-        res[i] = quotient;
-      }
-      if (remd != 0)
+    private:
+      digit_vector n;
+      // -n^-1 mod BASE
+      digit ninv = 0;
+      // R^2 mod n
+      digit_vector r2;
+    
+    public:
+      Montgomery() = default;
+      
+      explicit Montgomery(const std::span<const digit> m) : n(m.begin(), m.end())
       {
-        rem = {remd};
+        // Newton's iteration doubles the number of correct low bits, n * n == 1 mod 8 to start with
+        uint64_t inv = n[0];
+        for (int i = 0; i < 5; ++i)
+        {
+          inv *= 2 - n[0] * inv;
+        }
+        ninv = static_cast<digit>(-inv) & SYMXX_HUGE_LOW_MASK;
+        digit_vector r(2 * n.size() + 1, 0);
+        r.back() = 1;
+        digits_rem(r, n, r2);
       }
-    }
-  
-    void digits_divrem(const std::span<const digit> &a, const std::span<const digit> &b, std::vector<digit> &res,
-                       std::vector<digit> &rem)
-    {
-      res.clear();
-      rem.clear();
-      int cmp = digits_cmp(a, b);
-      if (cmp == 0)
+      
+      // ret = a * b / R mod n
+      // Requirements: a, b < n, ret is neither a nor b
+      void mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret) const
       {
-        res = {1};
-        return;
+        size_t k = n.size();
+        ret.assign(k + 2, 0);
+        for (size_t i = 0; i < k; ++i)
+        {
+          twodigits ai = i < a.size() ? a[i] : 0;
+          twodigits carry = 0;
+          size_t j = 0;
+          for (; j < b.size(); ++j)
+          {
+            carry += ret[j] + ai * b[j];
+            ret[j] = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+            carry >>= SYMXX_HUGE_SHIFT;
+          }
+          for (; carry != 0; ++j)
+          {
+            carry += ret[j];
+            ret[j] = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+            carry >>= SYMXX_HUGE_SHIFT;
+          }
+          // adding m * n clears the lowest digit, which is then shifted out
+          twodigits m = static_cast<digit>(ret[0] * ninv) & SYMXX_HUGE_LOW_MASK;
+          carry = (ret[0] + m * n[0]) >> SYMXX_HUGE_SHIFT;
+          for (j = 1; j < k; ++j)
+          {
+            carry += ret[j] + m * n[j];
+            ret[j - 1] = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+            carry >>= SYMXX_HUGE_SHIFT;
+          }
+          carry += ret[k];
+          ret[k - 1] = static_cast<digit>(carry & SYMXX_HUGE_LOW_MASK);
+          ret[k] = ret[k + 1] + static_cast<digit>(carry >> SYMXX_HUGE_SHIFT);
+          ret[k + 1] = 0;
+        }
+        helper::digits_normalize(ret);
+        if (digits_cmp(ret, n) >= 0)
+        {
+          helper::digits_inplace_sub(ret, n);
+          helper::digits_normalize(ret);
+        }
       }
-      else if (cmp < 0)
+      
+      // ret = a * R mod n
+      // Requirements: a < n
+      void to(const std::span<const digit> a, digit_vector &ret) const
       {
-        res.clear();
-        rem.insert(rem.end(), a.begin(), a.end());
-        return;
+        mul(a, r2, ret);
       }
       
-      if (b.size() == 1)
+      // ret = a / R mod n
+      void from(const std::span<const digit> a, digit_vector &ret) const
       {
-        digits_divrem_by1(a, b[0], res, rem);
-        return;
+        digit one = 1;
+        mul(a, {&one, 1}, ret);
       }
-  
-      size_t sz_a = a.size();
-      size_t sz_b = b.size();
-  
-      std::vector<digit> v(sz_a + 1, 0);
-      std::vector<digit> w(sz_b, 0);
-      int d = SYMXX_HUGE_SHIFT - std::bit_width(b.back());
-      helper::digits_left_shift(w, b, sz_b, d);
-      digit carry = helper::digits_left_shift(v, a, sz_a, d);
-      if (carry != 0 || v[sz_a - 1] >= w[sz_b - 1])
+    };
+    
+    // Reduction modulo a fixed n of k digits, with mu = floor(BASE^2k / n).
+    // HAC Algorithm 14.42, for the even moduli that Montgomery multiplication cannot take.
+    class Barrett
+    {
+    private:
+      digit_vector n;
+      digit_vector mu;
+    
+    public:
+      Barrett() = default;
+      
+      explicit Barrett(const std::span<const digit> m) : n(m.begin(), m.end())
       {
-        v[sz_a] = carry;
-        sz_a++;
+        digit_vector b(2 * n.size() + 1, 0);
+        b.back() = 1;
+        digit_vector r;
+        digits_divrem(b, n, mu, r);
       }
-  
-      size_t k = sz_a - sz_b;
-      res.resize(k);
-      digit wm1 = w[sz_b - 1];
-      digit wm2 = w[sz_b - 2];
-      for (auto vk = v.begin() + k, sk = res.begin() + k; vk-- > v.begin();)
+      
+      // x = x mod n
+      // Requirements: x < BASE^2k
+      void reduce(digit_vector &x) const
       {
-        digit vtop = *(vk + sz_b);
-        twodigits vv = (static_cast<twodigits>(vtop) << SYMXX_HUGE_SHIFT) | *(vk + sz_b - 1);
-        digit q = static_cast<digit>(vv / wm1);
-        digit r = static_cast<digit>(vv % wm1);
-        
-        while (static_cast<twodigits>(wm2) * q >
-               ((static_cast<twodigits>(r) << SYMXX_HUGE_SHIFT) | *(vk + sz_b - 2)))
+        size_t k = n.size();
+        if (x.size() < k)
         {
-          --q;
-          r += wm1;
-          if (r >= SYMXX_HUGE_BASE)
-          {
-            break;
-          }
+          return;
         }
-        sdigit zhi = static_cast<sdigit>(0);
-        for (size_t i = 0; i < sz_b; ++i)
+        digit_vector q;
+        digit_vector qn;
+        digits_mul(std::span<const digit>{x}.subspan(k - 1), mu, q);
+        if (q.size() <= k + 1)
         {
-          stwodigits z = static_cast<sdigit>(*(vk + i)) + zhi -
-                         static_cast<stwodigits>(q) * static_cast<stwodigits>(w[i]);
-          *(vk + i) = static_cast<digit>(z) & SYMXX_HUGE_LOW_MASK;
-          // Since C++20, right shift on a signed number is definitely arithmetic right shift.
-          // https://en.cppreference.com/w/cpp/language/operator_arithmetic
-          zhi = static_cast<sdigit>(z >> SYMXX_HUGE_SHIFT);
+          q.clear();
         }
-        if (static_cast<sdigit>(vtop) + zhi < 0)
+        digits_mul(std::span<const digit>{q}.subspan(std::min(q.size(), k + 1)), n, qn);
+        // the estimate is at most two too small
+        digits_sub_inplace(x, qn);
+        while (digits_cmp(x, n) >= 0)
         {
-          carry = 0;
-          for (size_t i = 0; i < sz_b; ++i)
-          {
-            carry += *(vk + i) + w[i];
-            *(vk + i) = carry & SYMXX_HUGE_LOW_MASK;
-            carry >>= SYMXX_HUGE_SHIFT;
-          }
-          --q;
+          helper::digits_inplace_sub(x, n);
+          helper::digits_normalize(x);
         }
-        *--sk = q;
       }
-      // reuse w to store the rem
-      helper::digits_right_shift(w, v, sz_b, d);
-      std::swap(rem, w);
-      while (rem.back() == 0) rem.pop_back();
-      while (res.back() == 0) res.pop_back();
-    }
-
-    void digits_rem(const std::span<const digit> &a, const std::span<const digit> &b, std::vector<digit> &rem)
-    {
-      rem.clear();
-      if (digits_cmp(a, b) < 0)
+      
+      // ret = a * b mod n
+      // Requirements: a, b < n
+      void mul(const std::span<const digit> a, const std::span<const digit> b, digit_vector &ret) const
       {
-        rem.insert(rem.end(), a.begin(), a.end());
-        return;
+        digits_mul(a, b, ret);
+        reduce(ret);
       }
-      if (b.size() == 1)
+      
+      // ret = a * a mod n
+      void sqr(const std::span<const digit> a, digit_vector &ret) const
       {
-        helper::digits_rem_by1(a, b[0], rem);
-        return;
+        digits_sqr(a, ret);
+        reduce(ret);
       }
-      else
+    };
+    
+    // Exponentiation modulo a fixed n > 1, set up once and reused for every base and exponent.
+    // Odd moduli use Montgomery multiplication and even ones Barrett reduction.
+    class ModContext
+    {
+    private:
+      digit_vector n;
+      Montgomery montgomery;
+      Barrett barrett;
+    
+    public:
+      ModContext() = default;
+      
+      explicit ModContext(const std::span<const digit> m) : n(m.begin(), m.end())
       {
-        std::vector<digit> tmp;
-        digits_divrem(a, b, tmp, rem);
+        if (n[0] & 1)
+        {
+          montgomery = Montgomery(n);
+        }
+        else
+        {
+          barrett = Barrett(n);
+        }
       }
-      return;
-    }
+      
+      const digit_vector &modulus() const { return n; }
+      
+      // ret = a^e mod n
+      // Requirements: a < n
+      void pow(const std::span<const digit> a, const std::span<const digit> e, digit_vector &ret) const
+      {
+        ret.clear();
+        if (e.empty())
+        {
+          ret.emplace_back(1);
+          return;
+        }
+        if (n[0] & 1)
+        {
+          digit_vector am;
+          montgomery.to(a, am);
+          digit_vector rm;
+          power::sliding_window(am, e, rm,
+                                [this](auto &&x, auto &&y, auto &&r) { montgomery.mul(x, y, r); },
+                                [this](auto &&x, auto &&r) { montgomery.mul(x, x, r); });
+          montgomery.from(rm, ret);
+        }
+        else
+        {
+          power::sliding_window(a, e, ret,
+                                [this](auto &&x, auto &&y, auto &&r) { barrett.mul(x, y, r); },
+                                [this](auto &&x, auto &&r) { barrett.sqr(x, r); });
+        }
+      }
+    };
   
-    // just for tests, unfinished
-    void digits_gcd(const std::span<const digit> &a, const std::span<const digit> &b, std::vector<digit> &ret)
+    namespace helper
     {
-      //unfinished
-      if (b.empty())
+      // z = the two's complement of a in a.size() digits, with the ones above it left implicit
+      void digits_complement(const std::span<digit> z, const std::span<const digit> a)
       {
-        ret.insert(ret.end(), a.begin(), a.end());
-        return;
+        digit carry = 1;
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+          carry += a[i] ^ SYMXX_HUGE_LOW_MASK;
+          z[i] = carry & SYMXX_HUGE_LOW_MASK;
+          carry >>= SYMXX_HUGE_SHIFT;
+        }
       }
-      std::vector<digit> tmp;
-      digits_rem(a, b, tmp);
-      digits_gcd(b, tmp, ret);
-    }
-    
-    void digits_inverse_mod(const std::span<const digit> &a, const std::span<const digit> &n, std::vector<digit> &ret)
-    {
-      std::vector<digit> b{1};
-      std::vector<digit> c;
     }
     
-    void digits_pow
-    (const std::span<const digit> &a, const std::span<const digit> &b,
-     bool apositive, bool bpositive, std::vector<digit> &ret, bool& retpositive)
+    // ret = |a op b| for op in '&', '|' and '^', where negative operands behave like
+    // infinitely sign-extended two's complement, the same as CPython's long_bitwise.
+    // Returns true if the result is negative.
+    bool digits_bitwise(std::span<const digit> a, bool anegative, std::span<const digit> b, bool bnegative,
+                        char op, digit_vector &ret)
     {
-      ret.clear();
-      if (b.empty())//b==0
+      digit_vector ac;
+      digit_vector bc;
+      if (anegative)
       {
-        ret.emplace_back(1);
-        return;
+        ac.resize(a.size());
+        helper::digits_complement(ac, a);
+        a = ac;
       }
-      else if (a.empty())//a==0
+      if (bnegative)
       {
-        return;
+        bc.resize(b.size());
+        helper::digits_complement(bc, b);
+        b = bc;
       }
-      else if (b.size() == 1 && b[0] == 1)//b==1
+      if (a.size() < b.size())
       {
-        ret.insert(ret.end(), b.begin(), b.end());
-        return;
+        std::swap(a, b);
+        std::swap(anegative, bnegative);
       }
-      else if (a.size() == 1 && a[0] == 1)//a==1
+      // Above b, b is all zeros or all ones, which either keeps a's digits, flips them, or decides the result
+      bool negative = false;
+      size_t size = 0;
+      switch (op)
       {
-        ret.emplace_back(1);
-        return;
+        case '&':
+          negative = anegative && bnegative;
+          size = bnegative ? a.size() : b.size();
+          break;
+        case '|':
+          negative = anegative || bnegative;
+          size = bnegative ? b.size() : a.size();
+          break;
+        case '^':
+          negative = anegative != bnegative;
+          size = a.size();
+          break;
+        default:
+          symxx_unreachable();
       }
-      //unfinished
-    }
-  
-    void digits_bitwise(const std::span<const digit> &a, const std::span<const digit> &b,
-                        const std::function<digit(digit, digit)> &process)
-    {
-    
-    }
-  
-    //
-  
-  
-    template<typename U>
-    std::enable_if_t<std::is_integral_v<std::decay_t<U>>>
-    digits_from_int(const U &val, std::vector<digit> &digits)
-    {
-      for (U u = val > 0 ? val : static_cast<U>(0) - val;
-           u != 0; u >>= static_cast<U>(SYMXX_HUGE_SHIFT))
+      ret.assign(size + (negative ? 1 : 0), 0);
+      size_t i = 0;
+      for (; i < std::min(size, b.size()); ++i)
       {
-        digits.emplace_back(static_cast<digit>(u & SYMXX_HUGE_LOW_MASK));
+        ret[i] = op == '&' ? a[i] & b[i] : op == '|' ? a[i] | b[i] : a[i] ^ b[i];
       }
+      for (; i < size; ++i)
+      {
+        ret[i] = op == '^' && bnegative ? a[i] ^ SYMXX_HUGE_LOW_MASK : a[i];
+      }
+      if (negative)
+      {
+        ret.back() = SYMXX_HUGE_LOW_MASK;
+        helper::digits_complement(ret, ret);
+      }
+      helper::digits_normalize(ret);
+      return negative && !ret.empty();
     }
   
     struct IntTag {};
@@ -499,9 +2904,21 @@ namespace symxx
     friend std::ostream &operator<<(std::ostream &os, const Huge &i);
   
     friend std::tuple<Huge, Huge> divrem(const Huge &h1, const Huge &h2);
+    
+    friend void add(Huge &out, const Huge &a, const Huge &b);
+    
+    friend void sub(Huge &out, const Huge &a, const Huge &b);
+    
+    friend void mul(Huge &out, const Huge &a, const Huge &b);
+    
+    friend void divrem(Huge &q, Huge &r, const Huge &a, const Huge &b);
+    
+    friend std::tuple<Huge, Huge, Huge> gcdext(const Huge &a, const Huge &b);
+    
+    friend class HugeModulus;
 
   private:
-    std::vector<digit> digits;
+    huge_internal::SharedDigits digits;
     bool is_positive;
 
   public:
@@ -515,26 +2932,28 @@ namespace symxx
       {
         if constexpr(std::is_integral_v<Ut>)
         {
-          huge_internal::digits_from_int(std::forward<U>(val), digits);
+          huge_internal::digits_from_int(std::forward<U>(val), digits.mut());
         }
         else
         {
-          huge_internal::digits_from_int(static_cast<unsigned long long>(std::forward<U>(val)), digits);
+          huge_internal::digits_from_int(static_cast<unsigned long long>(std::forward<U>(val)), digits.mut());
         }
       }
       else
       {
         if constexpr(std::is_integral_v<Ut>)
         {
-          huge_internal::digits_from_int(std::abs(val), digits);
+          huge_internal::digits_from_int(std::abs(val), digits.mut());
         }
         else
         {
-          huge_internal::digits_from_int(static_cast<unsigned long long>(std::abs(val)), digits);
+          huge_internal::digits_from_int(static_cast<unsigned long long>(std::abs(val)), digits.mut());
         }
       }
     }
   
+    explicit operator bool() const { return !digits.empty(); }
+  
     explicit operator int() const { return to<int>(); }
   
     explicit operator unsigned int() const { return to<unsigned int>(); }
@@ -551,9 +2970,12 @@ namespace symxx
   
     explicit operator long double() const { return to<long double>(); }
   
-    explicit Huge(std::vector<digit> s, bool p = true) : digits(std::move(s)), is_positive(p) {}
+    // zero is always positive, so negating it cannot give -0
+    explicit Huge(huge_internal::digit_vector s, bool p = true) : digits(std::move(s)), is_positive(p || digits.empty()) {}
+    
+    explicit Huge(huge_internal::SharedDigits s, bool p = true) : digits(std::move(s)), is_positive(p || digits.empty()) {}
   
-    explicit Huge(std::initializer_list<digit> s, bool p = true) : digits(std::move(s)), is_positive(p) {}
+    explicit Huge(std::initializer_list<digit> s, bool p = true) : digits(std::move(s)), is_positive(p || digits.empty()) {}
   
     Huge(const std::string &s)
     {
@@ -562,168 +2984,133 @@ namespace symxx
       while (!(isdigit(s[pos]) || s[pos] == '+' || s[pos] == '-') && pos < end) ++pos;
       symxx_assert(pos < end,"Invaild string.");
       is_positive = true;
-      if (s[0] == '+')
+      if (s[pos] == '+')
       {
         pos++;
       }
-      if (s[0] == '-')
+      else if (s[pos] == '-')
       {
         is_positive = false;
         pos++;
       }
-      constexpr size_t convwidth = 9;
-      constexpr size_t convmultmax = 1000000000;
-      const double sz = static_cast<double>(s.size() - pos) * (SYMXX_HUGE_LOG2_10 / 25) + 1;
-      digits.reserve(static_cast<size_t>(sz));
-    
-      while (pos < end)
-      {
-        if (!isdigit(s[pos])) break;
-        twodigits c = s[pos++] - '0';
-        size_t i = 1;
-        for (; i < convwidth && pos < end; ++pos)
-        {
-          if (!isdigit(s[pos]))
-          {
-            end = pos;
-          }
-          else
-          {
-            c = static_cast<twodigits>(c * 10 + s[pos] - '0');
-            ++i;
-          }
-        }
-      
-        twodigits convmult = convmultmax;
-      
-        if (i != convwidth) // the end of string
-        {
-          convmult = 10;
-          for (; i > 1; --i)
-            convmult *= 10;
-        }
+      end = pos;
+      while (end < s.size() && isdigit(s[end])) ++end;
       
-        // put c to digits
-        for (auto &p: digits)
-        {
-          c += static_cast<twodigits>(p) * convmult;
-          p = static_cast<digit>(c & SYMXX_HUGE_LOW_MASK);
-          c >>= SYMXX_HUGE_SHIFT;
-        }
-        while (c != 0)
+      // split into base 10^9 digits from the right
+      constexpr size_t convwidth = SYMXX_HUGE_DECIMAL_SHIFT;
+      huge_internal::digit_vector dec;
+      dec.reserve((end - pos) / convwidth + 1);
+      for (size_t chunk_end = end; chunk_end > pos;)
+      {
+        size_t chunk_begin = chunk_end - std::min(convwidth, chunk_end - pos);
+        digit c = 0;
+        for (size_t i = chunk_begin; i < chunk_end; ++i)
         {
-          digits.emplace_back(static_cast<digit>(c & SYMXX_HUGE_LOW_MASK));
-          c >>= SYMXX_HUGE_SHIFT;
+          c = c * 10 + static_cast<digit>(s[i] - '0');
         }
+        dec.emplace_back(c);
+        chunk_end = chunk_begin;
       }
+      huge_internal::digits_from_decimal(dec, digits.mut());
     }
     
     Huge &operator+=(const Huge &h)
     {
-      std::vector<digit> tmp;
-      if ((h.is_positive && is_positive) || (!h.is_positive && !is_positive))
+      if (is_positive == h.is_positive)
       {
-        huge_internal::digits_add(digits, h.digits, tmp);
+        huge_internal::digits_add_inplace(digits.mut(), h.digits);
       }
-      else
+      else if (huge_internal::digits_sub_inplace(digits.mut(), h.digits))
       {
-        int cmp = huge_internal::digits_cmp(digits, h.digits);
-        if (cmp == 0)
-        {
-          digits.clear();
-          return *this;
-        }
-        else if (cmp < 0)
-        {
-          is_positive = !is_positive;
-          huge_internal::digits_sub(h.digits, digits, tmp);
-        }
-        else
-        {
-          huge_internal::digits_sub(digits, h.digits, tmp);
-        }
+        is_positive = !is_positive;
       }
-      std::swap(tmp, digits);
+      is_positive = is_positive || digits.empty();
       return *this;
     }
   
-    Huge operator+(const Huge &h) const
+    Huge operator+(const Huge &h) const &
     {
       auto i = *this;
       i += h;
       return i;
     }
   
+    Huge operator+(const Huge &h) &&
+    {
+      *this += h;
+      return std::move(*this);
+    }
+  
     Huge &operator-=(const Huge &h)
     {
-      std::vector<digit> tmp;
-      int cmp = huge_internal::digits_cmp(digits, h.digits);
-      if (cmp == 0)
-      {
-        digits.clear();
-        return *this;
-      }
-      if ((h.is_positive && !is_positive) || (!h.is_positive && is_positive))
+      if (is_positive != h.is_positive)
       {
-        huge_internal::digits_add(digits, h.digits, tmp);
+        huge_internal::digits_add_inplace(digits.mut(), h.digits);
       }
-      else
+      else if (huge_internal::digits_sub_inplace(digits.mut(), h.digits))
       {
-        if (cmp < 0)
-        {
-          is_positive = !is_positive;
-          huge_internal::digits_sub(h.digits, digits, tmp);
-        }
-        else
-        {
-          huge_internal::digits_sub(digits, h.digits, tmp);
-        }
+        is_positive = !is_positive;
       }
-      std::swap(tmp, digits);
+      is_positive = is_positive || digits.empty();
       return *this;
     }
   
-    Huge operator-(const Huge &h) const
+    Huge operator-(const Huge &h) const &
     {
       auto i = *this;
       i -= h;
       return i;
     }
+  
+    Huge operator-(const Huge &h) &&
+    {
+      *this -= h;
+      return std::move(*this);
+    }
     
     Huge &operator*=(const Huge &h)
     {
-      std::vector<digit> tmp;
-      is_positive = ((h.is_positive && is_positive) || (!h.is_positive && !is_positive));
-      huge_internal::digits_mul(digits, h.digits, tmp);
-      std::swap(tmp, digits);
+      mul(*this, *this, h);
       return *this;
     }
   
-    Huge operator*(const Huge &h) const
+    Huge operator*(const Huge &h) const &
     {
-      auto i = *this;
-      i *= h;
+      Huge i;
+      mul(i, *this, h);
       return i;
     }
+  
+    Huge operator*(const Huge &h) &&
+    {
+      *this *= h;
+      return std::move(*this);
+    }
     
     Huge &operator/=(const Huge &h)
     {
       symxx_assert(!h.digits.empty(), symxx_division_by_zero);
-      is_positive = ((h.is_positive && is_positive) || (!h.is_positive && !is_positive));
-      std::vector<digit> res;
-      std::vector<digit> rem;
-      huge_internal::digits_divrem(digits, h.digits, res, rem);
-      std::swap(res, digits);
+      bool positive = is_positive == h.is_positive;
+      auto &res = huge_internal::digits_scratch(0);
+      huge_internal::digits_divrem(digits, h.digits, res, huge_internal::digits_scratch(1));
+      digits.swap(res);
+      is_positive = positive || digits.empty();
       return *this;
     }
   
-    Huge operator/(const Huge &h) const
+    Huge operator/(const Huge &h) const &
     {
       auto i = *this;
       i /= h;
       return i;
     }
   
+    Huge operator/(const Huge &h) &&
+    {
+      *this /= h;
+      return std::move(*this);
+    }
+  
     Huge operator-() const
     {
       return Huge(digits, !is_positive);
@@ -758,44 +3145,279 @@ namespace symxx
     Huge &operator%=(const Huge &h)
     {
       symxx_assert(!h.digits.empty(), symxx_division_by_zero);
-      std::vector<digit> rem;
+      auto &rem = huge_internal::digits_scratch(0);
       huge_internal::digits_rem(digits, h.digits, rem);
-      std::swap(rem, digits);
+      digits.swap(rem);
+      is_positive = is_positive || digits.empty();
       return *this;
     }
   
-    Huge operator%(const Huge &h) const
+    Huge operator%(const Huge &h) const &
     {
       auto i = *this;
       i %= h;
       return i;
     }
   
-    //TODO not finished
-    [[nodiscard]] Huge gcd(const Huge &h) const
+    Huge operator%(const Huge &h) &&
     {
-      std::vector<digit> ret;
-      huge_internal::digits_gcd(digits, h.digits, ret);
-      return Huge(ret);
+      *this %= h;
+      return std::move(*this);
+    }
+    
+    Huge &operator<<=(long long n)
+    {
+      symxx_assert(n >= 0, "Negative shift count.");
+      auto &ret = huge_internal::digits_scratch(0);
+      huge_internal::digits_lshift(digits, static_cast<size_t>(n), ret);
+      digits.swap(ret);
+      return *this;
+    }
+    
+    Huge operator<<(long long n) const
+    {
+      Huge ret = *this;
+      ret <<= n;
+      return ret;
+    }
+    
+    // Rounds toward negative infinity like CPython, -1 >> n == -1
+    Huge &operator>>=(long long n)
+    {
+      symxx_assert(n >= 0, "Negative shift count.");
+      auto &ret = huge_internal::digits_scratch(0);
+      if (is_positive || digits.empty())
+      {
+        huge_internal::digits_rshift(digits, static_cast<size_t>(n), ret);
+        digits.swap(ret);
+        return *this;
+      }
+      // -a >> n == -(((a - 1) >> n) + 1)
+      digit one = 1;
+      huge_internal::digits_sub_inplace(digits.mut(), {&one, 1});
+      huge_internal::digits_rshift(digits, static_cast<size_t>(n), ret);
+      huge_internal::digits_add_inplace(ret, {&one, 1});
+      digits.swap(ret);
+      return *this;
+    }
+    
+    Huge operator>>(long long n) const
+    {
+      Huge ret = *this;
+      ret >>= n;
+      return ret;
+    }
+    
+    Huge &operator&=(const Huge &h)
+    {
+      auto &ret = huge_internal::digits_scratch(0);
+      is_positive = !huge_internal::digits_bitwise(digits, !is_positive, h.digits, !h.is_positive, '&', ret);
+      digits.swap(ret);
+      return *this;
+    }
+    
+    Huge operator&(const Huge &h) const
+    {
+      Huge ret;
+      ret.is_positive = !huge_internal::digits_bitwise(digits, !is_positive, h.digits, !h.is_positive, '&', ret.digits.mut());
+      return ret;
+    }
+    
+    Huge &operator|=(const Huge &h)
+    {
+      auto &ret = huge_internal::digits_scratch(0);
+      is_positive = !huge_internal::digits_bitwise(digits, !is_positive, h.digits, !h.is_positive, '|', ret);
+      digits.swap(ret);
+      return *this;
+    }
+    
+    Huge operator|(const Huge &h) const
+    {
+      Huge ret;
+      ret.is_positive = !huge_internal::digits_bitwise(digits, !is_positive, h.digits, !h.is_positive, '|', ret.digits.mut());
+      return ret;
+    }
+    
+    Huge &operator^=(const Huge &h)
+    {
+      auto &ret = huge_internal::digits_scratch(0);
+      is_positive = !huge_internal::digits_bitwise(digits, !is_positive, h.digits, !h.is_positive, '^', ret);
+      digits.swap(ret);
+      return *this;
+    }
+    
+    Huge operator^(const Huge &h) const
+    {
+      Huge ret;
+      ret.is_positive = !huge_internal::digits_bitwise(digits, !is_positive, h.digits, !h.is_positive, '^', ret.digits.mut());
+      return ret;
+    }
+    
+    // ~x == -x - 1
+    Huge operator~() const
+    {
+      Huge ret = *this;
+      ret.is_positive = !ret.is_positive;
+      ret -= 1;
+      return ret;
+    }
+    
+    // floor(sqrt(this)), with CPython's math.isqrt, which doubles the number of correct bits each step
+    [[nodiscard]] Huge isqrt() const
+    {
+      symxx_assert(is_positive || digits.empty(), "Square root of a negative number.");
+      if (digits.empty()) return 0;
+      size_t c = (bit_width() - 1) / 2;
+      Huge a = 1;
+      size_t d = 0;
+      for (int s = std::bit_width(c) - 1; s >= 0; --s)
+      {
+        size_t e = d;
+        d = c >> s;
+        a = (a << static_cast<long long>(d - e - 1)) + (*this >> static_cast<long long>(2 * c - e - d + 1)) / a;
+      }
+      return a.square() > *this ? a - 1 : a;
+    }
+    
+    // The integer part of the n-th root, rounded toward zero for negative values and odd n
+    [[nodiscard]] Huge iroot(unsigned long long n) const
+    {
+      symxx_assert(n >= 1, "The zeroth root is undefined.");
+      symxx_assert(is_positive || n % 2 == 1 || digits.empty(), "Even root of a negative number.");
+      if (n == 1 || digits.empty()) return *this;
+      if (n == 2) return isqrt();
+      size_t bits = bit_width();
+      if (n >= bits) return is_positive ? 1 : -1;
+      Huge a = abs();
+      Huge x;
+      if (bits <= 128 || bits < 2 * n)
+      {
+        // a double estimate from the top bits, raised above the root
+        size_t shift = bits > 64 ? (bits - 64 + n - 1) / n * n : 0;
+        double top = static_cast<double>(a >> static_cast<long long>(shift));
+        x = Huge(std::pow(top, 1.0 / static_cast<double>(n)) * (1 + 1e-9) + 1) << static_cast<long long>(shift / n);
+      }
+      else
+      {
+        // the root of the top half of the bits is also above the root, and about half as precise
+        size_t m = bits / (2 * n);
+        x = ((a >> static_cast<long long>(n * m)).iroot(n) + 1) << static_cast<long long>(m);
+      }
+      // from above, Newton's iteration decreases until it reaches the root
+      while (true)
+      {
+        Huge y = (x * (n - 1) + a / x.pow(n - 1)) / n;
+        if (y >= x) break;
+        x = std::move(y);
+      }
+      return is_positive ? x : -x;
+    }
+    
+    // Whether this == b^k for some integers b and k >= 2. 0, 1 and -1 are.
+    [[nodiscard]] bool is_perfect_power() const
+    {
+      if (digits.empty() || (digits.size() == 1 && digits[0] == 1)) return true;
+      size_t bits = bit_width();
+      size_t tz = trailing_zeros();
+      auto is_small_prime = [](size_t k)
+      {
+        for (size_t i = 2; i * i <= k; ++i)
+        {
+          if (k % i == 0) return false;
+        }
+        return true;
+      };
+      // only prime k need checking, and k must divide the exponent of 2, if there is one
+      for (size_t k = is_positive ? 2 : 3; k < bits; ++k)
+      {
+        if (!is_small_prime(k) || (tz != 0 && tz % k != 0)) continue;
+        if (iroot(k).pow(k) == *this) return true;
+      }
+      return false;
+    }
+    
+    // The number of bits of |this|, 0 for 0
+    [[nodiscard]] size_t bit_width() const
+    {
+      if (digits.empty()) return 0;
+      return (digits.size() - 1) * SYMXX_HUGE_SHIFT + std::bit_width(digits.back());
+    }
+    
+    // The number of trailing zero bits of |this|, 0 for 0
+    [[nodiscard]] size_t trailing_zeros() const
+    {
+      size_t i = 0;
+      while (i < digits.size() && digits[i] == 0)
+      {
+        ++i;
+      }
+      if (i == digits.size()) return 0;
+      return i * SYMXX_HUGE_SHIFT + std::countr_zero(digits[i]);
+    }
+    
+    // Equal values hash equally; the digits are read in place
+    [[nodiscard]] size_t hash() const
+    {
+      size_t h = digits.empty() || is_positive ? 0 : 1;
+      for (auto d: digits)
+      {
+        h ^= static_cast<size_t>(d) + 0x9e3779b97f4a7c15ULL + (h << 6) + (h >> 2);
+      }
+      return h;
     }
   
-    [[nodiscard]] Huge pow(const double &h) const
+    [[nodiscard]] Huge square() const
+    {
+      huge_internal::digit_vector ret;
+      huge_internal::digits_sqr(digits, ret);
+      return Huge(std::move(ret));
+    }
+  
+    // Always non-negative, gcd(0, 0) is 0
+    [[nodiscard]] Huge gcd(const Huge &h) const
     {
-      std::vector<digit> ret;
-      //huge_internal::digits_pow(digits, h, ret, is_positive, (h >= 0));
-      return Huge(ret);
+      huge_internal::digit_vector ret;
+      huge_internal::digits_gcd(digits, h.digits, ret);
+      return Huge(std::move(ret));
     }
+  
+    // Exact. The exponent must be a non-negative integer, unless the base is 1 or -1.
     [[nodiscard]] Huge pow(const Huge &h) const
     {
-      std::vector<digit> ret;
-      //huge_internal::digits_pow(digits, h.digits,ret, is_positive, (h >= 0));
-      return Huge(ret);
+      bool odd = !h.digits.empty() && (h.digits[0] & 1) != 0;
+      bool positive = is_positive || !odd;
+      if (digits.size() == 1 && digits[0] == 1)
+      {
+        return Huge(positive ? 1 : -1);
+      }
+      symxx_assert(h.is_positive || h.digits.empty(), "Huge::pow() needs a non-negative exponent.");
+      if (digits.empty())
+      {
+        return h.digits.empty() ? Huge(1) : Huge();
+      }
+      huge_internal::digit_vector ret;
+      huge_internal::digits_pow(digits, h.to<unsigned long long>(), ret);
+      return Huge(std::move(ret), positive);
     }
     
-    Huge inverse() const
+    // this^exp mod mod, in [0, mod). A negative exponent takes the modular inverse first.
+    // The last modulus is kept per thread, so repeated calls with the same modulus only set it up once.
+    [[nodiscard]] Huge modpow(const Huge &exp, const Huge &mod) const;
+    
+    template<typename U, typename = std::enable_if_t<std::is_integral_v<std::decay_t<U>>>>
+    [[nodiscard]] Huge pow(U h) const
     {
+      return pow(Huge(h));
+    }
     
+    [[nodiscard]] Huge pow(const double &h) const
+    {
+      symxx_assert(std::trunc(h) == h, "Huge::pow() needs an integral exponent.");
+      return pow(Huge(h));
     }
+    
+    // The x in [0, |mod|) with this * x = 1 (mod mod), from gcdext
+    [[nodiscard]] Huge inverse(const Huge &mod) const;
     //
     [[nodiscard]] Huge abs() const
     {
@@ -837,22 +3459,8 @@ namespace symxx
   
     [[nodiscard]] std::string to_string() const
     {
-      std::vector<digit> out;
-      for (auto rit = digits.crbegin(); rit < digits.crend(); ++rit)
-      {
-        auto hi = *rit;
-        for (auto &j: out)
-        {
-          twodigits z = static_cast<twodigits>(j) << SYMXX_HUGE_SHIFT | hi;
-          hi = static_cast<digit>(z / SYMXX_HUGE_DECIMAL_BASE);
-          j = static_cast<digit>(z - static_cast<twodigits>(hi) * SYMXX_HUGE_DECIMAL_BASE);
-        }
-        while (hi != 0)
-        {
-          out.emplace_back(hi % SYMXX_HUGE_DECIMAL_BASE);
-          hi /= SYMXX_HUGE_DECIMAL_BASE;
-        }
-      }
+      huge_internal::digit_vector out;
+      huge_internal::digits_to_decimal(digits, out);
     
       if (out.empty()) // *this == 0
         out.emplace_back(0);
@@ -898,6 +3506,23 @@ namespace symxx
     {
       return internal_to<U>(typename huge_internal::TagDispatch<std::decay_t<U>>::tag{});
     }
+    // Like std::frexp: returns m with 0.5 <= |m| < 1 and sets exp so that m * 2^exp is *this
+    // correctly rounded to U, also beyond U's range. Returns 0 and sets exp to 0 for 0.
+    template<typename U = double>
+    [[nodiscard]] std::enable_if_t<std::is_floating_point_v<U>, U> frexp(long long &exp) const
+    {
+      if (digits.empty())
+      {
+        exp = 0;
+        return 0;
+      }
+      auto [mant, e] = round_top(std::numeric_limits<U>::digits);
+      int w = std::bit_width(mant);
+      exp = e + w;
+      U m = std::ldexp(static_cast<U>(mant), -w);
+      return is_positive ? m : -m;
+    }
+    
     template<typename U>
     [[nodiscard]] std::enable_if_t<std::is_arithmetic_v<std::decay_t<U>>, std::unique_ptr<U>>
     try_to() const
@@ -911,7 +3536,7 @@ namespace symxx
       {
         return nullptr;
       }
-      return x;
+      return std::make_unique<U>(x);
     }
   private:
     template<typename U>
@@ -934,9 +3559,13 @@ namespace symxx
         for (auto rit = digits.crbegin(); rit < digits.crend(); ++rit)
         {
           result |= static_cast<twodigits>(*rit);
-          if (rit < digits.crend() - 1)
+          // the assertion above leaves a single digit for types narrower than one
+          if constexpr (sizeof(U) * 8 > SYMXX_HUGE_SHIFT)
           {
-            result <<= SYMXX_HUGE_SHIFT;
+            if (rit < digits.crend() - 1)
+            {
+              result <<= SYMXX_HUGE_SHIFT;
+            }
           }
         }
         return result * static_cast<U>(static_cast<int>((is_positive ? 1 : -1)));
@@ -947,29 +3576,284 @@ namespace symxx
     template<typename U>
     [[nodiscard]] U internal_to(huge_internal::FloatingTag) const
     {
-      auto tmp = abs().to<unsigned long long>();
-      symxx_assert(tmp <= std::numeric_limits<U>::max(),
-      "The Huge is too big.[" + to_string() + "].");
-      return static_cast<U>(tmp) * (is_positive ? 1 : -1);
+      long long exp;
+      U m = frexp<U>(exp);
+      symxx_assert(exp <= std::numeric_limits<U>::max_exponent, "The Huge is too big.");
+      return std::ldexp(m, static_cast<int>(exp));
+    }
+    
+    // |this| != 0 rounded to nearest, ties to even, at `bits` <= 64 bits, as mant * 2^exp.
+    // Reads the top 128 bits; the digits below them only decide exact ties.
+    [[nodiscard]] std::pair<uint64_t, long long> round_top(int bits) const
+    {
+      using u128 = unsigned __int128;
+      size_t n = bit_width();
+      size_t shift = n > 128 ? n - 128 : 0;
+      size_t lo = shift / SYMXX_HUGE_SHIFT;
+      u128 top = 0;
+      for (size_t j = digits.size(); j-- > lo;)
+      {
+        size_t at = j * SYMXX_HUGE_SHIFT;
+        auto d = static_cast<u128>(digits[j]);
+        top |= at >= shift ? d << (at - shift) : d >> (shift - at);
+      }
+      auto m = static_cast<int>(std::min<size_t>(n, 128));
+      if (m <= bits)
+      {
+        return {static_cast<uint64_t>(top), static_cast<long long>(shift)};
+      }
+      int drop = m - bits;
+      auto mant = static_cast<uint64_t>(top >> drop);
+      u128 rem = top & ((static_cast<u128>(1) << drop) - 1);
+      u128 half = static_cast<u128>(1) << (drop - 1);
+      auto below = [&]
+      {
+        size_t low_bits = shift - lo * SYMXX_HUGE_SHIFT;
+        if (low_bits != 0 && (digits[lo] & ((static_cast<digit>(1) << low_bits) - 1)) != 0) return true;
+        return std::any_of(digits.begin(), digits.begin() + static_cast<std::ptrdiff_t>(lo),
+                           [](digit d) { return d != 0; });
+      };
+      if (rem > half || (rem == half && ((mant & 1) != 0 || below())))
+      {
+        if (static_cast<int>(std::bit_width(mant + 1)) > bits || mant + 1 == 0)
+        {
+          // all ones rounds up to the next power of two
+          mant = static_cast<uint64_t>(1) << (bits - 1);
+          ++drop;
+        }
+        else
+        {
+          ++mant;
+        }
+      }
+      return {mant, static_cast<long long>(shift) + drop};
+    }
+  };
+  
+  // A modulus prepared once for many modular exponentiations, such as the witnesses of a primality test
+  class HugeModulus
+  {
+  private:
+    Huge n;
+    huge_internal::ModContext context;
+  
+  public:
+    explicit HugeModulus(const Huge &m) : n(m.abs())
+    {
+      symxx_assert(!n.digits.empty(), symxx_division_by_zero);
+      if (n != 1)
+      {
+        context = huge_internal::ModContext(n.digits);
+      }
+    }
+    
+    const Huge &get_modulus() const { return n; }
+    
+    // base mod n in [0, n)
+    [[nodiscard]] Huge reduce(const Huge &base) const
+    {
+      Huge r = base % n;
+      if (!r.is_positive)
+      {
+        r += n;
+      }
+      return r;
+    }
+    
+    [[nodiscard]] Huge pow(const Huge &base, const Huge &exp) const
+    {
+      if (n == 1)
+      {
+        return 0;
+      }
+      Huge b = reduce(base);
+      if (!exp.is_positive)
+      {
+        b = b.inverse(n);
+      }
+      huge_internal::digit_vector ret;
+      context.pow(b.digits, exp.digits, ret);
+      return Huge(std::move(ret));
     }
   };
   
+  Huge Huge::modpow(const Huge &exp, const Huge &mod) const
+  {
+    thread_local std::optional<HugeModulus> last;
+    if (!last || huge_internal::digits_cmp(last->get_modulus().digits, mod.digits) != 0)
+    {
+      huge_internal::ResourceScope global{nullptr};
+      last.emplace(mod);
+    }
+    return last->pow(*this, exp);
+  }
+  
   std::ostream &operator<<(std::ostream &os, const Huge &i)
   {
     os << i.to_string();
     return os;
   }
   
+  // out = a + b, reusing out's storage. out may be a or b.
+  void add(Huge &out, const Huge &a, const Huge &b)
+  {
+    if (&out == &b)
+    {
+      out += a;
+      return;
+    }
+    if (&out != &a)
+    {
+      out = a;
+    }
+    out += b;
+  }
+  
+  // out = a - b, reusing out's storage. out may be a or b.
+  void sub(Huge &out, const Huge &a, const Huge &b)
+  {
+    if (&a == &b)
+    {
+      out.digits.clear();
+      out.is_positive = true;
+      return;
+    }
+    if (&out == &b)
+    {
+      // a - b == -b + a
+      out.is_positive = !out.is_positive || out.digits.empty();
+      out += a;
+      return;
+    }
+    if (&out != &a)
+    {
+      out = a;
+    }
+    out -= b;
+  }
+  
+  // out = a * b, reusing out's storage. out may be a or b.
+  void mul(Huge &out, const Huge &a, const Huge &b)
+  {
+    bool positive = a.is_positive == b.is_positive;
+    if (&out == &a || &out == &b)
+    {
+      auto &ret = huge_internal::digits_scratch(0);
+      huge_internal::digits_mul(a.digits, b.digits, ret);
+      out.digits.swap(ret);
+    }
+    else
+    {
+      huge_internal::digits_mul(a.digits, b.digits, out.digits.mut());
+    }
+    out.is_positive = positive || out.digits.empty();
+  }
+  
+  // q = a / b rounded toward zero and r = a - q * b, the same as the built-in / and %.
+  // q and r reuse their storage and may be a or b.
+  void divrem(Huge &q, Huge &r, const Huge &a, const Huge &b)
+  {
+    symxx_assert(!b.digits.empty(), symxx_division_by_zero);
+    symxx_assert(&q != &r, "The quotient and the remainder must be different objects.");
+    bool qpositive = a.is_positive == b.is_positive;
+    bool rpositive = a.is_positive;
+    auto &res = huge_internal::digits_scratch(0);
+    auto &rem = huge_internal::digits_scratch(1);
+    huge_internal::digits_divrem(a.digits, b.digits, res, rem);
+    q.digits.swap(res);
+    r.digits.swap(rem);
+    q.is_positive = qpositive || q.digits.empty();
+    r.is_positive = rpositive || r.digits.empty();
+  }
+  
   std::tuple<Huge, Huge> divrem(const Huge &h1, const Huge &h2)
   {
-    symxx_assert(!h2.digits.empty(), symxx_division_by_zero);
-    bool is_positive;
-    is_positive = ((h1.is_positive && h2.is_positive) || (!h1.is_positive && !h2.is_positive));
-    std::vector<digit> res;
-    std::vector<digit> rem;
-    huge_internal::digits_divrem(h1.digits, h2.digits, res, rem);
-    return {Huge{res, is_positive}, Huge{rem}};
+    Huge q;
+    Huge r;
+    divrem(q, r, h1, h2);
+    return {std::move(q), std::move(r)};
+  }
+  
+  // {g, s, t} with g = gcd(a, b) = s * a + t * b. Like the extended Euclidean algorithm,
+  // |s| <= |b| / (2 * g) and |t| <= |a| / (2 * g) unless one of a and b divides the other.
+  std::tuple<Huge, Huge, Huge> gcdext(const Huge &a, const Huge &b)
+  {
+    using namespace huge_internal;
+    bool swap = digits_cmp(a.digits, b.digits) < 0;
+    const Huge &x = swap ? b : a;
+    const Huge &y = swap ? a : b;
+    if (y.digits.empty())
+    {
+      if (x.digits.empty())
+      {
+        return {Huge(0), Huge(0), Huge(0)};
+      }
+      Huge g = x.abs();
+      Huge s(x.is_positive ? 1 : -1);
+      return swap ? std::tuple{g, Huge(0), s} : std::tuple{g, s, Huge(0)};
+    }
+    // u = su * |x| + ... and v = sv * |x| + ...
+    digit_vector u{x.digits.get()};
+    digit_vector v{y.digits.get()};
+    digit_vector c;
+    digit_vector d;
+    Huge su(1);
+    Huge sv(0);
+    Huge q;
+    Huge tmp;
+    lehmer::Matrix m{};
+    while (!v.empty())
+    {
+      if (u.size() > 2 && lehmer::step(u, v, c, d, m))
+      {
+        // su, sv = A * su - B * sv, D * sv - C * su
+        mul(tmp, Huge(m.A), su);
+        mul(q, Huge(m.B), sv);
+        tmp -= q;
+        mul(q, Huge(m.D), sv);
+        sv = std::move(q);
+        mul(q, Huge(m.C), su);
+        sv -= q;
+        su = std::move(tmp);
+        continue;
+      }
+      digits_divrem(u, v, q.digits.mut(), c);
+      q.is_positive = true;
+      std::swap(u, v);
+      std::swap(v, c);
+      // su, sv = sv, su - q * sv
+      mul(q, q, sv);
+      su -= q;
+      std::swap(su, sv);
+    }
+    Huge g(std::move(u));
+    // t = (g - s * |x|) / |y|
+    Huge t = (g - su * x.abs()) / y.abs();
+    if (!x.is_positive) su = -su;
+    if (!y.is_positive) t = -t;
+    return swap ? std::tuple{std::move(g), std::move(t), std::move(su)}
+                : std::tuple{std::move(g), std::move(su), std::move(t)};
+  }
+  
+  Huge Huge::inverse(const Huge &mod) const
+  {
+    symxx_assert(!mod.digits.empty(), symxx_division_by_zero);
+    auto [g, s, t] = gcdext(*this, mod);
+    symxx_assert(g == 1, "The base is not invertible modulo the modulus.");
+    Huge m = mod.abs();
+    s %= m;
+    if (!s.is_positive)
+    {
+      s += m;
+    }
+    return s;
   }
 }
+
+template<>
+struct std::hash<symxx::Huge>
+{
+  size_t operator()(const symxx::Huge &h) const noexcept { return h.hash(); }
+};
+#endif
 #endif
-#endif
\ No newline at end of file
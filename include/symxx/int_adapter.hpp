@@ -25,6 +25,8 @@
 #include <string>
 #include <numeric>
 #include <type_traits>
+#include <bit>
+#include <algorithm>
 
 namespace symxx
 {
@@ -58,32 +60,178 @@ namespace symxx
     return std::pow(num, std::forward<U>(power));
   }
   
-  //adapted from:
+  namespace adapter_internal
+  {
+    template<typename T>
+    constexpr bool is_int128_v = std::is_same_v<T, __int128> || std::is_same_v<T, unsigned __int128>;
+    
+    // (hi:lo) / d, returning the quotient and setting rem
+    // Requirements: hi < d
+    inline uint64_t div_128_by_64(uint64_t hi, uint64_t lo, uint64_t d, uint64_t &rem)
+    {
+#if defined(__x86_64__)
+      uint64_t q;
+      __asm__("divq %4" : "=a"(q), "=d"(rem) : "a"(lo), "d"(hi), "rm"(d));
+      return q;
+#else
+      auto x = static_cast<unsigned __int128>(hi) << 64 | lo;
+      rem = static_cast<uint64_t>(x % d);
+      return static_cast<uint64_t>(x / d);
+#endif
+    }
+    
+    // a * b % m with one widening multiply and one division
+    inline uint64_t mulmod64(uint64_t a, uint64_t b, uint64_t m)
+    {
+      if (a >= m) a %= m;
+      if (b >= m) b %= m;
+      auto p = static_cast<unsigned __int128>(a) * b;
+      uint64_t rem;
+      // a, b < m, so the high half is below m too
+      div_128_by_64(static_cast<uint64_t>(p >> 64), static_cast<uint64_t>(p), m, rem);
+      return rem;
+    }
+    
+    // (x2:x) mod v for 64-bit x2 and 128-bit x, the step of Knuth's algorithm D with a two-limb divisor
+    // Requirements: the top bit of v is set and (x2:x) < v * 2^64
+    inline unsigned __int128 mod_192_by_128(uint64_t x2, unsigned __int128 x, unsigned __int128 v)
+    {
+      using u128 = unsigned __int128;
+      auto v1 = static_cast<uint64_t>(v >> 64);
+      auto v0 = static_cast<uint64_t>(v);
+      auto x1 = static_cast<uint64_t>(x >> 64);
+      auto x0 = static_cast<uint64_t>(x);
+      uint64_t q, r;
+      bool r_fits = true;
+      if (x2 >= v1)
+      {
+        // x2 == v1, the quotient estimate saturates
+        q = ~static_cast<uint64_t>(0);
+        u128 rr = (static_cast<u128>(x2) << 64 | x1) - static_cast<u128>(q) * v1;
+        r_fits = rr >> 64 == 0;
+        r = static_cast<uint64_t>(rr);
+      }
+      else
+      {
+        q = div_128_by_64(x2, x1, v1, r);
+      }
+      // at most two corrections make q exact or one too big
+      while (r_fits && static_cast<u128>(q) * v0 > (static_cast<u128>(r) << 64 | x0))
+      {
+        --q;
+        r_fits = r + v1 >= r;
+        r += v1;
+      }
+      u128 t0 = static_cast<u128>(q) * v0;
+      u128 t1 = static_cast<u128>(q) * v1 + (t0 >> 64);
+      u128 p = t1 << 64 | static_cast<uint64_t>(t0);
+      auto p2 = static_cast<uint64_t>(t1 >> 64);
+      // the remainder is x - p modulo 2^128, plus v if q was one too big and (x2:x) - (p2:p) went negative
+      u128 ret = x - p;
+      if (static_cast<u128>(x2) < static_cast<u128>(p2) + (x < p ? 1 : 0))
+      {
+        ret += v;
+      }
+      return ret;
+    }
+    
+    // a * b % m with a 256-bit schoolbook product
+    inline unsigned __int128 mulmod128(unsigned __int128 a, unsigned __int128 b, unsigned __int128 m)
+    {
+      using u128 = unsigned __int128;
+      if (a >= m) a %= m;
+      if (b >= m) b %= m;
+      if (m >> 64 == 0)
+      {
+        return mulmod64(static_cast<uint64_t>(a), static_cast<uint64_t>(b), static_cast<uint64_t>(m));
+      }
+      auto a1 = static_cast<uint64_t>(a >> 64), a0 = static_cast<uint64_t>(a);
+      auto b1 = static_cast<uint64_t>(b >> 64), b0 = static_cast<uint64_t>(b);
+      u128 ll = static_cast<u128>(a0) * b0;
+      u128 lh = static_cast<u128>(a0) * b1;
+      u128 hl = static_cast<u128>(a1) * b0;
+      u128 hh = static_cast<u128>(a1) * b1;
+      u128 mid = (ll >> 64) + static_cast<uint64_t>(lh) + static_cast<uint64_t>(hl);
+      u128 lo = mid << 64 | static_cast<uint64_t>(ll);
+      u128 hi = hh + (lh >> 64) + (hl >> 64) + (mid >> 64);
+      // normalize so that the divisor's top bit is set, then take two quotient limbs
+      int s = std::countl_zero(static_cast<uint64_t>(m >> 64));
+      u128 v = m << s;
+      u128 h = s == 0 ? hi : hi << s | lo >> (128 - s);
+      u128 l = lo << s;
+      // hi < m, so the top limb of the shifted product is below v's
+      u128 r = mod_192_by_128(static_cast<uint64_t>(h >> 64), h << 64 | static_cast<uint64_t>(l >> 64), v);
+      r = mod_192_by_128(static_cast<uint64_t>(r >> 64), r << 64 | static_cast<uint64_t>(l), v);
+      return r >> s;
+    }
+  }
+  
+  // a * b % m for a, b, m >= 0. Native integers take one widening multiply and one division,
+  // others fall back to shift and add, adapted from:
   //https://stackoverflow.com/questions/12168348/ways-to-do-modulo-multiplication-with-primitive-types
   template<typename T>
   T adapter_mulmod(T a, T b, T m)
   {
-    T res = 0;
-    while (a != 0)
+    if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(uint32_t))
     {
-      if (a & 1) res = (res + b) % m;
-      a >>= 1;
-      b = (b << 1) % m;
+      return static_cast<T>(static_cast<uint64_t>(a) * static_cast<uint64_t>(b) % static_cast<uint64_t>(m));
+    }
+    else if constexpr (std::is_integral_v<T> && sizeof(T) <= sizeof(uint64_t))
+    {
+      return static_cast<T>(adapter_internal::mulmod64(static_cast<uint64_t>(a), static_cast<uint64_t>(b),
+                                                       static_cast<uint64_t>(m)));
+    }
+    else if constexpr (adapter_internal::is_int128_v<T>)
+    {
+      using u128 = unsigned __int128;
+      return static_cast<T>(adapter_internal::mulmod128(static_cast<u128>(a), static_cast<u128>(b),
+                                                        static_cast<u128>(m)));
+    }
+    else
+    {
+      T res = 0;
+      while (a != 0)
+      {
+        if (a & 1) res = (res + b) % m;
+        a >>= 1;
+        b = (b << 1) % m;
+      }
+      return res;
     }
-    return res;
+  }
+  
+  // num / den in U
+  template<typename U, typename T>
+  inline U adapter_ratio(const T &num, const T &den)
+  {
+    return static_cast<U>(num) / static_cast<U>(den);
+  }
+  
+  template<typename T>
+  inline T adapter_square(const T &num)
+  {
+    return num * num;
+  }
+  
+  // a * a % m
+  template<typename T>
+  inline T adapter_sqrmod(const T &a, const T &m)
+  {
+    return adapter_mulmod<T>(a, a, m);
   }
   
   //adapted from:
   //https://stackoverflow.com/questions/8496182/calculating-powa-b-mod-n/8498251#8498251
+  // The products go through adapter_mulmod, so they do not overflow T
   template<typename T>
   T adapter_modpow(T base, T exp, T modulus)
   {
     base %= modulus;
-    T result = 1;
+    T result = 1 % modulus;
     while (exp > 0)
     {
-      if (exp & 1) result = (result * base) % modulus;
-      base = (base * base) % modulus;
+      if (exp & 1) result = adapter_mulmod<T>(result, base, modulus);
+      base = adapter_mulmod<T>(base, base, modulus);
       exp >>= 1;
     }
     return result;
@@ -113,6 +261,27 @@ namespace symxx
     return std::log(a);
   }
   
+  // floor(a^(1/n)) for a >= 0 and n >= 1, exact
+  template<typename T, typename U>
+  inline T adapter_iroot(const T &a, const U &n)
+  {
+    if (n == 1 || a < 2) return a;
+    // x^n <= a, by repeated division so that it cannot overflow
+    auto fits = [&a, &n](const T &x)
+    {
+      T rem = a;
+      for (U i = 0; i < n && rem != 0; ++i)
+      {
+        rem /= x;
+      }
+      return rem != 0;
+    };
+    auto r = static_cast<T>(std::pow(static_cast<long double>(a), 1.0L / static_cast<long double>(n)));
+    while (r > 1 && !fits(r)) --r;
+    while (fits(r + 1)) ++r;
+    return r;
+  }
+  
   template<typename T>
   class adapter_make_unsigned
   {
@@ -122,6 +291,14 @@ namespace symxx
   
   template<typename T>
   using Make_unsigned_t = typename adapter_make_unsigned<T>::type;
+  
+  // The number of trailing zero bits, 0 for 0
+  template<typename T>
+  inline size_t adapter_trailing_zeros(const T &num)
+  {
+    if (num == 0) return 0;
+    return static_cast<size_t>(std::countr_zero(static_cast<Make_unsigned_t<T>>(num)));
+  }
 #if defined(SYMXX_ENABLE_HUGE)
   template<>
   inline Huge adapter_to_int(const std::string &num)
@@ -144,12 +321,72 @@ namespace symxx
   {
     return a.gcd(std::forward<U>(b));
   }
+  template<typename U>
+  inline auto adapter_lcm(const symxx::Huge &a, U &&b)
+  {
+    if (a == 0 || b == 0) return Huge(0);
+    return (a / a.gcd(b) * b).abs();
+  }
   inline auto adapter_div(const symxx::Huge &num, const symxx::Huge &d)
   {
     return divrem(num, d);
   }
   template<>
-  inline Huge adapter_abs(const Huge &num)
+  inline Huge adapter_square(const Huge &num)
+  {
+    return num.square();
+  }
+  template<>
+  inline Huge adapter_sqrmod(const Huge &a, const Huge &m)
+  {
+    return a.square() % m;
+  }
+  template<>
+  inline auto adapter_sqrt(const Huge &a)
+  {
+    return a.isqrt();
+  }
+  template<>
+  inline auto adapter_log(const Huge &a)
+  {
+    // the top 64 bits are all a double can hold anyway
+    auto bits = static_cast<long long>(a.bit_width());
+    auto shift = std::max(bits - 64, 0LL);
+    return std::log(static_cast<double>(a >> shift)) + static_cast<double>(shift) * std::log(2.0);
+  }
+  template<typename U>
+  inline Huge adapter_iroot(const Huge &a, const U &n)
+  {
+    return a.iroot(static_cast<unsigned long long>(n));
+  }
+  template<>
+  inline size_t adapter_trailing_zeros(const Huge &num)
+  {
+    return num.trailing_zeros();
+  }
+  template<>
+  inline Huge adapter_mulmod(Huge a, Huge b, Huge m)
+  {
+    return a * b % m;
+  }
+  template<>
+  inline Huge adapter_modpow(Huge base, Huge exp, Huge modulus)
+  {
+    return base.modpow(exp, modulus);
+  }
+  // num and den may be beyond U's range as long as the quotient is not
+  template<typename U>
+  inline U adapter_ratio(const Huge &num, const Huge &den)
+  {
+    long long ne, de;
+    U n = num.frexp<U>(ne);
+    U d = den.frexp<U>(de);
+    U ret = std::ldexp(n / d, static_cast<int>(std::clamp(ne - de, -(1LL << 20), 1LL << 20)));
+    symxx_assert(!std::isinf(ret) || d == 0, "The value is too big.");
+    return ret;
+  }
+  template<>
+  inline auto adapter_abs(const Huge &num)
   {
     return num.abs();
   }
@@ -187,6 +424,7 @@ namespace symxx
   template<>
   inline std::string adapter_to_string(const __int128_t &num)
   {
+    if (num == 0) return "0";
     std::string ret;
     auto sz = static_cast<size_t>(static_cast<double>(adapter_bit_width(num)) / SYMXX_INT_ADAPTER_LOG2_10) + 1;
     if (num < 0) sz++;
@@ -204,6 +442,7 @@ namespace symxx
   template<>
   inline std::string adapter_to_string(const Make_unsigned_t<__int128_t> &num)
   {
+    if (num == 0) return "0";
     std::string ret;
     auto sz = static_cast<size_t>(static_cast<double>(adapter_bit_width(num)) / SYMXX_INT_ADAPTER_LOG2_10) + 1;
     ret.resize(sz);
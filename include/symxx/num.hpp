@@ -220,9 +220,19 @@ namespace symxx
     {
       if (p == 0) return 1;
       if (p == 1) return *this;
+      // the denominator is not always positive, and Huge has no <=> for p < 0
+      if ((p.get_numerator() < 0) != (p.get_denominator() < 0)) return inverse().pow(p.negate());
       Rational<T> res;
-      res.numerator = static_cast<T>(adapter_pow(numerator, p.template to<double>()));
-      res.denominator = static_cast<T>(adapter_pow(denominator, p.template to<double>()));
+      if (p.is_int())
+      {
+        res.numerator = static_cast<T>(adapter_pow(numerator, p.get_numerator()));
+        res.denominator = static_cast<T>(adapter_pow(denominator, p.get_numerator()));
+      }
+      else
+      {
+        res.numerator = static_cast<T>(adapter_pow(numerator, p.template to<double>()));
+        res.denominator = static_cast<T>(adapter_pow(denominator, p.template to<double>()));
+      }
       res.normalize();
       return res;
     }
@@ -274,7 +284,7 @@ namespace symxx
     template<typename U>
     U to() const
     {
-      return static_cast<U>(numerator) / static_cast<U>(denominator);
+      return adapter_ratio<U>(numerator, denominator);
     }
   
     template<typename U>
@@ -282,7 +292,7 @@ namespace symxx
     {
       try
       {
-        return std::make_unique<U>(static_cast<U>(numerator) / static_cast<U>(denominator));
+        return std::make_unique<U>(adapter_ratio<U>(numerator, denominator));
       }
       catch (...)
       {
@@ -345,12 +355,12 @@ namespace symxx
     };
     
     template<typename T>
-    std::map<std::make_unsigned_t<T>, std::vector<T>> decompose_radicand(T num)
+    std::map<Make_unsigned_t<T>, std::vector<T>> decompose_radicand(T num)
     {
-      std::map<std::make_unsigned_t<T>, std::vector<T>> ret;
+      std::map<Make_unsigned_t<T>, std::vector<T>> ret;
       std::multiset<T> factors;
       factorize(num, factors);
-      std::make_unsigned_t<T> exp = 1;
+      Make_unsigned_t<T> exp = 1;
       for (auto it = factors.cbegin(); it != factors.cend(); ++it)
       {
         auto nit = std::next(it);
@@ -542,8 +552,28 @@ namespace symxx
         coe /= radicand.get_denominator();
         radicand *= adapter_pow(radicand.get_denominator(), index);
       }
-      //factor
+      // Perfect powers are taken out exactly first, factorization may not finish for large ones
       T rad = radicand.get_numerator();
+      for (IndexT k = 2; k <= index && rad > 1; ++k)
+      {
+        while (index % k == 0 && rad > 1)
+        {
+          T root = adapter_iroot(rad, k);
+          if (!factorize_internal::is_power(rad, root, k)) break;
+          if (k == index)
+          {
+            coe *= root;
+            rad = 1;
+          }
+          else
+          {
+            rad = root;
+            index /= k;
+          }
+        }
+      }
+      radicand.get_numerator() = rad;
+      //factor
       auto factors = num_internal::decompose_radicand(rad);
       for (auto &r: factors)
       {
@@ -564,7 +594,7 @@ namespace symxx
         radicand.get_numerator() = rad;
         factors = num_internal::decompose_radicand(rad);
       }
-      T g_exp = factors.begin()->first;
+      T g_exp = factors.empty() ? T(1) : T(factors.begin()->first);
       for (auto &r: factors)
       {
         g_exp = adapter_gcd(r.first, g_exp);
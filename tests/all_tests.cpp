@@ -15,6 +15,7 @@
 
 constexpr std::string_view SYMXX_VERSION = "0.0.1";
 #define SYMXX_ENABLE_INT128
+#define SYMXX_ENABLE_HUGE
 
 #include "unittest.hpp"
 #include "huge_test.cpp"
@@ -0,0 +1,84 @@
+//   Copyright 2022-2023 symxx - caozhanhao
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+#ifndef SYMXX_BENCHMARK_HPP
+#define SYMXX_BENCHMARK_HPP
+
+#include "unittest.hpp"
+#include <cstdio>
+
+#define SYMXX_BENCH(name) \
+void symxx_bench_##name(); \
+int symxx_bench_pos_##name = ::symxx::test::get_bench().add(SYMXX_STRINGFY(name), symxx_bench_##name); \
+void symxx_bench_##name()
+
+namespace symxx::test
+{
+  class Bench
+  {
+  private:
+    std::vector<std::pair<std::string, std::function<void()>>> all_benches;
+  public:
+    template<typename T>
+    int add(const std::string &name, const T &func)
+    {
+      all_benches.emplace_back(std::make_pair(name, func));
+      return all_benches.size() - 1;
+    }
+    
+    // Runs the benchmarks whose name contains filter
+    void run(const std::string &filter = "")
+    {
+      for (auto &[name, func]: all_benches)
+      {
+        if (name.find(filter) == std::string::npos) continue;
+        std::cout << "[\033[0;32;32mBENCH\033[m] " << name << std::endl;
+        func();
+      }
+    }
+  };
+  
+  Bench &get_bench()
+  {
+    static Bench bench;
+    return bench;
+  }
+  
+  // Average microseconds per call
+  template<typename F>
+  double measure(F &&func, size_t reps = 1)
+  {
+    Timer timer;
+    timer.start();
+    for (size_t i = 0; i < reps; ++i)
+    {
+      func();
+    }
+    return static_cast<double>(timer.get_microseconds()) / static_cast<double>(reps);
+  }
+  
+  // Makes the compiler assume that value is read, so the work computing it is not optimized out
+  template<typename T>
+  void do_not_optimize(const T &value)
+  {
+    asm volatile("" : : "r"(&value) : "memory");
+  }
+  
+  // Enough repetitions to spend about 0.2s on an O(n^e) workload
+  size_t bench_reps(size_t n, double e = 1)
+  {
+    double cost = std::pow(static_cast<double>(n), e);
+    return static_cast<size_t>(std::clamp(2e7 / cost, 1.0, 10000.0));
+  }
+}
+#endif
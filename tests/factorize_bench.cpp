@@ -0,0 +1,175 @@
+//   Copyright 2022-2023 symxx - caozhanhao
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+#ifndef SYMXX_FACTORIZE_BENCH_CPP
+#define SYMXX_FACTORIZE_BENCH_CPP
+#if defined(SYMXX_ENABLE_INT128)
+#include "benchmark.hpp"
+
+namespace symxx::test
+{
+  // The bit by bit adapter_mulmod that native integers used before
+  template<typename T>
+  T shift_add_mulmod(T a, T b, T m)
+  {
+    T res = 0;
+    while (a != 0)
+    {
+      if (a & 1) res = (res + b) % m;
+      a >>= 1;
+      b = (b << 1) % m;
+    }
+    return res;
+  }
+
+  template<typename T>
+  double mulmod_ns(T m, bool widening)
+  {
+    std::mt19937_64 gen(1);
+    std::vector<T> xs;
+    for (int i = 0; i < 256; ++i)
+    {
+      auto x = static_cast<T>(static_cast<unsigned __int128>(gen()) << 64 | gen());
+      xs.emplace_back((x < 0 ? -x : x) % m);
+    }
+    T acc = 1;
+    double us = measure([&]
+                        {
+                          for (auto &x: xs)
+                          {
+                            acc = widening ? adapter_mulmod<T>(acc + 1, x, m) : shift_add_mulmod<T>(acc + 1, x, m);
+                          }
+                        }, 200);
+    do_not_optimize(acc);
+    return us * 1000 / static_cast<double>(xs.size());
+  }
+
+  SYMXX_BENCH(mulmod)
+  {
+    std::printf("%-24s %12s %12s  (ns per op)\n", "", "shift-add", "widening");
+    long long m64 = 649114847570543303;
+    __int128_t m128 = static_cast<__int128_t>(m64) * 1000000000000000003;
+    std::printf("%-24s %12.1f %12.1f\n", "int64_t, 60-bit m", mulmod_ns<long long>(m64, false),
+                mulmod_ns<long long>(m64, true));
+    std::printf("%-24s %12.1f %12.1f\n", "__int128_t, 60-bit m", mulmod_ns<__int128_t>(m64, false),
+                mulmod_ns<__int128_t>(m64, true));
+    std::printf("%-24s %12.1f %12.1f\n", "__int128_t, 119-bit m", mulmod_ns<__int128_t>(m128, false),
+                mulmod_ns<__int128_t>(m128, true));
+  }
+
+  // Pollard-Rho on 18-digit semiprimes with two 9-digit factors and on a 23-digit one,
+  // and Miller-Rabin on an 18-digit prime
+  SYMXX_BENCH(factorize_semiprime)
+  {
+    const std::vector<long long> semiprimes{416566268130317027, 330988094660995949,
+                                            649114847570543303, 352419777326106437};
+    auto run = [&semiprimes]<typename T>(T)
+    {
+      return measure([&]
+                     {
+                       for (auto n: semiprimes)
+                       {
+                         std::multiset<T> s;
+                         factorize<T>(n, s);
+                         symxx_assert(s.size() == 2, "Not a semiprime.");
+                       }
+                     }, 20) / static_cast<double>(semiprimes.size());
+    };
+    std::printf("%12s %12s  (us per number)\n", "int64_t", "__int128_t");
+    std::printf("%12.1f %12.1f\n", run(0LL), run(static_cast<__int128_t>(0)));
+    // beyond 2^64 the walk needs 128-bit Montgomery products
+    auto wide = adapter_to_int<__int128_t>("30000000008600000000231");
+    double us = measure([wide]
+                        {
+                          std::multiset<__int128_t> s;
+                          factorize<__int128_t>(wide, s);
+                        }, 5);
+    std::printf("30000000008600000000231: %.1f us\n", us);
+    auto prime = [](auto p) { return measure([p] { factorize_internal::is_prime(p); }, 2000); };
+    std::printf("is_prime(100000000000000003): %.2f us (int64_t), %.2f us (__int128_t)\n",
+                prime(100000000000000003LL), prime(static_cast<__int128_t>(100000000000000003LL)));
+  }
+
+  // Products of primes below 2^16, which trial division takes apart before Pollard-Rho
+  SYMXX_BENCH(factorize_small_factors)
+  {
+    const std::vector<long long> numbers{292152447739288291, 2441370109204048181, 176384804450585543,
+                                         3851467756659656827, 571050409026488437, 345859909717041263};
+    auto run = [&numbers]<typename T>(T)
+    {
+      return measure([&]
+                     {
+                       for (auto n: numbers)
+                       {
+                         std::multiset<T> s;
+                         factorize<T>(n, s);
+                       }
+                     }, 50) / static_cast<double>(numbers.size());
+    };
+    std::printf("%12s %12s  (us per number)\n", "int64_t", "__int128_t");
+    std::printf("%12.1f %12.1f\n", run(0LL), run(static_cast<__int128_t>(0)));
+  }
+  
+  // Brent's and Floyd's cycle detection on the same semiprimes, per factor found by Pollard-Rho
+  SYMXX_BENCH(pollard_rho_cycle)
+  {
+    using namespace factorize_internal;
+    const std::vector<__int128_t> corpus{416566268130317027, 330988094660995949, 649114847570543303,
+                                         352419777326106437, adapter_to_int<__int128_t>("30000000008600000000231")};
+    std::printf("%8s %14s %10s %10s %12s  (per factor)\n", "cycle", "iterations", "gcds", "backtracks", "us");
+    for (auto cycle: {RhoCycle::floyd, RhoCycle::brent})
+    {
+      RhoStats stats;
+      rho_config() = {cycle, &stats};
+      double us = measure([&]
+                          {
+                            for (auto n: corpus)
+                            {
+                              std::multiset<__int128_t> s;
+                              factorize<__int128_t>(n, s);
+                            }
+                          }, 20);
+      auto per = [&stats](size_t x) { return static_cast<double>(x) / static_cast<double>(stats.factors); };
+      std::printf("%8s %14.0f %10.1f %10.3f %12.1f\n", cycle == RhoCycle::brent ? "brent" : "floyd",
+                  per(stats.iterations), per(stats.gcds), per(stats.backtracks),
+                  us * 20 / static_cast<double>(stats.factors));
+    }
+    rho_config() = {};
+  }
+  
+  // What random_digit did before factorize_rng: open the entropy source on every call
+  template<typename T>
+  T device_random_digit(T a, T b)
+  {
+    std::random_device rd;
+    std::mt19937 gen(rd());
+    std::uniform_int_distribution<T> dis{a, b};
+    return dis(gen);
+  }
+  
+  SYMXX_BENCH(factorize_rng)
+  {
+    long long sink = 0;
+    double device = measure([&sink] { sink += device_random_digit<long long>(1, 1LL << 60); }, 10000);
+    double thread_local_rng = measure([&sink] { sink += random_digit<long long>(1, 1LL << 60); }, 10000);
+    std::printf("random_digit<long long>: %.3f us (random_device per call), %.3f us (factorize_rng)\n",
+                device, thread_local_rng);
+    // the probabilistic Miller-Rabin draws a witness per round
+    auto n = adapter_to_int<__int128_t>("170141183460469231731687303715884105727");
+    double us = measure([n] { factorize_internal::is_prime(n, true); }, 2000);
+    std::printf("is_prime(2^127 - 1, probabilistic): %.2f us\n", us);
+    do_not_optimize(sink);
+  }
+}
+#endif
+#endif
@@ -46,5 +46,194 @@ namespace symxx::test
     factorize<__int128_t>(6352787974848537642, s);
     SYMXX_EXPECT_EQ(to_str(s), to_str(std::multiset<__int128_t>{2, 3, 7, 257, 1189003, 494992931}));
     s.clear();
+    // a prime power is split by its root, not by Pollard-Rho
+    factorize<__int128_t>(static_cast<__int128_t>(4294967291) * 4294967291 * 4294967291, s);
+    SYMXX_EXPECT_EQ(to_str(s), to_str(std::multiset<__int128_t>{4294967291, 4294967291, 4294967291}));
+    s.clear();
+    // r^6 is found as (r^2)^3, and r^2 is split again
+    factorize<__int128_t>(static_cast<__int128_t>(65537) * 65537 * 65537 * 65537 * 65537 * 65537, s);
+    SYMXX_EXPECT_EQ(to_str(s), to_str(std::multiset<__int128_t>{65537, 65537, 65537, 65537, 65537, 65537}));
+    s.clear();
+    // semiprimes beyond 2^32 * 2^32 and 2^64
+    std::multiset<long long> s64;
+    factorize<long long>(649114847570543303, s64);
+    SYMXX_EXPECT_EQ(to_str(s64), to_str(std::multiset<long long>{656503999, 988744697}));
+    factorize<__int128_t>(adapter_to_int<__int128_t>("30000000008600000000231"), s);
+    SYMXX_EXPECT_EQ(to_str(s), to_str(std::multiset<__int128_t>{100000000003, 300000000077}));
+  }
+  
+  SYMXX_TEST(small_primes)
+  {
+    using namespace factorize_internal;
+    auto &table = small_primes();
+    SYMXX_EXPECT_EQ(table.size(), 6542);
+    SYMXX_EXPECT_EQ(table.front().p, 2);
+    SYMXX_EXPECT_EQ(table.back().p, 65521);
+    std::mt19937_64 gen(5);
+    for (auto &sp: table)
+    {
+      if (sp.p != 2)
+      {
+        SYMXX_EXPECT_EQ(sp.inv * sp.p, 1);
+      }
+      uint64_t x = gen() >> 1;
+      for (auto n: {x, x - x % sp.p})
+      {
+        bool divides = n % sp.p == 0;
+        SYMXX_EXPECT_EQ(small_prime_divides(sp, static_cast<long long>(n)), divides);
+        SYMXX_EXPECT_EQ(small_prime_divides(sp, static_cast<int>(n % 2147483648)), n % 2147483648 % sp.p == 0);
+        // beyond 2^64 and in Huge
+        __int128_t wide = static_cast<__int128_t>(n) << 32 | 12345;
+        SYMXX_EXPECT_EQ(small_prime_divides(sp, wide), wide % sp.p == 0);
+        SYMXX_EXPECT_EQ(small_prime_divides(sp, Huge(static_cast<long long>(n))), divides);
+      }
+    }
+    
+    // a cofactor below 2^32 is prime once nothing below 2^16 divides it, beyond that Pollard-Rho splits it
+    std::multiset<long long> s;
+    factorize<long long>(1024LL * 243 * 65521 * 65537, s);
+    SYMXX_EXPECT_EQ(to_str(s), to_str(std::multiset<long long>{2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3,
+                                                               65521, 65537}));
+    s.clear();
+    factorize<long long>(6LL * 65537 * 65539, s);
+    SYMXX_EXPECT_EQ(to_str(s), to_str(std::multiset<long long>{2, 3, 65537, 65539}));
+    std::multiset<int> s32;
+    factorize<int>(2147483646, s32);
+    SYMXX_EXPECT_EQ(to_str(s32), to_str(std::multiset<int>{2, 3, 3, 7, 11, 31, 151, 331}));
+    s32.clear();
+    factorize<int>(2147483647, s32);
+    SYMXX_EXPECT_EQ(to_str(s32), to_str(std::multiset<int>{2147483647}));
+    std::multiset<Huge> sh;
+    factorize<Huge>(Huge{"206111247585779921593008390144"}, sh);
+    std::multiset<Huge> expected{Huge(3), Huge(65521), Huge(1000000007), Huge(1000000009)};
+    for (int i = 0; i < 20; ++i)
+    {
+      expected.insert(Huge(2));
+    }
+    SYMXX_EXPECT_EQ(to_str(sh), to_str(expected));
+    
+    // strong pseudoprimes to base 2, which used to end Miller-Rabin after the first witness
+    SYMXX_EXPECT_FALSE(is_prime<long long>(9056501));
+    SYMXX_EXPECT_FALSE(is_prime<long long>(9073513));
+  }
+  
+  SYMXX_TEST(pollard_rho)
+  {
+    using namespace factorize_internal;
+    auto &config = rho_config();
+    for (auto cycle: {RhoCycle::brent, RhoCycle::floyd})
+    {
+      RhoStats stats;
+      config = {cycle, &stats};
+      std::multiset<long long> s64;
+      factorize<long long>(649114847570543303, s64);
+      SYMXX_EXPECT_EQ(to_str(s64), to_str(std::multiset<long long>{656503999, 988744697}));
+      std::multiset<__int128_t> s128;
+      factorize<__int128_t>(adapter_to_int<__int128_t>("30000000008600000000231"), s128);
+      SYMXX_EXPECT_EQ(to_str(s128), to_str(std::multiset<__int128_t>{100000000003, 300000000077}));
+      std::multiset<Huge> sh;
+      factorize<Huge>(Huge{"1000000016000000063"}, sh);
+      SYMXX_EXPECT_EQ(to_str(sh), to_str(std::multiset<Huge>{Huge(1000000007), Huge(1000000009)}));
+      SYMXX_EXPECT_EQ(stats.factors, 3);
+      // each factor needs about sqrt(p) steps
+      SYMXX_EXPECT_TRUE(stats.iterations > 10000);
+      SYMXX_EXPECT_TRUE(stats.gcds > 0 && stats.gcds < stats.iterations);
+    }
+    config = {};
+  }
+  
+  SYMXX_TEST(factorize_rng)
+  {
+    using namespace factorize_internal;
+    auto run = []
+    {
+      seed_factorize_rng(42);
+      std::vector<std::string> draws;
+      for (int i = 0; i < 8; ++i)
+      {
+        draws.emplace_back(std::to_string(random_digit<long long>(0, 1LL << 62)));
+        draws.emplace_back(adapter_to_string(random_digit<__int128_t>(0, static_cast<__int128_t>(1) << 100)));
+        draws.emplace_back(random_digit<Huge>(Huge(0), Huge{"1000000000000000000000000000000000000000"}).to_string());
+      }
+      RhoStats stats;
+      rho_config() = {RhoCycle::brent, &stats};
+      std::multiset<long long> s;
+      factorize<long long>(649114847570543303, s);
+      rho_config() = {};
+      return std::make_pair(draws, stats.iterations);
+    };
+    auto [draws, iterations] = run();
+    auto [redraws, reiterations] = run();
+    SYMXX_EXPECT_TRUE(draws == redraws);
+    SYMXX_EXPECT_EQ(iterations, reiterations);
+    seed_factorize_rng(43);
+    SYMXX_EXPECT_TRUE(random_digit<long long>(0, 1LL << 62) != std::stoll(draws[0]));
+    seed_factorize_rng(std::random_device{}());
+  }
+  
+  SYMXX_TEST(montgomery)
+  {
+    using factorize_internal::Montgomery;
+    using u128 = unsigned __int128;
+    std::mt19937_64 gen(11);
+    auto check = [&gen]<typename T>(T n)
+    {
+      Montgomery<T> mont(n);
+      for (int i = 0; i < 200; ++i)
+      {
+        T a = static_cast<T>(static_cast<u128>(gen()) << 64 | gen()) % n;
+        T b = static_cast<T>(static_cast<u128>(gen()) << 64 | gen()) % n;
+        T am = mont.to(a), bm = mont.to(b);
+        SYMXX_EXPECT_TRUE(mont.from(am) == a);
+        SYMXX_EXPECT_TRUE(mont.from(mont.mul(am, bm)) == adapter_mulmod<T>(a, b, n));
+        SYMXX_EXPECT_TRUE(mont.from(mont.add(am, bm)) == (a >= n - b ? a - (n - b) : a + b));
+        SYMXX_EXPECT_TRUE(mont.from(mont.sub(am, bm)) == (a >= b ? a - b : a + (n - b)));
+      }
+    };
+    for (uint64_t n: {3ULL, 1000000007ULL, 649114847570543303ULL, (1ULL << 63) + 1, ~0ULL})
+    {
+      check(n);
+      check(static_cast<u128>(n));
+    }
+    for (int i = 0; i < 20; ++i)
+    {
+      check(gen() | 1);
+      check((static_cast<u128>(gen()) << 64 | gen()) | 1);
+    }
+    check(~static_cast<u128>(0));
+    check((static_cast<u128>(1) << 127) - 1);
+  }
+  
+  SYMXX_TEST(mulmod)
+  {
+    // moduli above 2^32, where the products overflow 64 bits
+    long long m = 4611686018427387961;
+    SYMXX_EXPECT_EQ(adapter_mulmod<long long>(m - 1, m - 1, m), 1);
+    SYMXX_EXPECT_EQ(adapter_mulmod<long long>(m - 2, 3, m), m - 6);
+    SYMXX_EXPECT_EQ(adapter_mulmod<uint64_t>(~0ULL, ~0ULL, ~0ULL - 58), 3364);
+    SYMXX_EXPECT_EQ(adapter_modpow<long long>(123456789123, 1000000000000000009, m), 826759124302337736);
+    SYMXX_EXPECT_EQ(adapter_modpow<long long>(5, 0, 1), 0);
+    SYMXX_EXPECT_EQ(adapter_mulmod<int>(46341, 46341, 2147483647), 2147488281LL % 2147483647);
+    // moduli above 2^64 take the 256-bit product
+    __int128_t m128 = adapter_to_int<__int128_t>("85070591730234615884290395931651616825");
+    __int128_t a = (static_cast<__int128_t>(1) << 125) + 99;
+    __int128_t b = (static_cast<__int128_t>(1) << 124) + 77;
+    SYMXX_EXPECT_EQ(adapter_to_string(adapter_mulmod<__int128_t>(a, b, m128)),
+                    "53169119831396690682965460244420290383");
+    SYMXX_EXPECT_EQ(adapter_to_string(adapter_modpow<__int128_t>(3, (static_cast<__int128_t>(1) << 100) + 7, m128)),
+                    "10188126834901643530679278638400477127");
+    SYMXX_EXPECT_TRUE(adapter_mulmod<__int128_t>(m128 - 1, m128 - 1, m128) == 1);
+    // against Huge, on moduli of every width
+    std::mt19937_64 gen(7);
+    for (int i = 0; i < 2000; ++i)
+    {
+      int bits = 2 + i % 126;
+      auto mod = static_cast<__int128_t>((static_cast<unsigned __int128>(gen()) << 64 | gen()) >> (128 - bits));
+      mod |= static_cast<__int128_t>(1) << (bits - 1);
+      auto x = static_cast<__int128_t>((static_cast<unsigned __int128>(gen()) << 64 | gen()) >> 1) % mod;
+      auto y = static_cast<__int128_t>((static_cast<unsigned __int128>(gen()) << 64 | gen()) >> 1) % mod;
+      Huge expected = Huge(adapter_to_string(x)) * Huge(adapter_to_string(y)) % Huge(adapter_to_string(mod));
+      SYMXX_EXPECT_EQ(adapter_to_string(adapter_mulmod<__int128_t>(x, y, mod)), expected.to_string());
+    }
   }
 }
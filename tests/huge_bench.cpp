@@ -0,0 +1,365 @@
+//   Copyright 2022-2023 symxx - caozhanhao
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+#ifndef SYMXX_HUGE_BENCH_CPP
+#define SYMXX_HUGE_BENCH_CPP
+#if defined(SYMXX_ENABLE_HUGE)
+#include "benchmark.hpp"
+
+namespace symxx::test
+{
+  // Top-level Karatsuba against the NTT, the crossover is SYMXX_HUGE_NTT_CUTOFF
+  SYMXX_BENCH(huge_mul)
+  {
+    using namespace huge_internal;
+    std::printf("%8s %12s %12s %12s %12s  (us)\n", "limbs", "karatsuba", "toom3", "toom4", "ntt");
+    for (size_t n: {500, 1000, 2000, 2500, 3000, 4000, 8000, 16000, 32000, 100000})
+    {
+      auto a = rand_digits(n);
+      auto b = rand_digits(n);
+      digit_vector ret;
+      auto reps = bench_reps(n, 1.5);
+      double k = measure([&] { digits_karatsuba_mul(a, b, ret); }, reps);
+      double t3 = measure([&] { digits_toom3_mul(a, b, ret); }, reps);
+      double t4 = measure([&] { digits_toom4_mul(a, b, ret); }, reps);
+      double f = measure([&] { digits_ntt_mul(a, b, ret); }, reps);
+      std::printf("%8zu %12.1f %12.1f %12.1f %12.1f%s\n", n, k, t3, t4, f, f < std::min({k, t3, t4}) ? "  *" : "");
+    }
+  }
+  
+  // One product on 1, 2, 4, ... threads up to the hardware's, with the speedup over one thread
+  SYMXX_BENCH(huge_parallel_mul)
+  {
+    size_t hw = std::max(std::thread::hardware_concurrency(), 1U);
+    std::printf("%8s %8s %12s %8s  (ms)\n", "limbs", "threads", "time", "speedup");
+    for (size_t n: {2000, 20000, 200000})
+    {
+      Huge a{rand_digits(n)};
+      Huge b{rand_digits(n)};
+      auto reps = bench_reps(n, 1.2);
+      double one = 0;
+      for (size_t t = 1;; t = std::min(2 * t, hw))
+      {
+        set_huge_mul_threads(t);
+        double ms = measure([&] { auto c = a * b; }, reps) / 1000;
+        if (t == 1) one = ms;
+        std::printf("%8zu %8zu %12.2f %8.2f\n", n, t, ms, one / ms);
+        if (t == hw) break;
+      }
+    }
+    set_huge_mul_threads(1);
+  }
+  
+  SYMXX_BENCH(huge_strconv)
+  {
+    std::printf("%8s %12s %12s  (us)\n", "decimal", "parse", "to_string");
+    for (size_t n: {1000, 10000, 100000, 1000000})
+    {
+      auto str = rand_digit_str(n);
+      Huge h{str};
+      auto reps = bench_reps(n, 1.3);
+      double parse = measure([&] { Huge tmp{str}; }, reps);
+      double print = measure([&] { auto tmp = h.to_string(); }, reps);
+      std::printf("%8zu %12.1f %12.1f\n", n, parse, print);
+    }
+  }
+
+  // Sizes are in bits so that all_benchmarks and all_benchmarks_digit60 can be compared line by line
+  SYMXX_BENCH(huge_digit_layout)
+  {
+    std::printf("%d-bit digits\n", static_cast<int>(SYMXX_HUGE_SHIFT));
+    std::printf("%8s %10s %10s %10s %10s %10s  (us)\n", "bits", "add", "mul", "sqr", "divrem", "to_string");
+    for (size_t bits: {256, 1024, 4096, 16384, 65536, 262144, 1048576})
+    {
+      size_t n = bits / SYMXX_HUGE_SHIFT;
+      Huge a{rand_digits(n)};
+      Huge b{rand_digits(n / 2)};
+      Huge c;
+      Huge q;
+      Huge r;
+      auto reps = bench_reps(n, 1.5);
+      double tadd = measure([&] { add(c, a, a); }, reps);
+      double tmul = measure([&] { mul(c, a, b); }, reps);
+      double tsqr = measure([&] { auto s = a.square(); }, reps);
+      double tdiv = measure([&] { divrem(q, r, a, b); }, reps);
+      double tstr = measure([&] { auto s = a.to_string(); }, bench_reps(n, 1.8));
+      std::printf("%8zu %10.2f %10.2f %10.2f %10.2f %10.2f\n", bits, tadd, tmul, tsqr, tdiv, tstr);
+    }
+  }
+
+  // Lehmer's GCD against the plain Euclidean algorithm on full remainders
+  SYMXX_BENCH(huge_gcd)
+  {
+    std::printf("%8s %12s %12s  (us)\n", "limbs", "euclid", "lehmer");
+    for (size_t n: {1, 2, 4, 16, 64, 256, 1024, 4096})
+    {
+      Huge a{rand_digits(n)};
+      Huge b{rand_digits(n)};
+      auto reps = bench_reps(n, 2);
+      double e = measure([&]
+                         {
+                           Huge x = a;
+                           Huge y = b;
+                           while (y != 0)
+                           {
+                             x %= y;
+                             std::swap(x, y);
+                           }
+                         }, reps);
+      double l = measure([&] { auto g = a.gcd(b); }, reps);
+      std::printf("%8zu %12.2f %12.2f\n", n, e, l);
+    }
+  }
+  
+  // Sliding window exponentiation against plain square-and-multiply
+  SYMXX_BENCH(huge_pow)
+  {
+    std::printf("%8s %8s %12s %12s %12s  (us)\n", "base", "exp", "binary", "window", "base * 2^10");
+    for (unsigned long long e: {100, 1000, 10000, 100000})
+    {
+      for (size_t n: {1, 16})
+      {
+        Huge a{rand_digits(n)};
+        Huge even = a * 1024;
+        auto reps = bench_reps(e * n, 1.2);
+        double bin = measure([&]
+                             {
+                               Huge r = 1;
+                               Huge sq = a;
+                               for (auto k = e; k != 0; k >>= 1)
+                               {
+                                 if (k & 1) r *= sq;
+                                 if (k > 1) sq = sq.square();
+                               }
+                             }, reps);
+        double win = measure([&] { auto r = a.pow(e); }, reps);
+        double shifted = measure([&] { auto r = even.pow(e); }, reps);
+        std::printf("%8zu %8llu %12.1f %12.1f %12.1f\n", n, e, bin, win, shifted);
+      }
+    }
+  }
+  
+  // Montgomery (odd) and Barrett (even) modpow against square-and-multiply with %
+  SYMXX_BENCH(huge_modpow)
+  {
+    std::printf("%8s %12s %12s %12s  (us)\n", "bits", "division", "montgomery", "barrett");
+    for (size_t bits: {64, 256, 1024, 4096})
+    {
+      size_t n = bits / SYMXX_HUGE_SHIFT + 1;
+      Huge odd = Huge{rand_digits(n)} * 2 + 1;
+      Huge even = odd + 1;
+      Huge a{rand_digits(n)};
+      Huge e{rand_digits(n)};
+      auto reps = bench_reps(n, 3);
+      double div = measure([&]
+                           {
+                             Huge r = 1;
+                             Huge sq = a % odd;
+                             for (size_t i = 0; i < bits + SYMXX_HUGE_SHIFT; ++i)
+                             {
+                               if (i % 2 == 0) r = r * sq % odd;
+                               sq = sq.square() % odd;
+                             }
+                           }, reps);
+      double mont = measure([&] { auto r = a.modpow(e, odd); }, reps);
+      double barrett = measure([&] { auto r = a.modpow(e, even); }, reps);
+      std::printf("%8zu %12.1f %12.1f %12.1f\n", bits, div, mont, barrett);
+    }
+  }
+  
+  // Roots against one multiplication of the same size
+  SYMXX_BENCH(huge_root)
+  {
+    std::printf("%8s %12s %12s %12s %12s  (us)\n", "limbs", "mul", "isqrt", "iroot(3)", "iroot(5)");
+    for (size_t n: {2, 10, 100, 1000, 10000})
+    {
+      Huge a{rand_digits(n)};
+      auto reps = bench_reps(n, 1.5);
+      double m = measure([&] { auto r = a * a; }, reps);
+      double r2 = measure([&] { auto r = a.isqrt(); }, reps);
+      double r3 = measure([&] { auto r = a.iroot(3); }, reps);
+      double r5 = measure([&] { auto r = a.iroot(5); }, reps);
+      std::printf("%8zu %12.2f %12.2f %12.2f %12.2f\n", n, m, r2, r3, r5);
+    }
+  }
+  
+  // The dispatched linear kernels against the portable loops, cmp on equal values so it scans everything
+  SYMXX_BENCH(huge_addsub)
+  {
+    using namespace huge_internal;
+    std::printf("%8s %10s %10s %10s %10s %10s %10s  (us)\n", "limbs", "add", "add_avx2", "sub", "sub_avx2",
+                "cmp", "cmp_avx2");
+    for (size_t n: {8, 16, 64, 256, 1024, 4096, 65536, 1048576})
+    {
+      auto a = rand_digits(n);
+      auto b = rand_digits(n);
+      auto c = a;
+      digit_vector z(n);
+      auto reps = bench_reps(n, 1) * 20;
+      double add = measure([&] { helper::digits_add_n_scalar(z.data(), a.data(), b.data(), n, 0); }, reps);
+      double addv = measure([&] { helper::digits_add_n(z.data(), a.data(), b.data(), n, 0); }, reps);
+      double sub = measure([&] { helper::digits_sub_n_scalar(z.data(), a.data(), b.data(), n, 0); }, reps);
+      double subv = measure([&] { helper::digits_sub_n(z.data(), a.data(), b.data(), n, 0); }, reps);
+      double cmp = measure([&] { z[0] = helper::digits_cmp_n_scalar(a.data(), c.data(), n); }, reps);
+      double cmpv = measure([&] { z[0] = helper::digits_cmp_n(a.data(), c.data(), n); }, reps);
+      std::printf("%8zu %10.3f %10.3f %10.3f %10.3f %10.3f %10.3f\n", n, add, addv, sub, subv, cmp, cmpv);
+    }
+  }
+  
+  // Single-digit division with a precomputed reciprocal against a hardware division per digit
+  SYMXX_BENCH(huge_divrem_by1)
+  {
+    using namespace huge_internal;
+    std::printf("%8s %12s %12s %12s %12s %12s  (us)\n", "limbs", "divide", "reciprocal", "to_dec_div",
+                "to_dec_recip", "knuth 2n/n");
+    for (size_t n: {4, 16, 64, 256, 1024})
+    {
+      auto a = rand_digits(n);
+      digit y = rand_digits(1)[0];
+      digit_vector q(n);
+      auto reps = bench_reps(n, 1) * 10;
+      double div = measure([&]
+                           {
+                             digit r = 0;
+                             for (size_t i = n; i-- > 0;)
+                             {
+                               twodigits u = static_cast<twodigits>(r) << SYMXX_HUGE_SHIFT | a[i];
+                               q[i] = static_cast<digit>(u / y);
+                               r = static_cast<digit>(u % y);
+                             }
+                           }, reps);
+      double recip = measure([&] { helper::digits_div_by1(a, y, q.data()); }, reps);
+      auto dec_reps = bench_reps(n, 2);
+      double dec_div = measure([&]
+                               {
+                                 digit_vector out;
+                                 for (auto rit = a.rbegin(); rit < a.rend(); ++rit)
+                                 {
+                                   auto hi = *rit;
+                                   for (auto &j: out)
+                                   {
+                                     twodigits z = static_cast<twodigits>(j) << SYMXX_HUGE_SHIFT | hi;
+                                     hi = static_cast<digit>(z / SYMXX_HUGE_DECIMAL_BASE);
+                                     j = static_cast<digit>(z - static_cast<twodigits>(hi) * SYMXX_HUGE_DECIMAL_BASE);
+                                   }
+                                   while (hi != 0)
+                                   {
+                                     out.emplace_back(hi % SYMXX_HUGE_DECIMAL_BASE);
+                                     hi /= SYMXX_HUGE_DECIMAL_BASE;
+                                   }
+                                 }
+                               }, dec_reps);
+      digit_vector out;
+      double dec_recip = measure([&] { radix::to_decimal_basecase(a, out); }, dec_reps);
+      auto b = rand_digits(n / 2);
+      digit_vector res;
+      digit_vector rem;
+      double knuth = measure([&] { digits_divrem(a, b, res, rem); }, dec_reps);
+      std::printf("%8zu %12.3f %12.3f %12.3f %12.3f %12.3f\n", n, div, recip, dec_div, dec_recip, knuth);
+    }
+  }
+  
+  // A normalization-like pass of short-lived temporaries, on the global heap and in a ScratchArena
+  SYMXX_BENCH(huge_arena)
+  {
+    std::printf("%8s %12s %12s  (us per pass)\n", "limbs", "heap", "arena");
+    for (size_t n: {4, 16, 64, 256, 1024})
+    {
+      std::vector<Huge> xs;
+      for (int i = 0; i < 32; ++i)
+      {
+        xs.emplace_back(rand_digits(n));
+      }
+      auto pass = [&]
+      {
+        for (size_t i = 0; i + 1 < xs.size(); ++i)
+        {
+          auto g = xs[i].gcd(xs[i + 1]);
+          auto t = (xs[i] * xs[i + 1] + xs[i]) / g - xs[i + 1] % (xs[i] >> 7);
+        }
+      };
+      auto reps = bench_reps(n, 1.6);
+      double heap = measure(pass, reps);
+      ScratchArena arena;
+      double pooled = measure(pass, reps);
+      std::printf("%8zu %12.1f %12.1f\n", n, heap, pooled);
+    }
+  }
+  
+  // frexp reads the top digits only, so it takes the same time at any size
+  SYMXX_BENCH(huge_frexp)
+  {
+    std::printf("%8s %12s %12s  (ns per op)\n", "limbs", "double", "long double");
+    for (size_t n: {1, 4, 64, 1024, 16384})
+    {
+      Huge x{rand_digits(n)};
+      long long exp;
+      volatile double d;
+      volatile long double ld;
+      double t = measure([&] { d = x.frexp(exp); }, 100000);
+      double tl = measure([&] { ld = x.frexp<long double>(exp); }, 100000);
+      std::printf("%8zu %12.1f %12.1f\n", n, t * 1000, tl * 1000);
+    }
+  }
+  
+  // Copies and sign flips share the digits; the first write to a copy pays for copying them
+  SYMXX_BENCH(huge_shared)
+  {
+    std::printf("%8s %12s %12s %12s %12s  (ns per op)\n", "limbs", "copy", "negate", "abs", "copy+write");
+    for (size_t n: {4, 64, 256, 1024, 16384})
+    {
+      Huge x{rand_digits(n)};
+      Huge y;
+      size_t reps = 100000;
+      double copy = measure([&] { y = x; }, reps);
+      double negate = measure([&] { y = -x; }, reps);
+      double abs = measure([&] { y = x.abs(); }, reps);
+      double write = measure([&]
+                             {
+                               y = x;
+                               y += 1;
+                             }, bench_reps(n) * 10);
+      std::printf("%8zu %12.1f %12.1f %12.1f %12.1f\n", n, copy * 1000, negate * 1000, abs * 1000, write * 1000);
+    }
+  }
+  
+  // Rational arithmetic on one- and two-digit values, which fit in Huge's inline storage
+  template<typename T>
+  double rational_small_round()
+  {
+    std::vector<Rational<T>> xs;
+    for (int i = 1; i <= 64; ++i)
+    {
+      xs.emplace_back(T(i * 7919 % 1000 + 1), T(i * 104729 % 997 + 1));
+    }
+    Rational<T> acc;
+    return measure([&]
+                   {
+                     for (size_t i = 0; i + 1 < xs.size(); ++i)
+                     {
+                       acc = xs[i] * xs[i + 1] - xs[i + 1] / xs[i];
+                       acc += xs[i];
+                     }
+                   }, 200);
+  }
+
+  SYMXX_BENCH(huge_rational_small)
+  {
+    double h = rational_small_round<Huge>();
+    double ll = rational_small_round<long long>();
+    std::printf("%12s %12s  (us per 63 rounds)\n", "Huge", "long long");
+    std::printf("%12.1f %12.1f\n", h, ll);
+  }
+}
+#endif
+#endif
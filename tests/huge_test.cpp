@@ -28,6 +28,730 @@ namespace symxx::test
     SYMXX_EXPECT_EQ(h.to_string(), std::to_string(num));
   }
   
+  void mul_tester(size_t m, size_t n)
+  {
+    auto a = rand_digits(m);
+    auto b = rand_digits(n);
+    huge_internal::digit_vector expected;
+    huge_internal::digit_vector ret;
+    huge_internal::digits_simple_mul(a, b, expected);
+    huge_internal::digits_mul(a, b, ret);
+    SYMXX_EXPECT_TRUE(ret == expected);
+    huge_internal::digits_simple_mul(a, a, expected);
+    huge_internal::digits_mul(a, a, ret);
+    SYMXX_EXPECT_TRUE(ret == expected);
+  }
+  
+  SYMXX_TEST(huge_strconv)
+  {
+    // across the radix conversion threshold, in decimal digits
+    for (size_t n: {size_t{1}, size_t{9}, size_t{10}, SYMXX_HUGE_RADIX_CUTOFF * 9, SYMXX_HUGE_RADIX_CUTOFF * 9 + 1,
+                    SYMXX_HUGE_RADIX_CUTOFF * 40 + 3})
+    {
+      auto str = rand_digit_str(n);
+      SYMXX_EXPECT_EQ(Huge{str}.to_string(), str);
+      SYMXX_EXPECT_EQ(Huge{"-" + str}.to_string(), "-" + str);
+      // zero runs inside the number
+      auto pow10 = "1" + std::string(n, '0');
+      SYMXX_EXPECT_EQ(Huge{pow10}.to_string(), pow10);
+      SYMXX_EXPECT_EQ(Huge{pow10} - 1, Huge{std::string(n, '9')});
+    }
+    SYMXX_EXPECT_EQ(Huge{"000123"}.to_string(), "123");
+    SYMXX_EXPECT_EQ(Huge{"+42"}.to_string(), "42");
+    SYMXX_EXPECT_EQ(Huge{"0"}.to_string(), "0");
+  }
+  
+  void divrem_tester(const huge_internal::digit_vector &a, const huge_internal::digit_vector &b)
+  {
+    huge_internal::digit_vector q;
+    huge_internal::digit_vector r;
+    huge_internal::digit_vector t;
+    huge_internal::digit_vector sum;
+    huge_internal::digits_divrem(a, b, q, r);
+    huge_internal::digits_mul(q, b, t);
+    huge_internal::digits_add(t, r, sum);
+    SYMXX_EXPECT_TRUE(sum == a);
+    SYMXX_EXPECT_TRUE(huge_internal::digits_cmp(r, b) < 0);
+    SYMXX_EXPECT_TRUE(r.empty() || r.back() != 0);
+    SYMXX_EXPECT_TRUE(q.empty() || q.back() != 0);
+  }
+  
+  SYMXX_TEST(huge_div)
+  {
+    // across the Burnikel-Ziegler threshold
+    for (size_t n: {size_t{2}, SYMXX_HUGE_BZ_CUTOFF - 1, SYMXX_HUGE_BZ_CUTOFF, 2 * SYMXX_HUGE_BZ_CUTOFF + 1})
+    {
+      for (size_t m: {SYMXX_HUGE_BZ_CUTOFF, SYMXX_HUGE_BZ_CUTOFF + 3, 3 * n + 7, 10 * SYMXX_HUGE_BZ_CUTOFF})
+      {
+        divrem_tester(rand_digits(n + m), rand_digits(n));
+        // a small top digit on the divisor
+        auto b = rand_digits(n);
+        b.back() = 1;
+        divrem_tester(rand_digits(n + m), b);
+        divrem_tester(huge_internal::digit_vector(n + m, SYMXX_HUGE_LOW_MASK), huge_internal::digit_vector(n, SYMXX_HUGE_LOW_MASK));
+      }
+    }
+    // exact division
+    auto b = rand_digits(3 * SYMXX_HUGE_BZ_CUTOFF);
+    auto c = rand_digits(5 * SYMXX_HUGE_BZ_CUTOFF);
+    huge_internal::digit_vector a;
+    huge_internal::digits_mul(b, c, a);
+    divrem_tester(a, b);
+    auto[q, r] = divrem(Huge{a}, Huge{b, false});
+    SYMXX_EXPECT_EQ(q, Huge(c, false));
+    SYMXX_EXPECT_EQ(r, 0);
+  }
+  
+  SYMXX_TEST(huge_sqr)
+  {
+    for (size_t n: {size_t{1}, size_t{2}, SYMXX_HUGE_SQUARE_CUTOFF, SYMXX_HUGE_SQUARE_CUTOFF + 1,
+                    SYMXX_HUGE_TOOM3_CUTOFF + 1, SYMXX_HUGE_TOOM4_CUTOFF + 3, SYMXX_HUGE_NTT_CUTOFF})
+    {
+      auto a = rand_digits(n);
+      huge_internal::digit_vector expected;
+      huge_internal::digit_vector ret;
+      huge_internal::digits_simple_mul(a, a, expected);
+      huge_internal::digits_sqr(a, ret);
+      SYMXX_EXPECT_TRUE(ret == expected);
+    }
+    Huge h{rand_digits(SYMXX_HUGE_SQUARE_CUTOFF + 5), false};
+    SYMXX_EXPECT_EQ(h.square(), h * Huge(h));
+    SYMXX_EXPECT_TRUE(h.square() > 0);
+    SYMXX_EXPECT_EQ(Huge(0).square(), 0);
+    SYMXX_EXPECT_EQ(Huge(-3).square(), 9);
+  }
+  
+  SYMXX_TEST(huge_mul)
+  {
+    // across the Karatsuba, Toom-3 and Toom-4 thresholds
+    for (size_t n: {SYMXX_HUGE_KARATSUBA_CUTOFF + 1, SYMXX_HUGE_TOOM3_CUTOFF - 1, SYMXX_HUGE_TOOM3_CUTOFF,
+                    SYMXX_HUGE_TOOM3_CUTOFF + 7, SYMXX_HUGE_TOOM4_CUTOFF, SYMXX_HUGE_TOOM4_CUTOFF + 5,
+                    SYMXX_HUGE_NTT_CUTOFF})
+    {
+      mul_tester(n, n);
+      mul_tester(n, n + n / 4);
+      mul_tester(n, n + n / 2);
+      mul_tester(n, 2 * n + 1);
+    }
+    // lopsided
+    mul_tester(SYMXX_HUGE_KARATSUBA_CUTOFF + 1, 10 * SYMXX_HUGE_KARATSUBA_CUTOFF + 3);
+    mul_tester(SYMXX_HUGE_TOOM3_CUTOFF, 7 * SYMXX_HUGE_TOOM3_CUTOFF - 1);
+    Huge small{rand_digits(SYMXX_HUGE_KARATSUBA_CUTOFF + 3)};
+    Huge big{rand_digits(9 * SYMXX_HUGE_KARATSUBA_CUTOFF)};
+    auto prod = small;
+    prod *= big;
+    SYMXX_EXPECT_EQ(prod, big * small);
+    SYMXX_EXPECT_EQ(prod / big, small);
+    // NTT with the largest digits
+    huge_internal::digit_vector a(SYMXX_HUGE_NTT_CUTOFF, SYMXX_HUGE_LOW_MASK);
+    huge_internal::digit_vector expected;
+    huge_internal::digit_vector ret;
+    huge_internal::digits_simple_mul(a, a, expected);
+    huge_internal::digits_ntt_mul(a, a, ret, true);
+    SYMXX_EXPECT_TRUE(ret == expected);
+  }
+
+  SYMXX_TEST(huge_parallel_mul)
+  {
+    std::vector<std::pair<Huge, Huge>> operands;
+    for (size_t n: {SYMXX_HUGE_PARALLEL_CUTOFF, SYMXX_HUGE_TOOM4_CUTOFF + 5, 2 * SYMXX_HUGE_PARALLEL_CUTOFF + 1,
+                    SYMXX_HUGE_NTT_CUTOFF})
+    {
+      operands.emplace_back(Huge{rand_digits(n)}, Huge{rand_digits(n + n / 3), false});
+      operands.emplace_back(Huge{rand_digits(n)}, Huge{rand_digits(3 * n)});
+    }
+    std::vector<Huge> expected;
+    for (auto &[a, b]: operands)
+    {
+      expected.emplace_back(a * b);
+      expected.emplace_back(a.square());
+    }
+    set_huge_mul_threads(4);
+    SYMXX_EXPECT_EQ(huge_mul_threads(), 4);
+    for (int pass = 0; pass < 2; ++pass)
+    {
+      for (size_t i = 0; i < operands.size(); ++i)
+      {
+        auto &[a, b] = operands[i];
+        SYMXX_EXPECT_EQ(a * b, expected[2 * i]);
+        SYMXX_EXPECT_EQ(a.square(), expected[2 * i + 1]);
+      }
+      // inside an arena the sub-products run on this thread
+      ScratchArena arena;
+      auto &[a, b] = operands.back();
+      SYMXX_EXPECT_EQ(a * b, expected[expected.size() - 2]);
+    }
+    set_huge_mul_threads(1);
+    SYMXX_EXPECT_EQ(operands[0].first * operands[0].second, expected[0]);
+  }
+  
+  SYMXX_TEST(huge_small)
+  {
+    huge_internal::digit_vector v{1, 2};
+    SYMXX_EXPECT_TRUE(v.is_inline());
+    v.push_back(3);
+    SYMXX_EXPECT_FALSE(v.is_inline());
+    auto copy = v;
+    auto moved = std::move(v);
+    SYMXX_EXPECT_TRUE(v.empty());
+    SYMXX_EXPECT_TRUE(moved == copy);
+    SYMXX_EXPECT_TRUE((moved == huge_internal::digit_vector{1, 2, 3}));
+    moved.resize(1);
+    v = std::move(moved);
+    SYMXX_EXPECT_TRUE((v == huge_internal::digit_vector{1}));
+
+    // across the inline limit
+    Huge x(SYMXX_HUGE_LOW_MASK);
+    Huge y = x * x;
+    SYMXX_EXPECT_EQ(y * x / x, y);
+    SYMXX_EXPECT_EQ(y + y - y, y);
+    SYMXX_EXPECT_EQ((y * x).to_string(), SYMXX_HUGE_SHIFT == 30 ? "1237940035826615764299808767"
+                                                                : "1532495540865888854370663039795561568366082455163109375");
+
+    Rational<Huge> r(Huge(3), Huge(4));
+    r += Rational<Huge>(Huge(5), Huge(6));
+    SYMXX_EXPECT_EQ(r, Rational<Huge>(Huge(19), Huge(12)));
+    r *= Rational<Huge>(Huge(-12), Huge(19));
+    SYMXX_EXPECT_EQ(r, Rational<Huge>(Huge(-1)));
+  }
+
+  SYMXX_TEST(huge_inplace)
+  {
+    Huge a{rand_digits(50)};
+    Huge b{rand_digits(30), false};
+    Huge out;
+    add(out, a, b);
+    SYMXX_EXPECT_EQ(out, a + b);
+    sub(out, a, b);
+    SYMXX_EXPECT_EQ(out, a - b);
+    mul(out, a, b);
+    SYMXX_EXPECT_EQ(out, a * b);
+
+    // the destination is an operand
+    Huge x = a;
+    sub(x, b, x);
+    SYMXX_EXPECT_EQ(x, b - a);
+    add(x, x, x);
+    SYMXX_EXPECT_EQ(x, (b - a) * 2);
+    mul(x, x, b);
+    SYMXX_EXPECT_EQ(x, (b - a) * 2 * b);
+    sub(x, x, x);
+    SYMXX_EXPECT_EQ(x, 0);
+
+    Huge q;
+    Huge r;
+    divrem(q, r, out, a);
+    SYMXX_EXPECT_EQ(q, b);
+    SYMXX_EXPECT_EQ(r, 0);
+    q = Huge(-7);
+    r = Huge(2);
+    divrem(q, r, q, r);
+    SYMXX_EXPECT_EQ(q, -3);
+    SYMXX_EXPECT_EQ(r, -1);
+    SYMXX_EXPECT_EQ(q * 2 + r, -7);
+
+    // rvalue operands reuse their storage
+    auto sum = Huge(a) + b - a;
+    SYMXX_EXPECT_EQ(sum, b);
+    SYMXX_EXPECT_EQ(Huge(a) * b / b % a, 0);
+    SYMXX_EXPECT_EQ(Huge(5) - Huge(-5), 10);
+    SYMXX_EXPECT_EQ((Huge(-5) + 5).to_string(), "0");
+    SYMXX_EXPECT_EQ((Huge(-1) / 2).to_string(), "0");
+  }
+
+  // Forwards to the global heap and counts the blocks
+  class CountingResource : public std::pmr::memory_resource
+  {
+  public:
+    size_t allocations = 0;
+  
+  private:
+    void *do_allocate(size_t bytes, size_t alignment) override
+    {
+      ++allocations;
+      return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+    }
+    
+    void do_deallocate(void *p, size_t bytes, size_t alignment) override
+    {
+      std::pmr::new_delete_resource()->deallocate(p, bytes, alignment);
+    }
+    
+    [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override
+    {
+      return this == &other;
+    }
+  };
+  
+  SYMXX_TEST(huge_arena)
+  {
+    Huge a{rand_digits(300)};
+    Huge b{rand_digits(120), false};
+    auto pass = [&]
+    {
+      Huge x = a * b + a.square();
+      x /= b;
+      x += a.gcd(b) + Huge(x.to_string()) % a;
+      return x;
+    };
+    Huge expected = pass();
+    Huge kept = 1;
+    Huge from_inside = a;
+    CountingResource upstream;
+    {
+      ScratchArena arena{&upstream};
+      SYMXX_EXPECT_EQ(pass(), expected);
+      SYMXX_EXPECT_EQ(pass(), expected);
+      size_t warm = upstream.allocations;
+      SYMXX_EXPECT_TRUE(warm > 0);
+      // the pool reuses the blocks of the earlier passes
+      SYMXX_EXPECT_EQ(pass(), expected);
+      SYMXX_EXPECT_EQ(upstream.allocations, warm);
+      // values created outside keep their storage, assigned ones are copied out
+      kept *= b;
+      from_inside = pass();
+      {
+        ScratchArena nested;
+        from_inside += pass() - expected;
+      }
+      Huge big{rand_digits(3 * SYMXX_HUGE_RADIX_CUTOFF)};
+      SYMXX_EXPECT_EQ(Huge(big.to_string()), big);
+      SYMXX_EXPECT_EQ(a.modpow(65537, a + 2), a.modpow(65537, a + 2));
+    }
+    SYMXX_EXPECT_EQ(kept, b);
+    SYMXX_EXPECT_EQ(from_inside, expected);
+    SYMXX_EXPECT_EQ(pass(), expected);
+    // the caches filled inside the arena stay valid
+    SYMXX_EXPECT_EQ(a.modpow(65537, a + 2), a.modpow(65537, a + 2));
+  }
+  
+  SYMXX_TEST(huge_to_floating)
+  {
+    // strtod and strtold round correctly
+    for (size_t n: {1, 2, 3, 4, 5, 10, 33, 34, 35, 100})
+    {
+      for (int i = 0; i < 20; ++i)
+      {
+        Huge x{rand_digits(n), i % 2 == 0};
+        auto s = x.to_string();
+        if (x.bit_width() < 1024)
+        {
+          SYMXX_EXPECT_EQ(x.to<double>(), std::strtod(s.c_str(), nullptr));
+        }
+        SYMXX_EXPECT_EQ(x.to<long double>(), std::strtold(s.c_str(), nullptr));
+        if (x.bit_width() < 128)
+        {
+          SYMXX_EXPECT_EQ(x.to<float>(), std::strtof(s.c_str(), nullptr));
+        }
+      }
+    }
+    // halfway cases round to even, unless any bit further down breaks the tie
+    Huge one = 1;
+    for (int k: {0, 11, 100, 500})
+    {
+      Huge even = (one << 53) + 1;
+      SYMXX_EXPECT_EQ((even << k).to<double>(), std::ldexp(9007199254740992.0, k));
+      SYMXX_EXPECT_EQ(((even << k) + (k > 0 ? 1 : 0)).to<double>(),
+                      std::ldexp(k > 0 ? 9007199254740994.0 : 9007199254740992.0, k));
+      Huge odd = (one << 53) + 3;
+      SYMXX_EXPECT_EQ((odd << k).to<double>(), std::ldexp(9007199254740996.0, k));
+      Huge ld = (one << 64) + 1;
+      SYMXX_EXPECT_EQ((ld << k).to<long double>(), std::ldexp(18446744073709551616.0L, k));
+      SYMXX_EXPECT_EQ(((ld << k) + (k > 0 ? 1 : 0)).to<long double>(),
+                      std::ldexp(k > 0 ? 18446744073709551618.0L : 18446744073709551616.0L, k));
+    }
+    // all ones rounds up to a power of two
+    SYMXX_EXPECT_EQ(((one << 200) - 1).to<double>(), std::ldexp(1.0, 200));
+    SYMXX_EXPECT_EQ((-((one << 200) - 1)).to<long double>(), -std::ldexp(1.0L, 200));
+    // the largest double, and what rounds past it
+    Huge max = ((one << 53) - 1) << 971;
+    SYMXX_EXPECT_EQ(max.to<double>(), std::numeric_limits<double>::max());
+    SYMXX_EXPECT_EQ((max + (one << 969)).to<double>(), std::numeric_limits<double>::max());
+    SYMXX_EXPECT_TRUE((max + (one << 970)).try_to<double>() == nullptr);
+    SYMXX_EXPECT_EQ((one << 5000).to<long double>(), std::ldexp(1.0L, 5000));
+    SYMXX_EXPECT_TRUE((one << 20000).try_to<long double>() == nullptr);
+    SYMXX_EXPECT_EQ(Huge(0).to<double>(), 0.0);
+    // frexp beyond the range
+    long long exp;
+    Huge big = Huge(3) << 100000;
+    SYMXX_EXPECT_EQ(big.frexp(exp), 0.75);
+    SYMXX_EXPECT_EQ(exp, 100002);
+    SYMXX_EXPECT_EQ((-big).frexp<long double>(exp), -0.75L);
+    SYMXX_EXPECT_EQ(Huge(0).frexp(exp), 0.0);
+    SYMXX_EXPECT_EQ(exp, 0);
+    // a rational of two values beyond the range
+    Rational<Huge> r{(one << 3000) * 3, one << 3001};
+    SYMXX_EXPECT_EQ(r.to<double>(), 1.5);
+  }
+  
+  SYMXX_TEST(huge_shared)
+  {
+    Huge a{rand_digits(2 * SYMXX_HUGE_SHARE_CUTOFF)};
+    Huge b{rand_digits(20), false};
+    const std::string as = a.to_string();
+    // every write to a copy leaves the original alone, and the other way round
+    std::vector<std::function<void(Huge &)>> writes{
+        [&](Huge &x) { x += b; },
+        [&](Huge &x) { x -= b; },
+        [&](Huge &x) { x *= b; },
+        [&](Huge &x) { x /= b; },
+        [&](Huge &x) { x %= b; },
+        [&](Huge &x) { x <<= 7; },
+        [&](Huge &x) { x >>= 7; },
+        [&](Huge &x) { x &= b; },
+        [&](Huge &x) { x |= b; },
+        [&](Huge &x) { x ^= b; },
+        [&](Huge &x) { ++x; },
+        [&](Huge &x) { x += x; },
+        [&](Huge &x) { mul(x, x, b); },
+        [&](Huge &x) { sub(x, b, x); },
+        [&](Huge &x) { x = x.gcd(b); },
+    };
+    for (auto &write: writes)
+    {
+      Huge copy = a;
+      Huge expected{as};
+      write(copy);
+      write(expected);
+      SYMXX_EXPECT_EQ(a.to_string(), as);
+      SYMXX_EXPECT_EQ(copy, expected);
+      Huge other = a;
+      write(a);
+      SYMXX_EXPECT_EQ(other.to_string(), as);
+      a = other;
+    }
+    // a short value assigned over shared digits
+    Huge c = a;
+    c = b;
+    c += 1;
+    SYMXX_EXPECT_EQ(c, b + 1);
+    SYMXX_EXPECT_EQ(a.to_string(), as);
+    // values from a scratch arena are copied over shared digits, not into them
+    Huge d = a;
+    Huge e = a;
+    {
+      ScratchArena scratch;
+      d = a + 1;
+      e = b + 1;
+    }
+    SYMXX_EXPECT_EQ(a.to_string(), as);
+    SYMXX_EXPECT_EQ(d - 1, a);
+    e += 1;
+    SYMXX_EXPECT_EQ(e, b + 2);
+    SYMXX_EXPECT_EQ(a.to_string(), as);
+    // sign flips
+    Huge n = -a;
+    SYMXX_EXPECT_EQ(n.to_string(), "-" + as);
+    SYMXX_EXPECT_EQ(n.abs(), a);
+    SYMXX_EXPECT_EQ(n.negate(), a);
+    n += 1;
+    SYMXX_EXPECT_EQ(a.to_string(), as);
+    SYMXX_EXPECT_EQ(-Huge(0), Huge(0));
+    // hashing
+    std::hash<Huge> hash;
+    SYMXX_EXPECT_EQ(hash(a), hash(Huge{as}));
+    SYMXX_EXPECT_EQ(hash(-a), hash(Huge{"-" + as}));
+    SYMXX_EXPECT_TRUE(hash(a) != hash(-a));
+    SYMXX_EXPECT_EQ(hash(Huge(0)), hash(-Huge(0)));
+    // a copy made in an arena does not share storage that lives outside it, nor the other way round
+    Huge from_arena;
+    {
+      ScratchArena arena;
+      Huge inside = a;
+      inside += 1;
+      from_arena = inside;
+      inside -= 1;
+      SYMXX_EXPECT_EQ(inside, a);
+    }
+    SYMXX_EXPECT_EQ(from_arena, a + 1);
+  }
+  
+  SYMXX_TEST(huge_gcd)
+  {
+    // gcd(k * a, k * b) == k for coprime a and b
+    for (size_t n: {1, 2, 3, 10, 100, 500})
+    {
+      Huge k{rand_digits(n)};
+      Huge a{rand_digits(n * 2)};
+      Huge b = a + 1;
+      SYMXX_EXPECT_EQ((k * a).gcd(k * b), k);
+      SYMXX_EXPECT_EQ((k * b).gcd(-(k * a)), k);
+      Huge x{rand_digits(n * 3)};
+      Huge y{rand_digits(n + 1), false};
+      Huge g = x.gcd(y);
+      SYMXX_EXPECT_EQ(x % g, 0);
+      SYMXX_EXPECT_EQ(y % g, 0);
+      SYMXX_EXPECT_EQ((x / g).gcd(y / g), 1);
+      auto [g2, s, t] = gcdext(x, y);
+      SYMXX_EXPECT_EQ(g2, g);
+      SYMXX_EXPECT_EQ(s * x + t * y, g);
+      SYMXX_EXPECT_TRUE(s.abs() <= y.abs() / g);
+      SYMXX_EXPECT_TRUE(t.abs() <= x.abs() / g);
+    }
+    SYMXX_EXPECT_EQ(Huge(0).gcd(0), 0);
+    SYMXX_EXPECT_EQ(Huge(0).gcd(-12), 12);
+    SYMXX_EXPECT_EQ(Huge{"1237940035826615764299808767"}.gcd(Huge{"1237940035826615764299808767"}),
+                    Huge{"1237940035826615764299808767"});
+    // consecutive Fibonacci numbers are the worst case
+    Huge f0 = 0;
+    Huge f1 = 1;
+    for (int i = 0; i < 2000; ++i)
+    {
+      f0 += f1;
+      std::swap(f0, f1);
+    }
+    SYMXX_EXPECT_EQ(f1.gcd(f0), 1);
+    auto [g, s, t] = gcdext(f1, f0);
+    SYMXX_EXPECT_EQ(g, 1);
+    SYMXX_EXPECT_EQ(s * f1 + t * f0, 1);
+    auto [g0, s0, t0] = gcdext(Huge(-6), Huge(0));
+    SYMXX_EXPECT_EQ(g0, 6);
+    SYMXX_EXPECT_EQ(s0, -1);
+    SYMXX_EXPECT_EQ(t0, 0);
+    auto [g1, s1, t1] = gcdext(Huge(240), Huge(-46));
+    SYMXX_EXPECT_EQ(g1, 2);
+    SYMXX_EXPECT_EQ(s1 * 240 - t1 * 46, 2);
+    // a zero coefficient keeps no sign when the larger operand is negative
+    auto [g3, s3, t3] = gcdext(Huge(-12), Huge(4));
+    SYMXX_EXPECT_EQ(g3.to_string(), "4");
+    SYMXX_EXPECT_EQ(s3.to_string(), "0");
+    SYMXX_EXPECT_EQ(t3.to_string(), "1");
+    SYMXX_EXPECT_EQ((-Huge(0)).to_string(), "0");
+  }
+  
+  SYMXX_TEST(huge_pow)
+  {
+    Huge a{rand_digits(20), false};
+    Huge p = 1;
+    for (int i = 0; i <= 70; ++i)
+    {
+      SYMXX_EXPECT_EQ(a.pow(i), p);
+      p *= a;
+    }
+    // even bases are shifted
+    Huge b = a * 96;
+    SYMXX_EXPECT_EQ(b.pow(37), a.pow(37) * Huge(3).pow(37) * Huge(2).pow(185));
+    SYMXX_EXPECT_EQ(Huge(2).pow(1000).to_string(), Huge(1024).pow(100).to_string());
+    SYMXX_EXPECT_EQ(Huge(-2).pow(61), Huge(-2305843009213693952LL));
+    SYMXX_EXPECT_EQ(Huge(3).pow(Huge(40)), Huge(12157665459056928801ULL));
+    SYMXX_EXPECT_EQ(Huge(0).pow(0), 1);
+    SYMXX_EXPECT_EQ(Huge(0).pow(5), 0);
+    SYMXX_EXPECT_EQ(Huge(-1).pow(-3), -1);
+    SYMXX_EXPECT_EQ(Huge(7).pow(2.0), 49);
+    Rational<Huge> r{Huge(-2), Huge(3)};
+    SYMXX_EXPECT_EQ(r.pow(5), (Rational<Huge>{Huge(-32), Huge(243)}));
+    SYMXX_EXPECT_EQ((Rational<Huge>{Huge(2), Huge(3)}.pow(-2)), (Rational<Huge>{Huge(9), Huge(4)}));
+    SYMXX_EXPECT_EQ(r.pow(-3), (Rational<Huge>{Huge(-27), Huge(8)}));
+  }
+  
+  SYMXX_TEST(huge_modpow)
+  {
+    // against pow() and %, for odd and even moduli
+    for (size_t n: {1, 2, 5, 40})
+    {
+      Huge a{rand_digits(n * 2), false};
+      Huge odd = Huge{rand_digits(n)} * 2 + 1;
+      Huge even = odd + 1;
+      for (int e: {0, 1, 2, 3, 17, 64, 255})
+      {
+        auto p = a.pow(e);
+        SYMXX_EXPECT_EQ(a.modpow(e, odd), (p % odd + odd) % odd);
+        SYMXX_EXPECT_EQ(a.modpow(e, even), (p % even + even) % even);
+      }
+    }
+    // Fermat's little theorem with 2^127 - 1 and 2^521 - 1
+    Huge m127 = Huge(2).pow(127) - 1;
+    Huge m521 = Huge(2).pow(521) - 1;
+    Huge x{rand_digits(3)};
+    SYMXX_EXPECT_EQ(x.modpow(m127 - 1, m127), 1);
+    SYMXX_EXPECT_EQ(x.modpow(m521, m521), x);
+    HugeModulus mod(m521);
+    for (int w: {2, 3, 5, 7})
+    {
+      SYMXX_EXPECT_EQ(mod.pow(w, m521 - 1), 1);
+    }
+    SYMXX_EXPECT_EQ(Huge(3).modpow(-1, 7), 5);
+    SYMXX_EXPECT_EQ(Huge(-3).modpow(3, 10), 3);
+    SYMXX_EXPECT_EQ(Huge(4).modpow(0, 1), 0);
+    SYMXX_EXPECT_EQ(Huge(2).modpow(100, Huge(2).pow(64)), 0);
+    SYMXX_EXPECT_EQ(adapter_modpow<Huge>(Huge(5), Huge(117), Huge(19)), 1);
+    // modular inverses
+    SYMXX_EXPECT_EQ(Huge(3).inverse(Huge(7)), 5);
+    SYMXX_EXPECT_EQ(Huge(-3).inverse(Huge(7)), 2);
+    SYMXX_EXPECT_EQ(Huge(3).inverse(Huge(-7)), 5);
+    SYMXX_EXPECT_EQ(Huge(5).inverse(Huge(1)), 0);
+    for (int i = 0; i < 20; ++i)
+    {
+      Huge x{rand_digits(30), i % 2 == 0};
+      Huge inv = x.inverse(m521);
+      SYMXX_EXPECT_TRUE(inv >= 0 && inv < m521);
+      SYMXX_EXPECT_EQ((x * inv % m521 + m521) % m521, 1);
+      SYMXX_EXPECT_EQ(x.modpow(-1, m521), inv);
+    }
+    bool threw = false;
+    try
+    {
+      static_cast<void>(Huge(6).inverse(Huge(9)));
+    }
+    catch (Error &)
+    {
+      threw = true;
+    }
+    SYMXX_EXPECT_TRUE(threw);
+  }
+  
+  SYMXX_TEST(huge_bitwise)
+  {
+    // against long long, negative values included
+    for (int i = 0; i < 200; ++i)
+    {
+      auto x = random_digit<long long>(-(1LL << 62), 1LL << 62);
+      auto y = random_digit<long long>(-(1LL << 40), 1LL << 40);
+      auto k = random_digit<int>(0, 70);
+      SYMXX_EXPECT_EQ(Huge(x) & Huge(y), x & y);
+      SYMXX_EXPECT_EQ(Huge(x) | Huge(y), x | y);
+      SYMXX_EXPECT_EQ(Huge(x) ^ Huge(y), x ^ y);
+      SYMXX_EXPECT_EQ(~Huge(x), ~x);
+      SYMXX_EXPECT_EQ(Huge(x) >> k, k < 63 ? x >> k : (x < 0 ? -1 : 0));
+      SYMXX_EXPECT_EQ(Huge(y) << (k % 20), y * (1LL << (k % 20)));
+    }
+    Huge a{rand_digits(40), false};
+    Huge b{rand_digits(25)};
+    SYMXX_EXPECT_EQ((a << 1000) >> 1000, a);
+    SYMXX_EXPECT_EQ(a << 77, a * Huge(2).pow(77));
+    SYMXX_EXPECT_EQ((a ^ b) ^ b, a);
+    SYMXX_EXPECT_EQ((a & b) + (a | b), a + b);
+    SYMXX_EXPECT_EQ(a & -1, a);
+    SYMXX_EXPECT_EQ(a | 0, a);
+    SYMXX_EXPECT_EQ(Huge(-1) >> 100, -1);
+    SYMXX_EXPECT_EQ(Huge(-5) >> 1, -3);
+    
+    SYMXX_EXPECT_EQ((Huge(3) << 200).trailing_zeros(), 200);
+    SYMXX_EXPECT_EQ((Huge(3) << 200).bit_width(), 202);
+    SYMXX_EXPECT_EQ(Huge(0).trailing_zeros(), 0);
+    SYMXX_EXPECT_EQ(Huge(0).bit_width(), 0);
+    SYMXX_EXPECT_EQ(adapter_trailing_zeros(Huge(-96)), 5);
+    SYMXX_EXPECT_EQ(adapter_trailing_zeros(static_cast<__int128_t>(1) << 100), 100);
+    SYMXX_EXPECT_TRUE(static_cast<bool>(Huge(-1)));
+    SYMXX_EXPECT_FALSE(static_cast<bool>(Huge(0)));
+  }
+  
+  SYMXX_TEST(huge_root)
+  {
+    for (size_t n: {1, 2, 3, 10, 100})
+    {
+      Huge a{rand_digits(n)};
+      auto r = a.isqrt();
+      SYMXX_EXPECT_TRUE(r.square() <= a && (r + 1).square() > a);
+      SYMXX_EXPECT_EQ((a * a).isqrt(), a);
+      SYMXX_EXPECT_EQ((a * a - 1).isqrt(), a - 1);
+      for (unsigned long long k: {3, 5, 7, 64})
+      {
+        auto x = a.iroot(k);
+        SYMXX_EXPECT_TRUE(x.pow(k) <= a && (x + 1).pow(k) > a);
+        SYMXX_EXPECT_EQ(a.pow(k).iroot(k), a);
+        SYMXX_EXPECT_EQ((a.pow(k) - 1).iroot(k), a - 1);
+      }
+    }
+    SYMXX_EXPECT_EQ(Huge(0).isqrt(), 0);
+    SYMXX_EXPECT_EQ(Huge(3).isqrt(), 1);
+    SYMXX_EXPECT_EQ(Huge(-28).iroot(3), -3);
+    SYMXX_EXPECT_EQ(Huge(1000).iroot(1000), 1);
+    
+    SYMXX_EXPECT_TRUE(Huge(1).is_perfect_power());
+    SYMXX_EXPECT_TRUE(Huge(-8).is_perfect_power());
+    SYMXX_EXPECT_FALSE(Huge(-4).is_perfect_power());
+    SYMXX_EXPECT_FALSE(Huge(12).is_perfect_power());
+    SYMXX_EXPECT_TRUE(Huge(3).pow(101).is_perfect_power());
+    SYMXX_EXPECT_FALSE((Huge(3).pow(101) + 1).is_perfect_power());
+    SYMXX_EXPECT_TRUE((Huge(6) << 400).pow(2).is_perfect_power());
+    
+    SYMXX_EXPECT_EQ(adapter_iroot(1000000000000000000LL, 2), 1000000000LL);
+    SYMXX_EXPECT_EQ(adapter_iroot(999999999999999999LL, 2), 999999999LL);
+    SYMXX_EXPECT_EQ(adapter_iroot(static_cast<__int128_t>(1) << 120, 3), static_cast<__int128_t>(1) << 40);
+    SYMXX_EXPECT_EQ(adapter_sqrt(Huge(1) << 300), Huge(1) << 150);
+  }
+
+  // The dispatched kernels against the portable loops, with long carry and borrow chains
+  SYMXX_TEST(huge_addsub)
+  {
+    using namespace huge_internal;
+    for (size_t n: {1, 7, 8, 9, 16, 17, 33, 100, 1000})
+    {
+      for (int pattern = 0; pattern < 4; ++pattern)
+      {
+        auto a = rand_digits(n);
+        auto b = rand_digits(n);
+        for (size_t i = 0; i < n; ++i)
+        {
+          if (pattern == 1) a[i] = SYMXX_HUGE_LOW_MASK;
+          if (pattern == 2) a[i] = 0;
+          if (pattern == 3 && i % 5 != 0) a[i] = b[i];
+        }
+        digit_vector x(n);
+        digit_vector y(n);
+        for (digit c: {0, 1})
+        {
+          auto cx = helper::digits_add_n(x.data(), a.data(), b.data(), n, c);
+          auto cy = helper::digits_add_n_scalar(y.data(), a.data(), b.data(), n, c);
+          SYMXX_EXPECT_EQ(cx, cy);
+          SYMXX_EXPECT_TRUE(std::equal(x.begin(), x.end(), y.begin()));
+          cx = helper::digits_sub_n(x.data(), a.data(), b.data(), n, c);
+          cy = helper::digits_sub_n_scalar(y.data(), a.data(), b.data(), n, c);
+          SYMXX_EXPECT_EQ(cx, cy);
+          SYMXX_EXPECT_TRUE(std::equal(x.begin(), x.end(), y.begin()));
+        }
+        SYMXX_EXPECT_EQ(helper::digits_cmp_n(a.data(), b.data(), n), helper::digits_cmp_n_scalar(a.data(), b.data(), n));
+        SYMXX_EXPECT_EQ(helper::digits_cmp_n(a.data(), a.data(), n), 0);
+      }
+    }
+    // carries running off the end
+    Huge m = (Huge(1) << (SYMXX_HUGE_SHIFT * 50)) - 1;
+    SYMXX_EXPECT_EQ(m + 1, Huge(1) << (SYMXX_HUGE_SHIFT * 50));
+    SYMXX_EXPECT_EQ(m + 1 - 1, m);
+    SYMXX_EXPECT_EQ((m + m) - m, m);
+    SYMXX_EXPECT_TRUE(m + 1 > m);
+    SYMXX_EXPECT_TRUE(-m - 1 < -m);
+  }
+  
+  SYMXX_TEST(huge_reciprocal)
+  {
+    using namespace huge_internal;
+    std::vector<digit> divisors{1, 2, 3, 10, SYMXX_HUGE_DECIMAL_BASE, SYMXX_HUGE_LOW_MASK, SYMXX_HUGE_BASE >> 1};
+    for (int i = 0; i < 20; ++i)
+    {
+      divisors.emplace_back(random_digit<digit>(1, SYMXX_HUGE_LOW_MASK));
+    }
+    for (auto y: divisors)
+    {
+      helper::Reciprocal recip{y};
+      SYMXX_EXPECT_EQ(recip.divisor(), y);
+      for (int i = 0; i < 100; ++i)
+      {
+        uint64_t r = i == 0 ? y - 1 : random_digit<uint64_t>(0, y - 1);
+        uint64_t x = i == 0 ? SYMXX_HUGE_LOW_MASK : random_digit<uint64_t>(0, SYMXX_HUGE_LOW_MASK);
+        auto u = static_cast<unsigned __int128>(r) << SYMXX_HUGE_SHIFT | x;
+        uint64_t q = recip.divrem(r, x, SYMXX_HUGE_SHIFT);
+        SYMXX_EXPECT_TRUE(q == u / y);
+        SYMXX_EXPECT_TRUE(r == u % y);
+        // 60 bits at a time
+        x = random_digit<uint64_t>(0, (1ULL << 60) - 1);
+        u = static_cast<unsigned __int128>(r) << 60 | x;
+        q = recip.divrem(r, x);
+        SYMXX_EXPECT_TRUE(q == u / y);
+        SYMXX_EXPECT_TRUE(r == u % y);
+      }
+    }
+    Huge a{rand_digits(101)};
+    for (auto y: divisors)
+    {
+      auto [q, r] = divrem(a, Huge(y));
+      SYMXX_EXPECT_EQ(q * y + r, a);
+      SYMXX_EXPECT_TRUE(r < y);
+      SYMXX_EXPECT_EQ(a % y, r);
+    }
+  }
+  
   SYMXX_TEST(huge)
   {
     Huge s1{
@@ -81,9 +805,9 @@ namespace symxx::test
                     "987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321987654321");
     SYMXX_EXPECT_EQ((s2 % s1).to_string(),
                     "206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718206535864100166669907255680091839718439070599424993424139790415416666472588710691429156900139790415416666472588710691429156900139790415416666472588710691429156900289430507420829948");
-    //SYMXX_EXPECT_EQ("Pow 1",s1.pow(3), s1*s1*s1);
-    //SYMXX_EXPECT_EQ("Pow 2",s2.pow(3), s2*s2*s2);
-    //SYMXX_EXPECT_EQ("Pow 3",s1.pow(256).to_string(), "41578799857258222810631634468083056117819978041549951634571929733493368801946827552949348259626291296080181769570991690799503620616466998406556584311886735573555618114585796829661508668015362693379645305202156886360171568071115718654053679975108748313677957126412204159030514101308709092214995441023462670695431450047957886616440704948019178106090797807794537527928498629260036425004475801070462087800441621327796523170611853665172115173015562667750988213546688224424906674074183733930577810305586997250481326169532612222150740261994488103462330217343248389969536724591839672517889492892056281569942749803207085455092831119274038652693240490556117326699756977458557056904213255779510915202855844883043490999221689137709122038247543062893244781509507417746285581481078921651558205382386903015422991693875115537304692273220359932352867083143270091586950378605821222994227771412721766565603859269783824560558823099131180801469788345400364135586264908943457372211054391767738982645319886845406495085145068843887044638369264147848910283103477702042957747447301214573893143637059911121057517324109409650652321978650140395458492455315062713836520353422659505546145515117137702301514789239799446131231523770595045177603504370379300632041053420111844754078711258502277806544745941009428781311177323260706794637451429963988155810398834309227064254464545392593423971003688726185957954133422135215949081993222768464246232546600999309159087943845877699710132589934613866201900049657620248202130567579165511861781664013673328774367683985042815369969892269801004909353744485224487046453704757805370583320622982673898512069379851434393054226180460062669044642782808055182205197663985922114448605860747773364915064412419220888119237771659875705570786179259792519214787232981116799650945890366013320013357848415977606423118733516528171251686318077706150640666635223718606443879610475707860292160621499381756730736041196906547425571425737308646855450076095710327742403685502446797533374730177580952111949865715761757116994241714094537107545756361956121535989193900736874372861250055829855276657094021203873760887222242449541799645736481189202756685829876806964494303829373281049790938102003709977109102430029729621400089578954329802726601030940610445914379828390021879501718327278317271073271282812283454924382426760580076182603934483531552187961183292053959349123643916745299312181555481756633905009153276736346563582363465526781734930573342022520729652137838199208428174657569341059392736631649468932251989242649952711615923041136900667194209295275308967311664443063291489327297160134374225463150682028129037297904809671387969495371718225361388123106709966253571665431414176981130061511506222984769319136584724374846940970338283635713914219567082152466644313678192285808703865119588583566299302702465496799091243564727436301109582668324975842466364645806571475193801631507028268192369054903582000894540980404752556246747122597978955205958291437764211495165454512627248985713706002227280187057864422907579160318946481746287911477143474603563572353071035017733317932653387299537641102353384913144696457928044950033301928798155143254229513980838115140284529935458680805675539322752766517885867653322148716767573272929502604794071787217112845645664495141989591975087941686809112262677379811422287733362451280525777656752434726830348206802267080251963388293351351097438392349788438420415920376490401283017989534105357349720184002830627563941054821729453821740960307707624634920088794291928880650492080939708196050884963242583546967262963417783655062268418413466455229441690415986331119399447630986502219335400848756777727246288815528777119175058598251735447996875297345786101249683356714425857505580991436447867788849590125466306537248506174797803579486650827929642778160037489804004352160574993675524394519785077388113500840360348014676962238443565675508683262721992247566977968005337192667816615266267894262420704149029527043631276860950537481492972376907288583095298996993441609512753499800589142678523003414262412563631635655474268462061864806150102451981036141807895555194285238653601427761170987712431133842198722166514897738839880182902241429604780852221217608385314441065026071405042652811396855974576499590294122760641393618676603795606378708032642659831444091130898447037698499529504181464597060958383904998221503684777087075871542368840825192968176072512812386457232047395973950953630442348138217278739187084939556861862848243955223838810706225740468714426897886558014163396392356329804887227431804720154242294553449757908768845012004914581657177704087235822093325763454541268574587579930294538206743955931801650692512297334522625481600907656270187110498045413651490075319124737957446099174032476904797869388522798016521517720061961871075149708831706127579250451471545351137456222433393652715997199888567578792547518038577226177606363469311571873128238353483595830817548190838279448484016860956160868608909782460566066849851635896919195258935049675066406679120721427924851383631269628931835664356300565124992142381751826219350842193807408055412718036897019574551196100739564666052140501172368815566214359514142906651938471385104746440136314763997715903814657521755597792930439181407540851699229484572008487864336423527365018793142274405084885178711330216139270041723307482844578967651104694254544597363625560685809999779920356572124115875561500859687432505201879497980219502188890158714107730512514318733164664713631449719442573858284685779597279107307962937653382807688258499054698121378698379404732666741724979098364928128903284362143952624733419368511639894862287859609865765397457226550746242860548777591739160901442751633583410750837042224790180371303100707475280893879944755021868083675380102831435726272830680428698425797251831651030634660405378534746787626987602762732274263511818831476429132499098557015901212039165909392213398101858562431976357418987229970496094153189742243958270718733606123215543454501922590778373927122064896593779291630477747218666909879204169920984991249757009889457329651321669390698473811478931037441935119878425884025280604059947565384511556502966431636934765125691101947368761036196457334274287754937016324165695448542236801083552268206488465875629398977520736723758943082499697367584685358835808183877479172474721598941435982926410509880631621556615977717786840411731005483817216543176518673191198618990618825779333030793523181447800052950510920692553910737210842066919816317000221839275849588351818164986925433187445660075355501856421157940205220941916331932600219440441271408316807808910693158149121415559382769734359862732445641346981905128348581890315322305886088471996502059730153536509026351286204261102594467955042809909753863802424304245696333123370832061172990588885906973259238103942582262587103227582900779436931677419044807060214205062410456999521147452221195351164341018958248847513531438792044506503890180864240917720867246586955831840375267011253597411322033325807086575742007156974065888471132630761163666335884004651510001346269235428520540970700556449313443330386778784424767934599690798150729893739333708461398448608944946824824380753122273409095564390521625761923635656341187371829457037729917530010610655865560004037510267714285697811669567525510479103086710433330910693681847219536857578852419446745672698314489117048187395740150194068448340104075185566820854714757407304510566417729943266404395886202371814515703786137859112638694092691282151279096041499011805621292110056572602366766561317853396753793594977404028299022397605794648670263297671587926135422769942872161472248662655749417482195422765906600928865397790784129244032751369704916581304381035125092376563839813454126056035444236249210637169488660913894501959600966631864635855114740051854364128213296000858025723872132150113728796357462543022422591878675594102171631295207626730545978077344596150943327020654615025542418999078806407941334763098854025334641007010982671125356642288267644706837576948365738575160250094290547660201264081726328630488972035442093327340715283234662633178483386742465402842653206226942252953385569865713718381047603028900086188259513765884098839960531973179320769998369123899039410075967809104147222195556931094275683320343626754197895223953916835764452604933494670120416833292821665517875462177684515991388234028589003629963903772660313841548989135354215017059569473763093426412326723724256745775214773043678190958944204876109235406027921415109799689183275844466527703716950081966610192915478289594075754875716948948223530243788871071699133138681548668338091154495580096342300742061890959456148553161163987640883774521842132487032792564265035193123126479813887935346157056947289910865751144055980141344776394260765861642489760540108450239274875409785744010985450979101772156652024871840356641242516984890964645658657284784748225199388327900510534764957277054799995406517897607532059592413283468533913343980350559142179465217627435528807723662064404667960468776420857420044230919195801555903752167386738493109664236095232084575779962984395387119551285906897810189754637834485905839485598351387456215213732889658396488818465482487889939450669442797778135556988258750694335395628793930881443719874636858895978647772149927336342780734093416656181125484583895241725377814822174617097809098526116099355541185784475056609692604380492310455837651787301417914219159831199764809393549699432625979673779850575375824699662194699456919040797076622886708787348701904507212563839202644770999205689097631099141764474578050054713740377418708711219814139789012359971155197062404363756355194732188091381639305080643275863676627088974062706493197464459397012559477969367014508653725413474848898689239572239378669552418026290595973407469641977593113945575255292065506958026032776065335163324554179701901675061022993152072709325679336169611404691525045645523733103986042247321251156492487194117748563324149137590638804347516213226797293940377853130810141416637526513532369482286855837925855112914123385782341248506654444803584110550644881288673569748828073883851752810044743114133898276691889373783353584897519389421007695751714525332985998301456473578138685581383301686662364045658430269184958383584022138478107263016290258470101465845865395399061813801813701819725359460903891623848726678638343845098952260803879897467695471558718253282552154581315385111490521680251667955579255383491958904239215253501296663089234730260137509181336525129040198099203383658520615276081802969150401622266923909563955571356184777540407028532817754429890919868312774998492478500497869862177545932538859742860337124501048370643959111903731390144315145905287273070946764138687593733170652998084986508812493610503983576493412979848023361092381921500977459358722228579618089407262050452712269857278209809469155583583538980412227100339462363852736693200999404497561438691778778719261427246196011769523727945457640411242028386686927945316813356834982286955461095456611522346258031604370912285203075879321473703346799042875650801959003963751557578696578595289922494485237498051315789981262846648083510293983772931733426828194046778166358564673782868203371201917017296039075026093206554681582935774137450390765431674107796541218589376713833857832685703325300612100311087115007782501314961584921891973529646216638471163998847868415865602170408936863510978281741867609142826931557548812478977804172966644892066534336550418150276595315217441920455784394320028646645572621272552227580513973927105893534999367780131088312864058458609611664138802215414665390324287900506547058031912582182078200559392837412011183816799299441448254105776515463078886306710444025056623522492755669992174404535015068117718836059464243221966301378585859207123497757575300920611445044648853263129386216812764648018567932002099898907407555666493049256856220684095645995362602720698003756939518107474013136440687404822934884641790360992544870602015505580635356788519907523938872085672963300217201466040005464006841640243439795838952313666889080594779335959881963228069165749254794120729206794247955582084665313892760900850850944738319385092587108828082565753966294777243783406445744165919915700418180598997331245085735339760300723603988536134785381108697086221190760459684670471591184875643789500683822924388387539273693689568291864753778021595896023259173230026166918930949756651833320834550158674492506358163881905059202641837926118164973182042491589752374289817941283824952988252327111830699783016059916945212896761739025301684669883528879881749793307665629853563871538745609217254775945111202453359074560565801762139182703572257274490804403096922647954376329260804652975119304944014821278004437953267525374811827625909919017904347843118379026903503237709195352929492412339850715232678358947198269233578343615060353332075528798711611558782783097504043224723235181228155108789355096484285468973986252990148296523104651544722067686126363727520041527813846752772932311857126839026801817241173263084506823615778105038034725703883590916095250008975858425677396869700309031000904419837664450686871875551877651911973998984528842078386520606517147393797155742370133949305600106539688196753561500212917155800984171744887633794982781990428247437318041567298770602087970089957518017473031858628579026984053369568265390605956899846706303245023708610879168809955018754854992457617603667862029729950047258638187769287980004391775045659495621899740136637963054336829874547215899616556892151757834861689540680964325064495424025123289764426994034197390759919537645391535486006203730563553468741042667134150245528430402179005684691402533005979605515064958774548439846731117489507197298590332224996024054765770625036390580411680930960783768166773269919472094257784001947784122340898826368643005697598708890197067264454164432690573030170431021890824945176877634508667880371697025008344045758509345191814507076730354448970166628420488879908449146322871522641357284427151060842326876476742089482099385861367762059008991632734617965292162695455851617627453424917820958937711958027678345342307380626413421702073607889437067478937940394382983224312516039720357190705514731752273871275749588282577859144460746820365465627355637553188185670391081162333710198580105902740988767015957617870833978224777113335254481066893443091511044456697014376521071936862111008837091373616703597605250166218400416901642483670503103011800847366617898480054963862640162616052854594437669436502380673065535420332035933310980937555049431623499124437073826770789320142907313550826824680243864914513041592690445713159939446938415798560401707665916690659185425728230812769036248347757005123207985049586500093549305752995570262280124531639640250513529709384631475998580161812052857431728411817853870352411014381203105744547748404991921666651985460928137640325104037856266851187772864531249646941095765509103763808262728953256213425116316121554623951185722846075650610405576428600837698749496585690761054216338029879339720600991314512994494663227707402525652096538029222440111359108533686516454457359264063032287743890699742772979885118278876790421318108706265795797796413673677381836129448569767009115804847023939430043782881456375553707013350653631126845673956214039640859303384947513900788631815797934869403096776811517504561065145149651570225507967877744656377100743960519905509252645763994968668972500956297289695174102540740167153285154108523106834975873026187662522314545193333852624634180240060086186913647198262024094139362420025829770334189163543539204221833524839963694220163053195754668764255956126664359149892986989923776958449127195460596687201896790707330627426495344240808739364438172719159255484122870679718168218432534123944040183822372823104190166498597731279642634673324837509160684193746066937945192019046185046450929428498956205133399665729312891589436824156625018930110705612167717471232884641044467742344159982438687450927671794460065787285693298906930577303680175667293800652122686114534483244221925249254152834750714569037193484158313599608963332306988546943324444128819542494574100413666378676890549323379467157815930100755096579437679914134876294160318305568683988768388156782501218521426399032571061572485393776892985994699342935696398003458862059209168653172829574071168842903670733979692106711455024722999223775593736777389281767407714453175432641381769640807193547832803198085588330134664254817079919835506186597767660788226913469006505639584218751514087663865000542394265611068289223877413993677735170135647100000205031599367481413512677706504409003255183649210100922730459981694517361375359163555562629027741240484832410925276941373028023439361893830498810615630601476999131971160301865677285863114568947918970202795976248124593199144785810813864479102554188049224185799985792513607452061719307831993870821617393842035344001963435497237034744535678595314238657629440895438605989604451171676958115063316255834101087298273904394923799009578995441592046293145872042377107774782235682877902380046548540717039637473166068656460439058731821538017779753583027521666744269395929320599749121737718503899096197469974294952253407553034456561733201862954466395924199760566911518941341305176691378205638269358706929197135384367363435999104405676402784302719917164054377390766338163895032623704719007581611537629106894340441587985499650860905300480939747631825002405594473799535232115841017335605806913716508846552299918119300544813050038135563063494477384871247339261853051561028601598173983697575939619318565040337760091264259509293959076196467294721004042573501864307379948060541179982204675870996314218270177893595098043939919323653901435327985298249195817490674393200427934587814680578375741802882321497850405717386202283077753568535597587786225405654151849540678818638043688494229558129674797269721906086328389896366017114573810941475469742366638294615758766370256546342496321752152576006489340642055090809180362342368124777057570344322384212235837231771228215877396020415257823714425479760242542951764404438910317754284743005966521346629469587843308240408110634460239846058014288186788553734445901678744697454069764190039692430781017891923190613870809050951779916459097838095716307179754933470218468863580568309514963699314596136395807346801438035641518259271912280023791575187824107135777222811275185170998846977217628466438367281569233478190983124205751973789167439307281868677412078051498756216089408636736933341066687021338987054503958934468971894767226243545040633094908549756679535769165580620886727584890924190503490566629582851858089550742035349195900355762530323353209814260183365195507535316118727403664540924516978423682997875539135641231933700545582946273111054082557527693421774325229800777160616220564574479271003826042119765396222320780933982090525828931428694758582654277758681393277414542622428921049237839563187408990749637361820351977481293348223349910580529258474314296579157080903425026278998358491623960799565880940990304449727741112637923617935571354630119306629089436462099979575719757388578892188457029491407286586193150569322883718874126138496141700054379650295249067984651523146971490105870611940078993737607741686425323324088319673396751794071398104479120526893166233058560718503400317723202726335943184157168302051783884547787593951067153562187899516459194200965918772616299218392479278625799355134214289447898822573512905520747596293169772701549712789675019316827875617059993342602298990865062178412664197034306779016329559523345953878083184209598628328577302270206515047107676884004783457819627194441032745520255764079813017811849476047842176398927193920710130286189309754639471875782884205618265197832468403939725216774231426871615599368234083469731609921248422377517903230827201323289641348649796557222585951652995569229335378604094477908467596389133947537876190976163325789899581190441315140008814650840301448350567885192235250534163687765843995510223383245849580396873402520528986207546594148418302623625130279378289831478602396644623665724126733861124435347611721547499807514940810523561128548016207522027970177411967380367508421049123951514451176962529059602815663109952124545282572276102888487399166179703492481988769151128575687945528063172584660967077863395228595309391718161494313421476966302501958343514995096831260503384235386716839718410490470825357664424423989696580910143349206394514265345417346086977415167922387150215792207595644008913911541827266575409331987588138623772887525535704261606891479346600478454045869801927226718943306901840693689027959192092270573091168328156485733399757311959331333343049421620574025838403160961960751533987178312579999620886621101813563946899789017021674402753897001260371475891725398539748160485306382739592360351300864205922662483806432287399808587305242115866658109187353406208422567654679837866998477154211008873946750613820175044687598640297714658161529355934081065287803705066291601092297638973816373676419069524373080473653667551676430797948384521934957536135451773624503967698816743767948369250532181340018135508760416959814808348033331291948736765557973917354850387015176875391034244766774006022204343019460159788933179547792904824913846439191384425607035734826505397691696190833410340247880515927220767295632977018483796874877267838305703677194098138795818882971206232155037831416047029399945877370917807173218430780379784785458124638095722051219619960946238358674771114015317880580556714329612093973820343301311358291937166620982222413902132725665676737603006671079149627232246580432461199995877913567430153865255913684252508725796234031691352970672525914745412241994932567693237879304577652047919112625889079370752208104293628900457848445105094703540456942527832409928330127620499929725141264172977407721940871087598348952477592728950715811300749913343491240711848146230472233379084476721118516610369683599717298811630196983045782289331254876152999193457474915003741556787580508087993111903638598643787053450030808002715771249484580845172501451741947448556593980755335508859466219528482291035693039826710981411706954945223640112301502625981225135345479707838386346759697949705917833466607875103850804974781759136977715944695596572188231233274302431981001985849854990053747925784432934246338679377063699715354343155064676377765446126326187146386298880028234907278862526829947593948048827754043763050921562895999742052856098566568430190879639707219824791303125564933544351940130373144314771701824618469722826287773336104278704252324631878280414240003591089427307957887838896507823647785635781006818632274879492957506461779397128328162589956423949303716629647082242665209100633387527274767941677184483160754663075495025253663881762377511172919031519331696021334306519702177323497512823901338436304416840811557073529314627862431284323169615729521308325155815583756098812798875890036060636844512314174458291122086914061172056214323919798433765709940710357292216659272954895236047700497325939891240086190203254525572231806779626271044264223799877705137234675731162470616780945222972819593875871002757078135147840308889984269149082229148946479456835340398149044554602959582074098739726149525599736059905074832501383761582663378144857210254617178862865760543245431035020562571714921129241305386243498497010265736380986313304210113499909567588062375667316722626999712593585279752278652427855729193437669628268309393045364981596719525638719419216507798978811227406348997633131367870897971809992696624631896333148845284717795093559370672926130816337133079085645607531891694907873812532724869968517249231466298399319038703684097125423985669659275190336227701005833659180512466020243583655690690396965207462050393586721200505340245880031630712843883071633155456808110086978673215795446304699152343804834557528386634659067255376267143829868850351609902600339917660850458944380538098536220345341356904047679418376901335269957391772995524726259575232243581916552024420723196667863949328088352182931081506894961561134403710625261607310276726879657048910018465716920197046519457042956705630906874138013140259453527025188017490760432772960429782476858041204844197282511018497471873627453380721677721686062403089122808088286150436013290717567478937746078878031430872146611397710262129894837050716128918616888567735832186262464594696160977415000499562341547428400966508707969736449082812581874735185256668140369190174728849381117892083368842010387690371617067218387303309103654237116718275265140690861166660746233010595667295995078828733581596398370380927404579046694397359873153352642275042682548110161919454470892126953742770842465679957474052871752719206333391044106849423529100829970445049844881625971924870996090668397954005111980880810710031136853926678806801980072133001932930751032823048314515115461922922868884199933151620398616945265203829556454890083772571990330079289048139655920164958415002823203471269252281247394723592216707024814281861427484925264197657214073542451801116378449817911532940220678593838724017071368807533597454326662382442351174973475799943883964284592789831532296533777872294279589892845075483731109963453170946650173304347866289935853953618760214870153514473408567990082679603434729074286991065673711167664245185145703678317715269441904187336147563253754112330819021045175557935133321066150671581565503474988984283873968625035821474992442926383410152642426228464611985726695060865909047638789891682596583217706722748359202864754650118435968372772952511011362273575311055999411425891683392115517104487538342082160645569642705062062907249891248851675158092883963957149785633423841406752873235470456566949050265017335976930814035568872681279266817539762628609367479718962771119598121856627213292848663512857904930928098496197247229099380173619212482355485081456179684180985627792525663016153050200474005747894551119178240362163656632659432683877105256657497360687114236178625947619972402790580834340659507801354099788573571272501573369053325642259995241515649535911304958701267703809150200824270329689611526853555474129335150467120566949726989426862647051246398728749370931293928808950547741022072623419414808534891274567651423138950536318004146608570058585919892848685100288928231230456445535682315583199201698891037822557343344077192654202542317435233495216435078110304549173589840976340143632760725286026174295334051980707988574011206874952463543361628556206772802026859989721092836127724194210095124436640274217953438299911554933932234348406753717797897629382694099961395636301360665215458252823789201649610367855527864668362059127880519640231084534041281282654197553436543011695413765379321245814584496363422918655257370426928619728844423432787543414715045289683885353515335029120952673815423476230674469279449071351547309687170136017887582459525806964880201110375572719079401173856830726679045140049089831944682200076084811316080763111251486279003105133579087160731437716371049035437645480039792702499501723901174582280676618951243667869422603505654821427530706416247464947508994228940043485197951035537394056641842905716193626881964744960041425759213439034484714741628759899028456297066917561010344959285084553818359568854297548906127752446867770493223481970886211922560986460424228531364327813748436067314570358776813967170893869323077509452932783826742782688423637513918649314791811659619163193308609008237513417291233913120362720631108629366501863585340387911754874643453012966458060475012630629669797765452232819680285234073579103180885775114253655622722019392412259578361565543384223502145847889530200172269756803548995555276528127282763356705804462857767110472099713464037140082343015389174474630465520943000558316077404751300860346481243982373015585671230554540681446546615897244906430123673442302573738884535676707674812000725558410181465199424655139409043799375229308565189034034376834750442898213010329705205229443872289252407571892655238220258298020058738538779258027181599431300218953730519122420866624308592238368473705824539087947259258654614510699242071566483381051126113410679622207438857146131961250856290523191904007528975642386863517877712696631716617213011872651883131155332367666155483437426995933798423253456831661350706340546574534019777289904014422898663210711941504495494907215060542136092755993208277030949182555784681146218512709660497681102862639341512963677680254950752368626970581789298879862768552888016385733222368107882467829065202528155337356099704853714633185523916777667026515270412388459437473921788960298529326217506754114302350492275234608284190667867230705446306170745190529344816141096803850890247712438171870442202122540253180600691354158240716116222455296295245845446922794989262991049907939196312516865361146413487414391704289736445269173897672002378988294895133072862367612825832022011940700627088051278901882074003671733124809764349031064853002251472676568329723654877585625407459916077423664323151438215042045200481689666183179118253793929452615612660753529559632439138712645019666661048169277272073198277206953834129138623453665899844293350970577742193169755611280128734636136449838804641188960440866515665614304085714001284694068016538553014394151834018933160909663110648558812154296489813315687504297957184068254668237951414718354312992649111094444633125943393128827102588880217542964887719284186504984995528501445894779971499116174057325642575959387025457244557880241274715702432956911131118557632807312344624743017579569630419810864390642442299256886845717741182349226300606884065080169152228239330685476720313194720754740441879699633820045685059504588167828287570881880192172092479522612865993478852784099278056778414326516773347873664453173494276054922115556812589886084846526097927639565184735210669440068220775757647611285768950300412053030965928158408897278484553308918287821140251021395877464144673986114789988344463708922008604896966687971745614002154545167641248763791165776624048236998245971923347816319335538479826869613482335798894647483705633236104496208506596191025561150073595038331322483404302104967647170721026013601754089935054215403999546764341042907784636659574420430102882863377768863293203040475192700096255541897173045364791710436468728493156020215924101928708198800231968343081598134784304812814354137273102678483195293270154523600892959661802972701201358223150531454163901739826082134545326739755591294134495925250556759690922521066253391092768189539432475754991595420574019427835145188098862643754244250253090395503388953024833054153549340550528676519042969209918100096915988761031152885628347205977694171386411350427631429392781736970483805928598613569494977904589050149765368708176101444188335152355897873313806056122970493421834904688170632138687365055060499092875189430841899076631002964875162656992635822568181241984795600271030232097305800357428564205932396038733292245777523450006545048413572936753615363222593488351841640452356636863693646209948218209472408634209143835340811879371516149238274298768655676799282202430351292113889809012384083192587131717717302328691913333143831454619098012929692914339541734791994173288936133521674993615084202096488292829716637874470815504266430047439902164434577753544725871456817606362964375344472692502905813211160875605653256630643622428736524319101139588839396143920977052341042515931571189565150064874302365529529579939990954334527390454701058434817750046476758513907589160424774537670543642109683552895153601907517681411199583289311545887648214362192858099610787156302006623696145366841307595830578770017050988226710282315664413934533017409813564094184196009417498972616357890450869134400735339976546834136007338203425070113390610289526146695548672486855433034210878818515836056894518421126906866276458567324542243759372078793755736621594323520350302091585999857504009787498777011603121434701280506003552295486804741467403398142193912266222808391186775915983969835580677264542622238664249049642153302953885368765773974200340855390044800456611795777276087306399213505268278072572277554237475285113777520656880830237954723917513723572807480369980393414199437920386067836179642350755140732293409946170546129597564397400796180787389188584558679096578028630932048197777182963887956634210716124366525427106407301885476280976650667507753788895640236543267277039708511063098372450472162136564588041163128750831357496998468457971141264278359387354395419223271441717494821599196468635660087807026042890967372767492642089048738321060365681881026694678605239968592576776195341689036022706895289182213239618487971900664047537455613947262007958322914243963542548537374646545379057599747811575380917053669232792456063192180326139346605221981510949841137360480526736402701341255412086932397299263815495642320226842956819546364365741716475264190579615146184610643588422764707393816775697709605462746219861180534941681754893985899152574561273715587660039889781454976544134608866658937564449043761053380705583282156470778394632235537723263522319850714696592086692446963370224695539774748438419527526688225696121155104040077107607305889396622893441838757448813617122892320404424087947023894376026563986896815379969793724354853487463440767726789331471192821188751105932563714830348778600302944946985925467618999155383143037190348182061942365604986821542758067507958320039882811142321134078578217990969047666522077752554976701816022856745500464489724822565252541618403821114969767086794821684341193850349246978040340750278010688647536364133491261928373726844818079337217825508703888934394193160272455746293002089707554926172437163845918015200026274090424600918484571823525939521375191516753291692740883159552561239633209453497748802916356324217629819294670508323759025435877078065765102303897586880425501121822390804937485219716397453519564277894690982631567285177717302803602807961251179831029359443821559938485774083102526228263510099406614629007627083706289497577830109452606969327859327794829519406574687371061846458205719969325858860472931328126061855022465154216653305242018341660982136183681751886776912775227676691939402951817582298516027313615712922088874968833401472911260365048663710339097418883113407301215373435643431029479345860727695432596668465799409648039677703430634991170829073501151467059667823876333090262825988867358062827070079016074044011922753380531591347241113758702380445004478854999386630287381118269829850115112379120398553903907338112553958849141731550692023809013001465449992209946170642634202303525627505068009827345807567837253185644290064918696720885850655231424831403746778802943021709270713289224169186450795309797721040687220257537471850893099046981184400109121895676301564795630135246784415482403307248764314388951486755483159685741754174268500608661442047301205969949575013886250737864450582934071693555935341235083946124911139721756481277326888574449945945563934525284158536655645744621987309886568846299217168349147530718196473335788021137513562381518159618859596375297446188337877702020358679159835901023462734363002744415106597379367235874546926114437610653889908315612255509278557532820469720908514785284727051341624452588582972172237283981114716621099664692687448149650425950578932908802607124426648639126603055962168410847082367870038000908264701571336783595416802357315010742448347282278489213445869800223920262555929561268740859024640783925051942967542202859010310452430119348287258025954892916792123928860999247946154479155429865896438858894664700119537815240026311954306504393429875166519858938425451962020823155473620940616395883106316822086544698184157865566186951842199487657366380562364632930565123081646300617412956256103654012989541644951089981385615199622591406378498470187164395949233916744764290089297263452289693530828696907752830909834759700703794997652774716401664205145944129844513056652254124631525923655848611804693826252154346507343463649132628942097501522986256082022779890726503515690927541155898291102600130024425852475833101903574748986918793238810186546526231824231193917304925201039662199793720926893264518299640890772452834205320510833497964515371676152013182896613527270118021577764528057719447455169272419780454677425064647058902911443844966747201933463383588340102836300410900670650424137211611273334909347308366991634061331243870026023710615793361551893318618065857409646205621547247088930994926901773535419185845634988226379087687343685717237369605408632969101984483361881139389181108803807436055718766381039932515276296422587031408295883314338104655032492523011874965017730026643561096813036707977382144262588028094164118911603343357312779073371833526227784324122899584568675001275200545609763710239004297282624841381976223760419547026780880511170854257428729893536923863341430806378726894975354969181098012819936192390655051170410305958723227844567711531063192069284579784425262147529666391271809398406239536198168521781906280746883636315371145240114144601609957276265815260752209399391486373009662677953423382936448022290232712518099046489589500033555386788178028989942209482035481863608579155889296612940630328841387824943763531104668710583331101605426444098361072100626007166928907458962705531820419748362023067088223762775094173666128373744440272944866494648316533834635997121553207259038883917931878211974829634660161571312454938207890005405210499223977491232178043747722924603238236023509528415253240951861705195400038679750562902574131969261678794573699772283662883240897280336386247572148513001872472906585707510499060355273632084207990310539118970614244830002658350872942281294398127204912317417572273700543483513660141277045757559995422396220231083098349776642690254027197524004784275604579031650744366826790915588364770436294457661868895109860618414468418385408765714264388216192207356774873253039527521013555406985725740044279760298990610263558488222895816057737070420704971327754619308698137133708669942277043520312502179323787512474019257217247796890124311706499476191123655521713259819587352677251931014512976581538643957952658101371026377449036926883271022899160046691140497496583871485026772025347221189661264209097171354185413208219770797574023222456870697849791556167013554577621203144720921684938510119505402286200313217885845936940525595384999109919046727857983360801860047372659718778374780862837643976309978313671533606742092070995304849950827238700554185495109316150960635387409514257434534792927695814430882404285415485287005179707233913911043195103884024916381923854519114791908360423092589752916036362870962364333032941107874087397213912441779698914163971161935954474892986577139047415155094438579166464433173218067331451424363912137821650959043268542439620942990706078104827868016969820336834748641544121067759559937001913922867174169000337344758673084094322828691653857614070769297004804157976435419078008629304250696588025787957923580473631624047191980631039322498035492550193830385964334655153671415546928570395637647333491852764968285780792844421604207917326748755999962897545260906148175008149129848734191930677897807599715225496970491270756009152959434870667717310014222953725200507346596719155902795856472437146302443309714894411735683530019939717027689415251806559603069516303350706634498779456307941616912050728843920592398496062175150900168038529333476695896701506033062066768120850718939508698686920382486637265348009142369414472079325315745967807942804908015521559648550012270312644126869744013909011958350420993457894652587155649468347728977610048998050165662851204566324750399528731764530993828244046932531507263487523321768412887938266721139709294827521987918097418945312470620652490992828698791378255471444063531275994868905590471517950180327194125335323072983103636752668518808367053817007055741019048602524687152745855216544216046417843309640862631370191807285433730260534794174721236474410847684815293709911901897698317186022180115471160461047756910774533976189747594391697355001691276615590534771249540147705916923017688792025582535293919461134452287659748040277387618778668483930076097917860175966965170201042141566985296397397793103557447059891808834200187137633544095111670066099997254506980105284318655521294670617885612101391807331254066252484778732470960450450719230326631694701976578377840330654529307807030829584453787148783548396198830408310618155616799074014613825788582699076467915312644667234955128683297115379625777889855229179786984503124791826139353161051122415492425767254661391887610694566913579507901233534442985548254841768938994839608139027395062962865433324296096490375026110099521927777617014356129174229551617453147602920190562585948248163664023031363337467728373454322661786241327899666070279822701231224556881378786505431007675298082319843317000116890423226774985577593093323424036130391366853834093909192199807993974346242684504579122584462153229566348148884172317994070407865515916747367188993366603185102352019517967750493635271632448839087613961875842622522778805676327743423018803351169315468872814611017440589084655721686832960403059197535362038267967565249944763205197371792689277030638689379234530080027221445243121007063054274296066625783757714316008956046336337098518680774197168979559565518495381688060810646277292828560947483199950264276817775701686515978391161546288252772432701336739936470324952295123279269160961189047085921326382779265571038563055586996435481739410441274373250093453243891652955747851822802873333848063678344315594910215627028238040052279646162280302461115513348070020829843282209378658222851179471990340281480079314227135012139797134484289082569330135434907316735308695418038390640278590763852082368659569795752545889847631373386824631351369673955506907241183198080414718053766373900377496338007706377561321601390808942899647925345326356581738742479566362569191516557597923498217362663439648000788953193618375057787479253495309781325456312452878422729293953166912088227300128272577198140359773908946997370467087676810596031354494679805820384368273325234380961109530033061483658574045236371260358285592135807633467408794717444728510313533317218959257016025304566682278955552999763687383662140341917566750035214907376108796645893068475786653604523369218332291183359528694247663489731487154812695142899266645229387148184052548396603865485061603619415664484670696512672531673883915803722874227472504927369037352708620530288541710875022779009488687322456785474346379775027930041665865495987305934898217877418603347951756373892923584892488152418015881310300420782567694102485027344391598575873669682782762422459162790036298546028617651376650035806990242604173765232766945956104017853604599941602545709776729158614221330690421167889166538995772866841313050613173955244256662035425852508797559357641515222871057496721534924029197361657801057301956701370257569104558155396684162229443310706858587875630018401694607356624546780109020785895111467332951830904444100035715099540881941007775283364457725114908281721521918861607793110880587691821095077609302673568031047590941963174548589766975039398107387276031928927089640807556889953122104927444529857697297245993230897390378387309004675525175740871588937387645678985901207726931348200042676121893656990698970772351168553155939514914191318181546023733712120703344745455779967350749406365637081113992202594533047076122102871752733134658493117995464443779830301325399756117784252581666050585558385602231314589831672230743793514309814888965649707511870583062415930571501783733676051727453217463978184336049761994696283122765936482935692533772482965089840577601898624452740064596914491065597632316100118155445688740646949412120429956847212460273098890837532295634655376498983462329982427359305271759771233025556799719670236811806209354718918076728036179969660940793284537404857450116284206479343500594042420943946289119230920441991864648910593450456935975892996052122494843291665985177459545504161642089626583519399321418675169405637606117351913564205210912552857324977555001980352112490180607731388623604244113603599106025710927143849365487318711139947348656083417840230739413394143385570823806575194498476942992800126612308825454515955973871313196442391445582462015748763913101256726089186000262727276940241001600318357407241532672269696709813014399514220327341581970937140711564417190791281375380444048554121288350054089974611423680521084510179928164564825490133658162039208134115693570943893901151980145679094533574927439747473155354761461934793423366809244841334786033379361074450604794961753203303832480681632199813774459944221067100773684212116178111262940730732429237231484788007356277551950618394164117092348986698627825753429092479321396946134328277582629429502782997581634271005223273342082689129696636120465210558459708285669944804856286006245145025427615575985138630686676542984108146552888993141140397538055324189790731942872570035992798018106618191114622513025709247036275743336207153949283808631272361100038360178302656687525313108466210506401954620276935376140239567732433508310569189180609192376591295818638052452433799682991784400700958000243909642297144038561176923007329980373291164737993121267740304407614612080489675802361934583488068905749862575570049463377907452110941353742648579412375228233101889405412771915629489016100666951098082449544611641153957812612994884284893074037012950803254237578636530589109534153069223203958108218857408700191426706974670205199917117399231865042138027867205217035198711929575458048561211903283924526904118622144899579773501012068864904567596976475244610111307743471883148863535839807695022597897606671511254775250724146241930457632151114888955323599451295081635441763488281715852531327359236093743689245581676568508435893438824791902706950276030748649325983683311818158119987489293213245849011057636012393563204786024938570481828849041832055659924642830667836538742593123035581623119335894123344894234683671139303737533572666539117736023690251386441098844834429889153336024804404947481359618639653111287937026582666597787061670993376309160623554795261495031084988838735378139830822122859096954388571504468110147380141354830797863248187805313523572869886665199719887024080938509349602955666035078314229150816329606081141283383162569899045106551571445987212216906221420735002427632236782033770868147243494635412324048905435313430710326830735191671298939079039689143685155517937766290205651315158797201931762691392404628322554088776713800061176599335923312563168900937729810595459805960276921342693279866711486487088586938131015899064730928952929204516199809336467196107428556494802912542299812676007818780802332850298498680907545430874587389337210093619301714688173808885716968669735955451269601363967365082059486562455558464607130462770710479764234501986951186321511831211602333694843608404838767411380805426577456341050326037959723270922082708326835824917686251023071922188765902128643565269080558852869945262186223026515368950174673131437973662384409267727966529008752916761533783931882081341933500310240473079190852984234602920798599755613978706995359241585865208016590708860850080176600140386965279749352611760274332987091958475773727369975808332055601086438898620186106711894141060824657110531202272970451612256542545949337495892176660099812994533422309603380315197890309360699221660377738686336513784591688063983889732699792427163041196691104017175677742493626489423906436477845198299479742253494072984190501272872345787791386306688570687578276391152331977128770137968337197436942482517927250897077476611941559550044724891618819250724978357568963106396528922091982130482481673044330147798934360357869174656815142717798619725767153603276991421299785328154034339613955316931992013875292219526288284057870485783166778356056127741226185650630861476126398710402606487018200550254898882815530852724914560997828542273046368710108137820445103511677389833528333774615819623386818628740717298536494682907957395546580698201604106927327775687515500702167640516494321093607658740555626087742500548055556109717233840752726818340367471889719504556658410094690598210623689999413499542711368918849790853169852433282466319944499702346029895927047230598728333347063067680497980164475737674848478236669942361253623342413435040898719242180195871336853643160547141406774016462136894219195337557699202434154826713382598621619241081842434517788073869353443815883512784162878996713976405574788540422292028138662106932224766422110629024647840989645949097635380440093760611619444908853992822103853961680759921357300659914522736132497333111676197806873536516710365477178603900218811204877383528320369378574121409810606883778737731729884761834210251749581639311246982680835097497038831351969041734909828566751205161402560396893154659392768898738083277903358001160804603760220234849538400861075988455010252397734145547675487244809468934183314542809298507501238898642588241890203074615054999971089211803676993786893986730337518218607663769671299672100976787439317641313130815000163861667828086380368183114403076461375294990075923700448296719110384342871305819750066907752286571133554556136275620044846878120490667026099062173756072848885894251105062198195467498192599318045561386468025711448675208671367306483628503719847778742752276249571395631686848264831036894606181038624215495527331826789006147255819687631795021301160309819207273830754454571919290813141745739488831945808531426216338455914553768909983238073872843752578087168930251735113374501342685823151466165226050706700906794961971385414390674577945957917727389608241633299346044564998233163204550685985483886607548738056318706337438288559717842731157220095794530163721364519498028096211245707668697082426902147077893377994457386056429847206971419237150889915072743078469156867939794917447735276784698362322176229418948423194165408506324792091631852127493689094767503517943702094946641404334981763192299997386681179888455337064393381552266650987744995088440036024429067253776701886163061788152111001629061842679572692661107350022451131564038401982617754286625078434870736807822153326861717024220909546032617851133608857825653766455237910369345138256283004829933378009683251093769873354153139758658806349535263406048273649879027961945003092228324266965235532190538247721044262487366580905567637142763335785189839272164360519481684193187902448768636863734949578565729009825575019768392248787681227124949080590091468791399220653766421764655417025096716637788317507453154997843255815504030723093154797333042000474883164059933396689708157182447594328886737416502114069918769075306448311805012848043359521460125343004724030843019227439758790112007830532064958803491115022204009320311574103306364852384694740516405318686628335243182959351176072196974442045806148815251003762415598485827846458278991401881461652138774535666299670483611397964040193016513319502332513644347052613688033312497661519749730166007378570043933143583938588838992589669055399513124225883269638179328380347087291184995432867548162743535590716650894089205647352232634166446504161783015107835426665115599769011271251371787736493937810272299988608639356821952000222860712301457213061312248003864652687678924504309826697669102006073312931600958191553439878754910463859339185224563617652567300686818392779130875465461461676107047761879471013380996147149779797450081059775134071618533941216259046736511321883105844714544814939370796476875055987790247158195991841361637042184788178687017108831627937635395107393883518553302851246754208069933534951523227491528798860212901576851811271709979677659452444037525133872562153694848324616738550122470949372517110352207675411484203679164300849735918553177243568129449051395578743952147657513929866358204652512165116918595143087522542152559464660493512907428447740567928890594299991793316086416148646719580451407500844524402920468221173871096727288426104854935688037383485162053457069881809999635777326483345004026610189719592162953694663406583358560699587754143749902662683216939474913154549217574033231088927243458771316345587302196827328117797254839600849381541060173291955098914188596445535299451390571456512344176937928066804993066268265723722925041272991885442774594944831281896792407400531609949898395161080574578861029919740280271209711828136085828859233947917261349199607475223838893344646853103552448771682355688229358569028139894001852981399847448612675170766656613748153528084804555781095784219823991093243852090955418293365688573326846519392299088330665187489052592061589079334291808640821495646918217524682399301408911243289392870411159910044563547630710037388444251324339418834154881717593871907442166662861363417925538385303121780053240524735393487821138107986190650332321700239855058073005640189768768349449559345709824881244576488737155604622434570159497606883545727707278429753972513365718938777364999498855259618527257768827439900379637363064247527466448024651357469633790006865692135098324547215560574194755338883261385911192016480173603176193554995431351917851126910931090455055128520518876469595881468232103442002495490338866289874290877314203153329816205057916225315063823937766508471806513685047634307091456645188825138529135386823697143987152601346791471983150676689539176745944921207527294077870207993109908182074489774064403475021408950627182880271223407779421943139417484904882229462023629893009387896510648504622466900337125383022999940712616027913229566750629695982355953184822032243120419428909643188973455283911900589464149476199210821849910390291586650120449269783405807952993458547306191243525018028750880533506471576616774642968407651608199296206227006347240642699710122867303305841194729053388408684117456240211252409936759724246678927915678133992146393201245845801843932612983087421241505555557921597558265122435275136672570626049693800485335682392189776401018339854554968527435109319946551088828221490876493149939985799319366936479170079600514219783589164695359636102779344309297593708540308148879817735498301100890830724381637021177988570174628211153051939527639946621393908785449763671836749391404583215917334695194419697272957171842147053556193204953434706173676012690468434024430974381967484623424421842614840522746796470582155452168342486212290258662643163716429643613381089518562528679105017858891860632847437760441342839677835704214878352858544277062374436541795274240734934941378458570696809776099299970202769672776716110806899676195691444991833109651420869033039668420064558399531442297368618289043516664140831934984183286674607690372602911978371621367388148618660549367053696481094922273896050585221831911200852658290636139729116094135685325370690297145591850632625680416249264785830195647587378731938509560823625474160410031667053276888449522300724318904417551693972685457542517406471198287060497676705479265354335938594155661205034844926927870427878842221517879490041463902206508200730773354390627464999924020003239118291054196455622674136452837342893824197322846714732524293071986455241135908282215919774134408289835102170576367994949474298581479359206831698477429248241941808313750321005842602786733088853025742319649092124259996601988716260114550641248205318988718938794503510948176643324900706957497139928226213220181425492920139296353206620551975843179860786147662911761985977700430185339472283041513684257274556050515941728351900885572186749747715971348867772673874083102686791614239245944545805570117187112144655245731513498012240537785903379998226620822378031283885990365566416285823996766916358442840494332097604327814244409815559785441178939985892918819775153259761732565491629123302491892024416997682038244846731338354656733627544564093332642046420372388229186749729883961321191516124474879278900423500612542969063982173475404811807829039735164840886647853828504995981470889073792764952711292979104694255545808536682697792222687752087600455100617605112393715448737485634813210364425206925273174335625116239736258862954564934399396119692892587673856726895971260405402729779147993293106509091076253648777304976835113975812772857749719300124596936847593049970063169261252118458532892738578895425084474214445509058195065041059305773813115022464037114241643943531667110181876358168710587844939841830513489753155360600168192227097122067460708923379812014759348883731307150040737271442458988184577148975617363268838743654518305175270288097815938313785116474659431803078041187122083462726835465950166493384933585601800377476625019311951046183423908273604592783858765251101082994324031758986509125376949134007589134417150940772107570442568442132362074489710567091402181251174933713823861010829319371322930648619872646319199173984769701563124151620163449157376462684096605421489433214258661796664470728130771819058722544542339123427950750744969981383386620866561779865187715065153357556346384344293614697700081108439789801729536997400374505374408167359117982111033249728661364467096117530391646366572304813118400548574024181552210603322674796107542124818701994897731625143445382235692896191707086319311799745567875966574869564551073087944189067851180681929276404513886467791908173620981937854799824931467303259776964563104056237942799588767211570165031191759733864483294218207674703278821215136206656433377619981157705598631145249466907670342532509205489494533152323530782562070662281222344723208459213736658368106825956188693905519338012286628881864597409446580652520974672240337817425928524576809524076305735055870267277661788120611494464733304676487523183857475842239602568724804619023928202268706469477317886551638339741761733713650490754556904486380046302881088477918513307856649446455169991201600401784479934486475918433564182208897215589019024822739110986322671510127661579192773904467702403219279614998496209904007556158202631581647930335858282220309811863515442647877688726807168327428813473564535242842419729673781890813461571662158474357639451618918331742419852169556903118181989231484252168323698275678662774679704597740591848770552170722673857297131065095390048258769023672513079614997350939786805390350200367175843588544112682819032785654351676650198987766395948991025431643876335211112440960904570792282582858498284505962187456114820288083130278111438837254012470939253631473912467601842845414146126100433144744853209488626319944761076945711168706974011490612605929221571225181320979769308597692919632741646410145766983892312848181660336554282372718182259622674879238300398400730967734433835543650718340778045408979236463839732833180197296987891170756214893024435022522643291593064525921050346907417299800547048735269469926408519794626448519594748182073029884385466171505683128726119064934935408872248132301685771112956727259366271353596666710719924473858722623437365813917343132130033476057478630270029844765401718237181287246758963028583606005975692790484149229579443660928744863138946133549224650676320905252757479208807530889866041855450482662253807269376679361763804330687471742681473837604115602386640554131887831535581826904351076093832976507694213079726918486297122264811673688782210227916375379946858563523394684209887168510294428930438015856211064347888758002971723992314511727282969603934453895065887059760909739340766758190509855231214985192863796680677029544375899981729580600019046384936022053920763645051659866560945371427717484858590549419945677992992312561024536016208047028185854967952177487293627376307117864829871613328489053671073124602366642105762927845402095336321499916637281448852149161606422304205365895470913962324603618627992476405542261267188979031408516766420909955064267628343445249150045645386270696088376831553656597478764674670348582775141225988861074632430459582774329929763284273272087046473401637129749419327437770539296822870021664120399101054376421318076613918347191963089640370335699668951324656558204985011055012927178971243749257801864472775674299999767697018138827624548561766647563238621187555546585779328681713364228835934570287878995783366996925910410536683808940329437645436103771905315419361382744040785048416707736108590981797468444408821421071601807355884471496833456453444999675308165648340776019330817862812958711049685289601501051377423559888139943926343165274112057759911862949583948585232553301249638653363850260955141181346125027983711602651132033987910183693806306073617978856906798242958873246324047750006966007099787711468622473699656972383514553574280058470872720138107262632230053512926014773827897884368586400836638425400795851079017541909327443538979791035139891012555257818685026261045096913442153181559214619914550110181717745823482272941978807505163408820970991222765741329821488950950677793637937640678150757344431600261263043649697809390940759256597801516754226667220927093106270976888970223496464732496591789956760638917103486485982741228329105101378794593542950657030303187788790576459519769685747658212790079197520388856610382375456277366319764968933106105935023512570586473632221856442144273999234615631573320367014514576792699263837750048534384689012856213981428394412461387934722370991196092919126150494457056328696194925050345362884962293849440529377489401743131949389302410083047532459492681765340148113917467294780944258257130925195229809274043685633334491173615644291529183497048420235467495603762370034449152371088444489204220469438388934111507809015201312597540476088797360459411434306376728324815085667818711664889321895507675828306233265994579536075930456017187321492632616270045918646669955588675709128722248577269527854908621810108834218678436661110446426107339229846387463990894850870112151633946217764769028870064896740427040335705826252813061500118342692635946856012378544458948434209422973671941368219791613107749321079483647106630921021777934618606098066820275372495535268722010078934249951332325280278934618922029307937419166222486061002730499045616645434140374469629447659355345454513134533928827760219571629980648792904789396935980319437028120937487395787440248779134166831878549692218762797429175416158519716363166187823714272743451870774296058719823999854905827640427846217770823202670441418876498346313095577921055648568596876406313908428199836037459026336832543365337951587859579307881130818098154649600886132656525210003319124293877958226282843852503720412192773329287582864825716043288739516739125820453507025367761154068168181982884873597751251889438818484344951423506020145042392265909356514889356278561952930447130356418983015594911710456900643105299414462929245288277665714725258219913412977475946549919153897375651530055069314748222993423277512104140736972143892892718155591351608437018529100076075318500864510703556275398102320324452898474825277597420917980943521721648726156077521579670359257281211621192296060318909582480056253147924641898963073524212150592789739671751513072862782938263230976365274261196287700884747166673511333723922095478699406929311306999147419800225965075066778109895451283030994221329274987910776162133388766432557898124205339738443244208293026133882400361504330810205783245221246550145375760858908100839321775041236622943472128631350473068484097833708740564795102890680704886605287597482727705952867098422904269502288881357598711146383630157917221076342308037181342103075602037237725221481117552688449430371333393483663546288516088070780279947857648150313607694551825683119404420170149321862827386119654957607654217877432976782841351225434305982160174995449499172431484541727977847275799102145802849754483461087507885792457615134320112204283313531538007923026238776895717398026942554559845563776423534970269747292404291814028738758610567183865785691055263080427877882505080141590368669767515188814999971065301454123447028710418474691949733464609469861406656138702372553391757387543755253315915898799495753200629413286297352733056081723926051949231584829864920460156951464914581639964500964765035033488531526623806411324845660703306367966960365048261723302828723233122564625784164568695804959000015359173336287505206214548883223647294820056270683073247582162085276955361604209731698689716474090159172550123107627769124973277489219764697574691698534331081298150081254156813885833343462848396893246226268977945541042751831660322289490729470856989021760949937216222673708725152764756789237354105668991853614262813315672298538581947644700461321360706126877295522379011951280259344678457382240282179634394067492172024341454164904612102469664394110211541876446435720197065410092636047389630549249301709354366943017640759169900320850716781792010020444669518337092476010543386087759185570133446932443639509223307105946009178998231595818889268406802116296594735157648326598464884854022702893739194773248781863914889749674581203103992802362704876795452108859516380881329936918090393477240124780949064427317833294099875704661801658808971929241109941527544324120070556889256990773980451389495574534549644784510396312853464068112196089930857375821574084942730482405209985240204791311186193109288367197348629537826856631788104382336503642500253227307975831044241194733233570049114744879759921510262217464573324208456243531072572312462314301821591086593948048285681018328414903916718395453241397584140681960548250600683531384837025901899364651134528570442530996738872533927222416027709211261662904864250790902401549963896800217681126593420146053398577322579476912314583044924481723155283783053217388954340169726979953508150325404596874658198405451646197679282084489924727840424384439497232255399102116260405257923243345552428704018662888235577702916969751691980772787363933776119222325944925235671360595697324815239742059355993389957934625071599031123634889064316044033554209065098407073594528436505439421848757167549486448810638155727298918800390470774177864818161514587854885051631893839379345764189510254580190914163240997442879148891913933749123799164620308179942056049831187217217979221484883723764337210162598388664136519253447962068279470581020973719117265710161583987189911328763855014625630265408623233067178531076686440239343448839433566314485282397828949775360153238579164421174026514419094352679727973343524511663908107210284470411079503711066589862364794000889301346465141425938659964410872291770844572899396933175849856065623726533806165596721432008739078503613648125222013922871757760594395088032181867776860660162505874472966827119806776705102421049577164386943886122707761328911974109482038309700777621460752010252941643715359137219215038695045115122139347800043404400633594572576728306542233802991356653472096370637355410654273490835474248365927470086325915473863882673377297883534162036173984925654140261511039816246789307831095088093253784151105848932657684808467081550423197896678687205635215464669198370481639041857341430849774445064792954290768581098462660545268718604088651110337961401080519831420326620267546235613336241629803802066808652969835081599101945119825988267971166642624798694321874091741802302994696380567076872198618487445826340617721202341861568521544287547862961559005873877481253109843266667103309321129590100539530425690534178713549617882319588116620707964688002413720846376332045534481338495701702487833417534104632002615701291819214277162841874715358812568831766843175063787113256314835505885839519248355022792854218814310031575136835585090431354735363272685979204028266640262147725147958630353425693249213891817048609026437155909075213090013413254215405924789810373450169620277446358808781088301660396442812600674143632093718416886090120603384588876417072023137828980813316004513979597011659037559963435134447086890643971611800942645813695397976536273747814003283252911993110791629293063464642748952577749680085946648285783589406878881886174053699019882132412320412224821124161647570703187632276937685662946399391200155217336083401380354759017253488324327443146764575335484749326492632422519050733977615610663461804418103132416474715665989942268095659152832850266713123202825797291909357902799872372001380038021164173811589381378957344328152174353938297221935067964028425853523831991299785877722368496341866732157596547216348117503868852823292938500789854479996984969116045102662960977456889669855676400881017438104005865304245926983663351998917774077840442470446729122251313183079837233861348290277890712026808867266058498884841579802637057313756373832522704070072034713326858152684075619905176430215170165723248965515266262146515051658120353775329722278241480240545290432737727031257768497607762646423939681231419127433732163663288522151630248266255403475837266957421651268518072016631260078735139499343123015794414797105896556368284021222401948951841760570068123720440590041904417272958195005042329599229747703403295200331501780552585571087685123872139993229786242263130911673736236869785558954392615459502698527769848926687050730191329772915476490700585215514339288685468479319176573089276952297161492496657426415426995648246912406530630894431909259580396159224430296013618453202190412608838038953359699215285964663466409216618687866624673324953653153780864080341017086421478470836104370973333593466367901821078888671849348470921517750086495862514868076739032491621545752662332070289172941344421440614317310104501881805832813816922860951422217574947741234886591625959663790405125865269321185007747566377721111370220297094395883715400941759945623323854393313913183875911301047443097671877477976876192551932787731746710794575993892863217823479025493156962521358861386137564769134480225754123445545169996932282019425879286359893603189681972523882903047936348187635169529061507134895329777282015114332406920068087414788763113966092077631424711115695438961942678473773247000679155495950939069453891187342778473280425150093004417203761216561081224405676056047393574544684835408866015660140213736061043119485064221543174154306657883473091446836176257681137578011454593677219743546334590099959004025831663547278867841159482178324607875711359414754623005017576896147081622726692929447181580127875007138154941252707665833290329708434674936985864458847615331784116298580721662806534963360929026005347849826081494844096646095839227710471611453976893199989924259146863571321758299099522823794587917871487950653260535979376938075483144750117462811394856242664178391205688194352149498179695419592471789080231955949388637984753207567470976296629592971971838770454121622415171863606479701929750360081537939565445103739054172347828875702893652934592136414151825367743394598735575194069602650163684754960196924322370906372118168670067620129257092779616937108835307344846279064836912091005494691294959207126540361907499546852004730165178016956443817209241736115790572927818747644105074068490260370215681987179731677346763819098947509530279012169015741766420997111677943322046472519297137785328460898678633414668222608207267679577384080197504685453879816320315383795029770594872161872823736174176850608897583695922090426502494469489787792455892373093179812343447076113945457742137278987260078530187652016563549376840747256694087465084089910766449269662495153116125851897804868178691701446375954053402184988725011727624410591959310354760153708911615472400822495978903527481275601924153932243489461393885896991349939990128995914826740938042219441224118610187338423863013783080030989410692218540914618080070726030851566104662547160786208179266315227793750854239495071352817478367577325891811995311729704351525841775885125754391186376347592698191321361885383311079427299558310360890479480862776092681940267355876860611726421255954329049377697619509078672384295084435829488235790539441855978620014275344856173569295902797532542405717337543639647526224162617763559093443698919791935400429767194843967614966978594996104266301906803311086839294428059768578248522637071496586857811501852851204125742740915548653476708609032495245794713228846207481960702295749819168785468515473375989732846648350972513978068681749009731289195616122789870267416964278011803105875695466127685450940700995181367310735259309501237377842494203580763304686949137892139478677167711238516588395688372739770641074608221499559261366048517819508152600993129461338302339608035399664414156809130160513321524705945970256662675130322907126752824315935512766591034179731267902527621565770676585745033774771955387127299022721115726745823309792952112640837407150217995996003967519552638990836701510327507533133105831110452421616098324471074147031036282587150679438176497944336767475467194640321159452382975308166165197663080428659750123222905436454781509069744933655934000479976026909702254774865521906903827374560798931883334752402037820855220531892881716179752096647117265821138866169348944972375823330683621887998172236185602336197609283295917327647282351494255434174140554580236683317482760978372327356052063349860285507650363092717622715796142651547201858401224911761411633220558358753831689551330718908985982630978162174522744064688942892127094937582536858575730265657447037360178000207068469440036205042472058269651466540677779234135609575061742405944454933795769476526986580765426969934543785397823714400673444501813883429130851737251351867321228556615770941320810830688079554000878743241537983228273704875012884971482702919240564820438148559300453038646784251640926763027361458648096477428720938004347562193339609705565089515685010852259817573202679944464965511343087339383926056158316891801090074831662088978993214441657649536832179814780163596084259615174303223595862195480111835563550204123176366919623009240638521176754936106803528350207062143877555299368109096731945281937848994034984245957392136862931958230361107367173046647132015081785790980486105141179485041906364999660105047070679697041219001128087104555748634034256233117126641464904055463178528801653800857660673307437637429077401208500671928945514853234376570509961871433246566969415828708128549608543489417128052042184735083684359591013002857596130847535338129697080176184429064657334340485896507504821248799887969044003342416733564569919668427126527158719583494070916112586037500826489437919078906570088519532583617488991652726609273490390351174439571809491849079940994092973892775856019904163880811147765864928078512149812491531308685077550167001783589862225683557875886407551671578453027188201485964094607276435136533149965707845483291397520440218314064062162151170605909099539685992007409998028734447241725174175681589108284738607136179449215464565921169606278703962478915503948799623101848729606363063459355159465071291091130448539943327096396230101074723765441321071361452038313114138369569130099391403702450858163578693800888851103997495515945679800370948270581402112456978751700357717628065537516839886930685698123584469743235632267529115472761921064992117236183866516211642598692932561560081393586808028778886722179540512271502780054033558563157313634662382201026703119742780586875219802123908767408948384475375874225747522919732716964297779238405591227358904042828857599469822393239751629389726612822396991066137237113490612853082486323523483156482384764252129448942094923337790004917604539409643236436424438598745936452807461349552380464719543211125845491957813562248216900858692807149618529933963318392674949852479713959927638126040938278954702079822176978629707627980729191229538957770716638142476197529486717934942811995086720883641496749657314513454805149101455990461420497282687176742205648774487658182694350450921697190280666662193778849527323275238311552888374373578701030859804060684427251120312896502906558537339455041996008074298496668558874247931337646339971462860882631830816325746253343058338986003295057896915105395549560663491784264375311676929864204733531805755756008806444437232071822750008308876144138681974398510272810955836733798490679525856413570639732856663024325558900608194659410348972257198641883119472789920186234416596524763725387503025155585684996512552063848991058865055199202265326719973850636355519918697247654338785234641002737800271523757871983688993430981306964281738906450698757239172722713602450361403235601486122427262259676109497943602153309700508879083314068575366610946891913205907144319446426362339771559660675358073620460097554711481929191993397953480468837261682367230699755817921395569883127080803723131718057803339706633828671866509439359793729663910763437945609995635960600183598392842107834760136995542446805809797302968625336127150682067151804340792896658581025499656180609283777867703736128729141168754864569393196665387966177596081740898660478347140659122904734530486414986621784065222943935421424096647214656145086994923200708121564500928937799495163580737745874795164284737279883551937028480720017940920982923039052436836975673857769673559058216353923876048454111510860964954107030225940906119154840977674546652493618325540162239320121817338230718306255050938728153439554956041905094640032346577102702313858815486873081020080360151140545388928976057472852147435821219580429695192351648258225409582201912005340160904222039827119082086537810804835356772388038644354114679991171035636172656541143718627549569278533253034296621649084093184793729362863683891783073029036728725459465444779187605316215637236918933862105446422505966841517703533050940165662752841082472651820343938249062932221720577611018194543152352381511564957649823638870872615340107044187770093267568682102189731113450868878536401288675153532851393629388989667944301838197867422951205718681515125117975177755617742698387950864553686604098230933740736752660292878051757225508718583151516158481347152075092363701670189178650031576416826450426768807922148059118346163611028246244089257379900081197512187850096679027041109085518646672147411701848839173628325546093086352048475409524078679133034226269588638499394092917119573693078648838532647421914518722479243376092089958451244241501978136967144386237810135427584422333978508544287893555926181502239766302577557242619161693048923720346423973318180485706917478796878481507556202685709030157891562542312866968814076600646614612798428742602823385317609538347513465399713172642875406455401844069069289396044805241431115521713596088112977307901157368842779440141081193996280213930270204805011351242210297161343035885777886732136074773822716118582902328959590191141280476232522524010872254067093781971628642411780287204469157622227309641512970095318217164468574684330588450481089597345897865755443636194397193311281061967710458698608205879064913674321798804795272896492265436111837940770887597316461619514971997658090914587178365989563781982762572877933938305815809855961022243999918886796760884739813951647000413656990963920898457512096841550061307083215104867146445451259440020768518478275811248467558604569944460761321068311196258128072338554926693371322247663601200751008222606246292980143131070943229157758185248088471655381367711471363291512054263553671845418842353310861666700240473466521682445294562417244507486797381858352081175070772390618688818226800498023832194907212282500181378496108710795778101953933217082622767927342286721714789909132810389398107121049489386268687754391738711092089747953533980843119275271320079741693701370747547307375841722628965641524595710192291149832268537382416394196421716213367103715212528636403891228452235806052897546616057505881030584549279786169169114882064506186766175521192585031383883720415524760608195198320689028939884508961417194028673283654101287240740386298530921533058869337268804975602762368512496526620715602150279016711600326405932051380763855396853268523596675653054999449720089275549341359865894688132866814300079669002886660384116423095987606728077093257419339290024885030205249320909161884474384840973464407544495005595628365854536069379144160901986322498607696829620531738642648940827461819650739982749068841816101021717019617236869657318331020104104406366618490376080902379023261413259108029541466178033043726145191567928762329589365522112578972373502229615424256850164417776231413406254694150543775389430942230988879403775470830331602440787575050915164766802701954652721208856464620421331231926033812564181678396408370206707573134051089144717526614345885828360390285635644638117584579131143016691427778380604370541185537699874455372963518332588003311968606930061232999692310665189623467712599599177213160514341910649353368740966991625969685381173735118571599865004658092395854274548009276045653712694432461870988868768993023718896930428128610881299631172853131845186615294577190022599635112005915162757147288803270277158734053841637084321941891057990776738661529172562614694957745346250878684528794957656492700987211813834205383132149166071441395777426082102950982013125613661425236675518415081371754251056182463318728592982346717652843670238323026683646286032451557218140532649348562512499814380990257875925662728003852487596257028012185302050497820682187427094243113517132849385036675644652355032616016708274726064960312402901436974216101891012875458267392621226444806061004444770989744715067290038410750958456850696574737288872327810159775525051679645140954265730703005296237218139105129437658040811417120469204079709293203317523008060941890679704442450484145847070275358278687208716928723862099683776983769248500414380475989948195498713913190821633278668442333071561958018214651711549881482608832843420124836747417674630721078244647236111612636539145065127204007043498201705532865653664306111945768593605052238024292018620935525545686261331194146241901635383846254585564567472540875828330252604184204582574574584655297632200932024747657360654732190858287461711358085627102952359144186738388778969457339305392559697683602320790934990080704606946076402828383934218948123556374970661902522038374763843915308069346951582990012405152238638716595140130764429841236695089093891015893368541763617138495995988207122584939413600222518280996406954525418429155435432833450674203861705663060446501412170386908244781633617876461459865039445233128036439410432744154470509877600163239798709587339998483349685094100679383847083014079966752052293823853625805083649241673199619191290374074862480429916617068852984912228744182023276106149734894291881046332760872111740575771461567979264632106235051383804585523453691934326671125984514457957209909822286224571045656297222376709677745471115267378877318568391804234622560941801828798631648364391546963048160140346503821976863566723892929566203264594880358208136943325922701152808911168569562920594867819008808183710488300822746325652189568228887370276409319770255582279103438901969077804613213480386558334047786791498739687893455406118070788149317236711758862486719438956667961537573302033073914563828052356311312454900253519146832301423961674518248747826476877719477383864824695823579893366551422996179318748230757390690474916580130034350137048782907837927462584979374365031738069179534163185823240098328082165856084843230799982180124865226800319774993584169472783828864895188772239670786768359978667411413342547824849666064393373934424108605444021682822554034476406681098935268592108315409358688512755783479211000272373004505056307179985353377515483534265455322809777790170709180292682439866793414050849929758813100809522174994901324468682243028128600014603398274504361833853755921391210060658744686083847780991363142837939206574067506118081005911658932771986079328660680296273785447324604982875796824883346268362880552286328626912141045036053649333061195512095979199828384987121881160082373576062302848971113754502209721647782277886994812711280507093898256833996916492899381712683724576423378060620807667504373263405101732226112607031147191509063847219521686547849139574084124357265737413453851804085214683102130539923010929005815117990428345457347311489417845411127067332390398345756996559992653925054905684067952974321783668020519834598449360634198483614625982048186985786583197130123255788578189347302487724898456204753461732864996319619983347736908688752307592612137103800021826058067005992658246903011939171428492150001486615466585296556680454060974739805850845583523047359082932004817623963089383212574669700865174658094205154280572611409643131062193941598844065308660665641865163180958352645388894584926611726691567628507552521650553343058617816136475798679908238985051599171460727481350567947740142417551223751332631606899651708771814833750577029547384499040485237362739810792315391809094775893561170532737577037447462653081868091226259126987268478425286258849425027750767103054577499451861126599554390712248178802526208062671657614783232398412350501900482541263479098579464905181728922106037601932757621352515503591519534159937323659462351432860709766039892385435250398446716954620063597722612950438745431665639362463777120020285413078328532899312917141308993759524506732694923681294959364465426636340513550778844786064457816194010160238734819778318664203535365441434283940753120547456637173676047702875289926526947705411276776529763101397860066299317179073387211140537940183025042385392966970949013913709290188784119823852762837739018729803993730150207752626745046446990750942793116529235361830854105291049807594295545576658348321710973919296457152379499436036004033872775595361163139122749401659630744497815835165298117251015487962257524312141319013517901115176188834123387615236299444632437639213657602728991518176961365719030996137215956042085192093637617856818513165260545268307172544406679449799446600862368684345498805942543658399498124486103674854275226261627794956386088280869227623106928753548549899275781360972926154911623870349814947217286299779626808728457665427995064377002573342259840696032306042313950420490908939321549998864411446912555447026558651391357664256671358506352974013794610461589660906210555023924272616973924091658015147796676870494197320090719312373559329089476965248958743328271050501102195963683538805042194533253346325495403657124904180106196232634050415435841457223198207362683773286327605434280943207052987367976649546596718802572332011293447078211586996882302817353312923730214355009173514278260576483361575134737778583531071655357484955487373109969464058189478085641374371918928115516946776362487706746088535879618296401835360759601347195892848761109188664557421959508049438733649229944496567079909657801424859580505265008497697714728020174772423767840426116151057697459438685231046343549125851305387417633811433536585058329049709292157710495393099287641568300370968720414219069088604770458438379896481512402227330633690495439067634175143997320427583582849668015554177258394969612051760981778278476953118231646538341841045708643046710393732996848378790892454685728936617131993256816544484043149244500796248402479036916349370115188597598272480463359245002487309468837908921967770345652674473667018344120939648580053900323390965203885200941837173899159108131082493377405893940821508385457391095860873894028778035431164358408276857383543763498697865732617748859315885741147209216588720437732003532543650301498626018959009794193382046819964802183948370546793289723264762268128287463323175090243526320737244031642517147927186043397955884202849616085948668108418872510150284043700690249719595967504125056038280879009484601308805684437705591508867946132450290594909609271005574844512685080652228175929359292208471536913190487836916749213093380568583816377716223277204577350433522058859654740031344355465274629347301165751704762495674444785615724260826516326536252506927645771901890527173634548019719452117814202814906878883005130665671522088251221256414727280079999111932423029835877362769904358133213967751453853641232326890592296546027086619391271371845254174756826041931888218167434938853482981007743490405958860402914675347390910894338911237984951627053288595899738984759293961652259273077654102070696165166264886113619283203539657369209009855445997076073278501233064400978460043331754192424830165070292064104535926966100599204959003466256020271024236760636229501084103003942278318606831811178904764984479195107586804445607567652594988111257426348241174552912875772250359121176409247408008374049361314774588835212722249486095331471892060609206411134943005292343358630622915401505504587903166003441183435678061049731696066566471601720186508797091343293156485311935935847338440130068090811139903266513369415277097022288794424310288287132757681029112472579792840715368971266371956966631560990052100487390534267566040993698569714494621569980034025958673465597373553545847037291163379635832196588875848036894003383234226477389303181548950773524841183432622029720775311641087021715573248228052878676726129470033857772594257073160443473791228060526665914815598465077146389383871108783179044629659775897213490870193059182161978320627401910203461150663006016953554997536394003686158435110846885121748894945437374811698939252157138374201216552022154225993330195219883199381453695470241883910999755693417691237057425277516602001241448177693484253377873161168045763141805562160948164341406008989840221938150420418018036134611651039844564845025227835880463213318233434298095387681875983098787591893491532490690035943817965511656500704040733052846380653489814080699632965576990991309244500485811384186674970503070276322139586321647400137354259082035202898195558051477245410412921169973569946551783739771576593719207311970054659148327894512405152236645781571519819043453289543871067556115205120623072909205174841815798112636005887822016858678330459127990201261096271322502252637072092565234155185562349589037831506208150543556183121008314661433114691042982502760323155579613322460905455217931971341802268309060197402057426974677093284327010276248615912768417612063587499399979953541614902141135463001281155556944472095556108991309430429716841615578276239966847137884843330746086441746949098369863386743732426542379564816223563099531739659621008150911843886939495181575551539793420734011567218706047713250590829925345448596637236040234171382999457855503536278175786581987608483609985396869154308711520005766067946204014236782244238309596473697108178954931394293394683218844864958990694289880199197817732130149663581401592659733306619539863170928996455942349188441261877221731402715581040277603298824840564168058174406978529873106654188104488511307403890143046157228746234285755497951655542959353014116008351606116874567410012563121505692645238020666677047393758338081618776492288060805921802805116858917605822759481714472398675330085584241854535534565878862119336079931355775875269757006517960794309158797537356902457982156755300095442738402271996656322803874490526990652143422427431872318138658312103481321096275374693102791463759384429385442777904393276770712237573225648474591794672310156192383146875310367713378161720585552484511232230288686929647940229935497853181643011843534526724282888986857753508056922739359270424321957211445154786789730831028371877360697802309441213091194755705559721409950513167605243567349552788469524251563337399790080030247466323861871594492916264031128413988092802454974044980920905434699997721113158660096155112877421829072793283417553191528798345750583228083466036193324524836020725575349213583418313092869035245783625432762402278476250923822290101194369509088921274713748936032463719188179859942850204477727098699963632509424958413899899153398560551684058136351489907278642101577090251665368190172192219010123016781324054484084223582236131617352993778276200436193418680195329857779334147645744657642482294431265851125875524025937167950150549688595681256449261011906560097208774436500167451500996919947365206523263979269382539603235543970557516995121788494877838967140597787455241426550026499280086200574814217266100266482721431083593339764438633755311651454759005639469050253294857250062409013386727612678186531536823074943305390447434577700319962460215530284587795514889174298136452494796506383774410968337920414770783682276937405972805348708337507376701841958706928251336722560641726328603901007037862470043837879188250388207532769404967719216054137383046599616145104687429623897210838351974882475143129530096737052305242563764387854087881473985551890529147802171546858032877021845249492123912221021475148065464166895211874271387006323960753766777843382559718247631972256459889033146011027622593792591270638407630893255320138252172313889219559180170118187530711260149804722681753037234958543744244372311030518124536445349832976474816218719863502043768868913173448431796761618380995187709977901327954372230953206843485084891142647037874395643436479607916895579631384776240418829878340443612231265867954485627601050378742188281854154444469030571312813503696283751259898810336518503554602422011510058524421998295560280447948102793103999515409636277090184941676122877145951347816526675607561266478864140320792972034694618064282952406598926711833690642316785080865081540650371555908765889769848520356617259739730023580035021872507586457111458026767176223513007245692389028826481657649535941304358575394167705841349415316185179867018166691148761519471376553475134877426793554158614141150865460241112765491247957685580392154018238534450011190298537816591772864777033401259325534232887961310165503731460508791078458396808575387876747262487209956688882343806640067921787063440353425832784971828027092906783669978787154328891965965659330994625782642634570540683449968775497611009313024428030894405478992320727496913569012918829927684467084728411367035992483815105660381445276844431567549293963025687870480731951281643444498808900146416011416956611375006795364426296792970111861568667896706894987870280534968833767082480339516625262971440602998091971673458135629199402241302626932900763090040692422523505105422085401894090413525714608822046283176028861340251475892725673432987247699331657020777910394647920818768295501250053011761552204606158682035220689306282894809968463962286632459817338720382144829176718614703682295221052272917984567081461848735481565076998974007706969414916432014903996101513061255583222504876425484194796244806769653604406754769404628657303537949944004210801761647537095826665735220893175544405659382117601406695790784969820926244504926071316062831651162698237916839462039592336153173092999479470620391485463978540146718826929449641313608125120988319601161951117794299271513831813509574357936443986355178023209505204132352044473703515632696031719489433267461470875066839915554418700049860201924488009827135048049024331736912382405073848241207598821809815170889102583401018445522085179134787139818320244893463395604365551878655375299518077946599972988810345655234303811951968970799292709863509478591504371014967654512907018758216575689047880395114572921803759907926000932681255132443814108851163063959455738823525663748565053866699896176571599422961753404641506475789525497076479312874060300840510286362532945331499582366408359792356237638136583554001284116199161231395984473066961806829163025642101952502260906779723391512125721953457316629176292828952560310804700289782548509257061511928756658639115527131928791541455813039456353978683908767011414323041579190349300374432167646397883224943030263294265625094626733490763052128459598795020420636961458334836350533531896508004793161269306179869729964898967835030187616934457511512536570040474363384893706907592842131053276221786087321479052443881919936639757196809383476718705816984495374899676434828368389673387005535442774186078645860284550569922385544357500344656469673203362959152348458508255153253608999315412192415984343986410710330051042804807739600445915428913690472097946667385392001185945379812956096325139610616053642518368110994037987263140791940431926801288372702466019825602009703821375011620930614624652179741431008230015669220801163651641510145694366362694085214657234598240723754560367699528174213975603253490159287318869281242759203989704953363021616943597039470028401908069702159605232256856616102011499672346409337280454568040213667237549536951046038294657199517249773190523078032767217766415411961981130630942694249845756597011897762540617068883938098562991784437710632382130555194320849979419337733812569300307661411779109246337215286507900955510972778232868419980355401148300485167195469183651517147633917201400714524444065336614750617445035368189184985206777183133951761125220935119510115334824464558576589700992190426073636686353666787681480401331439130250900631861641062221873118564541376823668465333157054424191522160433934582510625678848767851116250083626383181654207836582999666025711952524511405488960331447633439700770768277752011305894454397774178539804436377551048045142859157653666269779426824897284817315751534307143084592509390824099648225654097436200434333091306001551778608104393499536594134436202341050457003402733839940933369533508769366550774468285722612271974965524218118156278879668669328004407073827047131414406093119347799825977295422549514603661074571967416814564533225553393376622766731058410695542321054621901005935245056488151237272198809285682216496258899900108029689109688347280055743096187123612980809303026776590127396005664930707249323376267641455181610793100489987677379199098284551266349813962271203578177847561220204569472260617374815022438763642779815991508418958249147993341761145807297085083861883341650273738821902665367598554088514819873504026189890098282615781899501493178246750734766173551755575717627605342312212251206884459105128841683874225703635169506197563401439282672778801280081714152426861316133621087898860924926518767208637105054623686682211444825079447874208093200832472409294913830192646563876827458572957698102770846141714363144816955883927720129691126020889963905561419709233868082219493742667115873812728036182966645227466300033860749027248076702475107906852975972820823143039807021831237566478305943911167900245120396273908085035384639013549356801705815429497986692346370435523738825351615394914333928644259961038660041298526559588524685910671644199750345482416026293700704956164120882940915521045500075435837089735780757653502641245637162032750862609962182982517339832268268962124776937874997604097663100899048162185082000817414264836186580436917138340330357899120006621270450958879914718268463308623821402625102972692055012046748900184807517013830578452386194786354336924605596323680943037190389284621904242403622198325110796050139311510565927354810910301883659023428950314888112910875473460671568746556751105975939386924871874811495796020238022590117700676347428523105105296850024105152480674713727809801518321186220285345366635842046019796612045373079326777848898062966637478707717678594130514897851155484144477415751126465007316983565046758068663086365291010896408465978669992195104940356987411138206260530457014835492502729260228304795824925024826785103208201599764526034315857546949510442645431456832101879743931969374642366650426606663243349560725229245799053352406184197149393655415614407725252521544893093787117885231772625673971539250028322508085950925164959587511776148002714477181660690856534606750201129091407323631299544124631648786852100603060964945492184333731349190276193274899272294740912176828746528235084544594903151879674852135353394693933470557866945215037341112408266026145764898258662567293656599884127271118434513885551538081894669547312879774233859250450309585452762520508839334952137334428397475509250497344130052594947476809616330652800125598547874847744813422840379424327988551192502076106479596053252302816500882212862452717854645294227241239856859411921921237896771754402239022363000023313263951320865099554144767567809015380047132011667783219466915910381930747908969493299988276640440715757568756506081442697375597542231101106925594452229838681233832674950398423694128012219803107143606395412047058696737045863681328635914884086665264337556973242963901025827810929525018001019875152344477401952222222248143615719189813392814039337685261324517803068990421791019167332663386498722419791772652507383971020529044811433472272606542425376301627143111037684599850740823832549519450890529544844389943467732976140943457173926763846162212132460538922562583412120394636066294279395115442353289326574084837304654675003994265817219685884177457701360792494249942402014993722401654063050636292046395432294216002325232160098574082108161400077730563889951170542587129771597851393103367324798756412754459165170608878982232299422399571964266373568672309131603524558335744947544725314148058068913151672713879228799585861551056956983154763224205961361929481318271384345599002318199608921465701784715125113629951459204076394601487655398590914552214921152957974073312217032738365785914401981942287835202353441218325493413845074305899604334614801681403405045807035487272213656876699243718121534238104383813294546752844199565912335906022394136631407533648993677691412955552166037984777131338739036448752235256881607317457158655485789587198913119913319634337200983718115474201735515762214771396499670920868592794163682913285768489092479555142117616789208400377989036045929898050049726613148638148768086290972399716598778206363389490955250965143795711940408188394635934626278866175342705165610917688311434829281724347695836475731159737090836424995241813733909065325312179444222381893868956697134013074836408818732912187751977241327309793143149799913286075058199390163920866812271804536519813788581239779064015613603290804218556858262663285854461411597778437260317774431450867696150061651305354261287538612160308574636237414907555625576987857153445968599130683162665429951150647341979646430205473565567936011839497927064304401335826769802038496374147917252014918958210954763347671081521433783243864677138341476608628209126947782885849373816458873800776567923876576797507604630505795500647407012851739434186742944840620838128758962675868566528621938346036995320480257987941669663994215240313293224134068545606798568099484637361777658315810570833857686993930469495808341919075306548659238560324206341988429402894212168478464836110925637013379498596466930363546685910341917853636077054433445986028914718240196030467931563084615099709700193525967471968587453639665181694052700146104216455066888552365385916383623731742932507385719747220530272312752553266413246267152934674292504858714576580052625215303881970078398705084244263972999476610941841057448107229986288546034724725122836744391622354136193376973932962658816780811888229198346869356945342506515436034581892855916971787257189558683594033204933164668352607551909626568203600029570709220478432510191985704153072551843048757618618097681082340150400076151012326716591032922694670186756708935848398589804201800953998569310298846365696904108097318086900956786878255632178759529246861213771992147613833234367236475293204959085833289303022502905233254322917731884282083574734261629575965148611314280592838748175610662562442013488173369934657661888488932949595076718485173090300806014766563993397179310035170688335021148623503292868587591404683046118964729473471550625370865336474132803259186477412250807755831988173851517184940821762245908644027687590979044475454695811409467530506147478598499376534805133849315106562737557859275580702077558947045808192925938456191635432086729718151167994033367153878676412290971538228335291744764407601477437805503808924626128886140497942971079967715986783564845235108290188958974497743083943494410832643978390312467044275439157237147348241658439194940711838996745768342636649471059362310701172833442387773330951805105402179210117050040701704860113220860197994501561260578732687446700789508845280540834965360058659945002920079415899436868527947676031163010153822982121281187520772936632794367046482766858453005490067017512688851264934317050304025699604480813392647405098593820734362854277880316316344208526533505277705860264044437685679340045614610874623007874370462287632325007133499776465249441200699281379374407769408947093154133374895584084684560004089644633250484495590231546120589140764587745416962823857259150307351791905734049137443131099012350961864308296160167026335707274091576316614632210215410931774831856680767308284852615536530598122385225873910040233772667144063133768558952027838982291962394033305935852944485447967183126070149999772431992466051520791715932517627705942504317757893736989168154770434658719997801410844235528529898228243608108747438812970660714181302794297548514098717959844663458362292726533285176781146121800598253995846219003962633464139001161221007810581481779516610152003148902843389718636329971087578023590462837113781118705600400325122635063290656719930551412583003571336001947023062819564612449630504213435731298003563004531589053919550396206126632659207699032584238198232454936095105626887666592744299704114320726938268308267396529185225830545107228583200093124476187632396233307238589769142889560468510732773689360340175953372718155181024090065220730130303997302234343569242132203763958679386982482669826215215507783760113644267766562148879835745654786593953642809324466514722704473560205334392711100314560739995170528902399992979572507568899809455324371586514268127715834488693656316835711982325397170864189034124886417917573078442503346204376354266147600229143105664838742085079865074148986672446725126976088880261347497026911121585115840361798999702991627952180057204407487575205465468737359789814069972859216668850206181946695396208037901688910423633255461291261661170190011372513745125037163645350872970305523602521316046170457359378304127599269726113762141150895999793757759886678999877254805898953749106715079457178890946143435039053055105019938685811460975294074553954674486425762019957313936186902793748828196686150750995691102906714931312806224033442023035226283937803412237718059768549505728925881679577336730658573224629677203604841927114942858077253054213108840780363077850276576927328406242772179423364547383636889844856822470218299794726670095985639403742952302348621976135301412805824045095794825423225053091213517426512142162295340500405381138279587488779272221483697598906283385673119621438466475032291479163587860780227963014354742387518435359932188635779696602078996847352162534251537701777718828380902846202598295301191487391499591562782328147817295000732291348929542960204809527992930965720239208715413401654901968801336573650058993516542435662756651624457828949425148871174771293873414723508495596876492736357093370945439761604053287295628020837963718158623688022878180519283983783134696396319122625787711028824311737752196424930715040351722056579273985539621593187765367036541203099327762861024781673604440669416326236248856197853403555120658108513737947935092989772039032147509238318531425265098485612133292246452321108328816495188250835323816396282313804589108001742687282843546112699948580880644431729976101037275614498178653223113780290649949909170319678451385492260371650653577907055787800763883334116516800901532790564248086068431582887223274041759593046607862845375802857561891445804224810575852788605572931335364549742563232386254218400514403058802543300984636665748999071054769842870599969147529676207150687399464699868762092792218547384707388033135324754815512540368473665529024536462027799998508399388633761177508550439500150051965358694393939186602599731333130908015254176884684912116876048791104118523962325394547461251146333090362579891608242577172683732650640081584609046754019206873118334151029377419884100459815468950158465098740031915767541227057876576350585837610040749772957823687002750343151256583763124798581331424184191275802589244173266335552485240573440137635644751101946488907195394490782076829799222943703971276996481939033692863091177248849495961471594410295736727016939675497058207701996362689486504499527947452209670047597643381773774901156460428400899973395773146781700820840646756082701722318346079794442579668481448866540880523535148233586942633197548392408084812939029898022124027091594596530771629637494743503698682944925508978025800053086517712208199642700254634025568716039071991647712296697432281805049753149816379491082994312150762936127310033235801464986163581789345193059565917208982487558479556129827094185252952122903873507438528632768645121638872990668263699128652125347758027174474408725944260058593699701798660752550381571493994571803683943920837033710999999671447618102940688135158799556730321396744906995466525422390960782081775155871461154373099862611191489060944576650821113473844347362205910219594441058319483444724099131346263465489975870527616140897238510429019661871662703544404743155220687642785565809377879084813822028386743837351806704919156667897577515614889701238830734490913174261814586778177511474257339787946733525034256894602629676209228692908627485441371916095289133229481913969170829106615498940228930177748493877162810845243078405668149843216721153855967732487058746397592761719486247364551648084034945247952807937590927021027311435856714715257542712340390544479438543496637030255531773959309486607318817385733561442204556604073026721533767012520934082802981154674929578206634505844780023774413265227853993271643661011469550564115788140676805681165065568511270769594823883185200764270874211390485324620598620088034919579971168310781836336478764069052389006586279926370450194306324060877699522017998267707678056469219120996916294869675341077236141158224363956179762930354321524224135085939662240647342935107577942424581793938479771019461634782333200793153759118202428231942529426021229664235976940349831862648386400450911149770772973144297720112355313095400737957633034963952855008074809608141108907832549129882939282474455116500105584259233431743223907959641536935378168541793799244882498257296070225376899596751174395456234822519926331507967961847786714460232950338772298295882583813213586216205638826431964429492413880334414940832936833663116433595514452085511287183675329944070076312025339490423359159574034195042521232964228970916503704396332526239262682132132059037076335967281825247503728395501876196418218143906958008841430790988504620064917033368723330693335784353730734199906807879604998455393937682384114053955695934126282750692185736327503116219683956646001719596777778725863997712659568510016677273340463043344925403554063004760488019228397517856531421820551360277758606882116761636832885807632395838126226174794891040625785200526693387022378478709531781714986384919338453816828070200068994567707262537342043835124251355859334359224240941821686982527544057348269139795723101260522306351286833900795197205093212666454644762913060964730329118552762727846280600202919394754714250629926432914642524282212020422437505875191235355557017879341729860983549440682121588850792697798686735542959313790311678653833742991807017380456282742331254531586763451667783176659018486032688090923871891319780409962287172992060551417227667093758892331123352465031760170709522424002340003743661105804924732018337819187684721969624334041511610015536651123077038604682516400834638910653821906897488148394944143846295358859989610898871566932244694753960072029992970341483442142970644929514460743449947835237112859919336759899221552848399620653393311035293218230605035187905084507908845430790230908187295342436435190774408150014103085838619018298533911496226127530479213044496513441162612162431377768643790637976509931678271102307929097197659542101973775555243864354141400597223284569945059120359271963335939128581253156023476948868265764084405972326061063256091514656808253770998047943695080957461867381908090929909154400601705587619843279764109012026757097233335525614108679284950284509994898774529098534660558029295788232382788545915274423246809704631508147414664411042758083428042176664194053863549575199387859260831397826153892240531319962550682396791016776953211041138901099425694518192255223871285524633696408139892774239918120983364967870801973935372007672496608086356445881733566488022716430695295421238980056320906082384377136134885841828357193347648805021730777303492373134783331205265417665170617383383386730863443941491752312994337647241230166143583080863807184109987085798038702503906911294034057801361173345233236605834918649430028126121372181567569950419464576515789639274196745123779548456397593550961172621768804898887346506122117553217580896528660377598659941004992407073227270190884524853433332329612821252680045196698866112283551920464469890453456991001991927312831315442327550409840601816135104543883820890034200232587547993295996023494454569872259652586250479535983678752720017853027254024574543836373480460321369082864621167952892904649208829436533006608968842898730784522369690659086972471598749893247800037441820071477600378569160260485189288675821076036130254076750592796735253742253330609120904569699557242901015034286666193384842308745363620810490138365084009238767373369202017234166056249114073593350400467695632532522069412249056866603494179544021217949271783789469487591731021854609428880756019231090745549821303203349690322990960277155133664248524756250006478553586496475041659331772711279515650202736823612909314938384753255068398637370658603797282676584175620874937431166259479635888493339991187701576558342167985576221307142576535307812070352809807217049473261877008855615862036667762946001662123312873729367310673775010189253869920832248735593695634901639915871391168702444719171202146003478088404620386109740368341384648732015859589019587193859773015573573150588960005568338486275933398002844681039184450656189929741512984922959346167097096541581104024666215920447111564393710213009915500491411481295384657891028664614191683585993929388244049804146188445784389376822066866234722649632297734566420966837677227683849690389641486294645785861831867099676162789952240513157929524735302355807295744836274717949615282950212607984438242828057033043859302343878103205311239891301144336794761100752958190097651804895394584150013250959835524701875228235964434639709136300838993418104493623882966512831611874869823818734344936074681651457692806745783013770571147624388385196867061548831200947051685044505956889722280037428290038669430336500828788885913420540566048522268574709342168262137948007171478950807988728584127351388115492492472633755538110194664219155202704748798120676217850972551203777146843861957955717917835999852897365621424717780055106193902547467423536992960603860602077088887706778498004356485716896762471407407384542858219616348040537315933933425084122581380855665791686869068546776371911701457389040147625425276868801105204639936773758931178118662984315208815887175141024718426198327681069574899130043267434011067225037653351213025816290838714917899152694715660168696157797613246596500624196387331526154960575865583574779268385683157007115463089930971496670543817842628820008817952258537706417179325000405598392101554349831750810177783348985923594292914867814484641670364434087182254605929730172123792696719565242109783117032911959956014382232784689134830439157817602767706894608372134651899659093878690913494216028700105361353960261290517186843581713197017120582276985227293955364883350154913024653361019335864812070620365728113223656225845211549429306721514683291604313282740711166237152916064660838102847615927030259514258807962638170915210915334179477777720074336944672944419626181769265683496203302627070664231358056093334801952285272409889947191599501760376601099766391094472944176852619064508043046367150200305420997040529388682839576238353624173760265535753498117954178540030980938657565899217027756953721685855779645622244491668934609897029903991557932284835229112583974881004264239035759675352321758620592639409440285848699421833463127856259573294019377831394901213641066430490233680994953964297307829068055568770216378454113081428900655544862828920662624816339910079983933043385656132944527827372072667722917610487253243785647276406687215873491432944065517248798928453297505656168807956663283200067064256740742875020879781256881595830397114274324194468492502006790439918722456256963879163571391300750975523613713181917150803699516119220430994321048430808729523371913387089542920507949835521626291222769426565084708860553871372008819057471769815926347082823330019357608116402948865949098196160107093322972081583211550246624341925663343313374097762050346248514994185284708641253831777028211767643238165832981916616698651180592003901351181132113161940434187547302099900623630888004516233925735680274789210385523099819620117097551868120133230592144794442909367906250867725108589831751348437115114502419044428205151082697493706407607506796080055326658890202309904559586502249904063476335063674008814063734300156773411256846548412745213541819342626790118877536032882499486177502482584241686547963545187505299549743737642045745070426496372646075155904380518723337060134996738998586575261695422478563109507967625945050361216809835427286165698102631816734342100515210988621297356677020840249130153939770075474889220192071788295850254800593142196803944629182097115526265216394602148465110597207250720925505267110268348595487190944052520755187830954821819303111361158743816048431861474775715667566687738368496235912474072208201348850269696895340955253617510969482095357147556193519530029729832418973807654746353357956792198365510609519999704020240858267408981442627903477509358251195388473945822293436293774228817693979334403236344199534883686597498921773108670513856538127805165698341155334941803683007635467229944138772399922966277408759263627424935421400297085684444096859430998364196576680565998394428096854233214915025469464933653296300767153927796873920270554572215812812577043088429362095664390411409608247244878468868731812728401399813233780302731490447394195567791679899248900117181102064035492026168579412186805187400976523187936099997724629581088818448744658267661163876722447060304839642182481812459606889867568569464212904669722786800919899485611943398081283495358625835489509898912288731979976977428417443111185127682536568759907878363581624164048737683698311526072074596233736253422563470451067136951773667237179332532939800499913199528353168149638156391645593631083039200583199338376117020718455081687363092339174879063962841907664708521078223846981921136647496966673335249615963905895501784503871741836480660448883873809783748987681263573729174822821503005853583226967806620288116461898396567219885584240211424299644230139515828285227125605558924758402992430768881470707574698094175873039252407881540314648954717107032948143216736556255761792436266328218397925686393948443194820644331578645577673304309923312209678694359851598655205364688937955581580964697056932260799218677941804656286311162822181285660579319482797317352210461273484389973813682125781413264503003585269916483332455964319705741480819630582157763961643352095128134336895327454170866532040362994873714696272215116839129119133075871611097360889079926593338326483789654277093445335115013525915784952955834875441492740751650001480749760684752823529794672580371934218480641169227990484232572297342864260144941185757483470092345794794272660086942128456038163264963577379290384330236104832157469734264002615537000341042999073269527764957402715664657484058642016238945008087999579322759621763258521689207343805455562518943153279290873362319369080000520399884707141325738393355814103485466298143417572504492565260576196192552223293095079841082564446097327718411042078248464174219838392330806264107136628979790835730878775990350625787325851720174403275384505233951915089978392117336985557749254634157827418865926571201731122775154416934909378873141102849900027370175167695793531936664953336524010545905178151141968149482772865675557158088010345225925774656577434659792144375699778775579066111355039448874933211025588172192701710978941034929857272659084990769047821338410778051079293119611502673217156232885908212402388248577067779260753909462292498207075507712165083179991437830860818357528605952397187300469049626032975361275665779502325300008466345545013206218940719162677551586117650787419254079317022406343793216496500239573755862444136732227409080551337849074526935768528358699843420138995667184632389323942377782471693222517660360324598889887529246383085546611937471688392152435410927457100265840315970708756038364537573853727458152458545683255200041672662042268346944435694967278905622428969752416331202521026904847455442669538797743144090403161914631755390831556643423574378877952900950575177113728866707556903730380176730025783378748496581523187793296345860327283626877909290405435440753163092138970114844896586898665251009720405024339345165313644676185382140885297781546678019392142604645423348974807660303698777018435851642119077110540625333509812764737158266060049799373142672094888734522523043889248098202602948744019415011969802488224517793897704031410649983558220917526670062193864690042760404325026788809012765968327858125001614994444228271416313607896727031421676631697444334215558803137187018386185264458474879350987404005312002782462949192135134745260511649719085695610822282351806056968680119178641712899500952887410991274554306194029658331204486122717322048395919601061830309332311915367036565324455085091867161229300484470687939846168302063918485056596216460550867090994381292017579040148341536037125663417663236525634892463838895743212070270659700996071558276282617529077145706446458796799539814558700188256863964010423720275392627051904539439663956288024764926546419935972612877838873860807211374801671743339729742054906685047047767356693631417729400843102370617729829778667037333207273432862561247603953047326178365606007855734875058023438984898848054442397946717848541121278547380330769084831861982042191398804203792051667026657977606785943472889104966073864995109796183106252149565421009069479811045607420181393755984622242325633946699399572963140519989388262095639213528377866926733028216988902222087211904255030753481869993727979788510106849526524226335166432129827262155670564510557126155348762057119607448628057606962086453886766277172961950992570485698075690408554386129747539060603026543592987735610570719525771952376696998061796860823633027923291838334268043884625779067027945442035064571295184458857353042367695921995730411482697205167696663516569894932491641170187484429103167573881356782022342540547990154174668248130049153374057317024364743299378767846932699133428331132298228105599254961977056922159726560220058171147874780967661864173303941084191234075904615337836478969981826977444646769762610431107568787651912263878862715804071525283112598155473902337354360728662192863461660160045652777063675383873965176259217674330091962370011070966810357526740617928653439732006306918758098472882339382705986367632616727485343529138559770332498185262127089731421591495611865573862745391827486973149547579610506102769193513277848496217991910920585551817532511798898094955748968450153498319266662229098671890973036378130670326422414097466686303920336852508492889142088217072147419338428911505922966474130094919074841390641289389972966510037914506459988359912532088988577109901629840480491457718093579859935741375855696369257329607498801643943754504474652706217758976751309487527690554453198263427135359266120412020249212779731007872757929076260154981739628351416403651805918217866474545288653020273056548024547806513226073302940611677733137604450066952165138009273337495421665855150222915750668495421479160314973850167801987228537959442189242229260521113956538598076899370992781158387793645429592560015161205432662007236679629355802777496965159254298185018810373917574999576909042417230576262004627643682271360173313146848030932228108528030650256982966179762380987010612234785693484684939541321556360478634970274338786182736762597944856243249862986464030852413893043348534582703610823564084892055774152629556345668593978257834297254349099341443141417851029322681320529862167333646894479346307016729950876588466569149085628707236419394330775809063782273434311274861324243063089851559492681412380652336831075464321710266297357078320055250630909711585267360995036984755762104924704449237825040045554259434673205189444124437806362479592906582705193231575502617304353119829133246761787339830013705300777297284134043285995670179010755829912034898970251001242875715885812631424077075019495989784753298746450848611164743990789620279644198435667068643346095224078763586846626262657956493723079683403816540932200889605710232870492285043035107767159323078671344146863123341770096657636648743334475971087465954958031280321310880274527799965497135288832315635849906103412429912940522278537652239817106738185030435299165611447899569013852217276054120859808617517677425956329590293080440143079509269379584898909219207644192322307737369758124825309820424473955563763983549630012134998510823595996416404406867405137898669895978171379078481773035073028498159557728420797114845885660330884776319836334758924951760774926064869740875256683296167873467980759074625386394262443829061694454810988368368423418681670705008544595011546185538016449000284681285064098861139100201771879720004114216787988983783396337046856061130876442207299258514503819610105357941688211654928028977248844298779214750939467691818538845293675647596791800744709496548868680364979498904677934533217766476268152540750396730134488657264979948619073232486421828074897130260178616642134711245295377876040808390178303233414542454819946483148803048258988750689962261275458601794198902554340800429941262489630220097106144115118616341958348897508186892930321890080174599368618283703858352649993798360289511685156463094704731323308817449981965683095058832716720254581674375180029502766732718237128065238837610334553575360693453684082585397364177643056310162857947310677180457107399990030658294355098476315796281914108533213097744552479007021865824173654097942695379127104821174278252562118578002571961878472816434982827377048504075274362240142019290332595645873090277867159647661141109772970481030116861036679708754230670484992143287692625213021622515097948156709790483726246849600223458988663278994735909271683249163750740492397340785862547611969442860133744035679106328035185645199807530358241147953203305798528747304952500022606952399611384048766237453298718984117130221092546367514782447673369615774941812399915628402343094562001026307976308045524833313308372864719036010175603060137375133464468091613290077981425608237166647915218081644675652402665227148317215216628303622508374910669128691426450114718364214201991899413996416669924727212984264457354176642911832749815923539052507900557637416648909041152583593182600606429498685534557509462918384411003126279394593488945885546191964852036609728017607644727057651924834566234487958537669521193076598616250360218836929673774658776442420182292118698816042047218081842244614371115334502702068885713547736242129372121341647933448308786836487574831623321950828255738002691923542067376386899749174904145152028388561401568419245286070929118318864807262100667509583357527102167745763732561521200216357087155977508121143257805420421040762053776603466975104798303767473668155305313163060762155932425215596780242820974104303658665581483200003349546449275328505364586257056906082391068775273395191661575215246031301383008290447694240203235959946927801532771972313267998760332738704555489656350573004648501095429932825868780883281848831548864252117020267041301499158470315175045759901659217941352362859775849443487053119777501391838378962883691539695111731292307409289330499655238857810399133076707064191483501315817498984932629659502710573418382765898007360692632249207487368522585745755323445423495357026933958123208350957916805625974552616364934710311589913281736771903058211809535844645483377096915506630338514676995241182760323789899478405757048849792785309921731660338726638916714704149583049929063265408397545870284467118202009645181031167978380455143362906775791784805606155730219698893994244760880660807428760558453145727868373122010030146064344153245412746221989836609465134506223754405531943093787345477925715791754602845212447376905236644757856192696400043716437471874178575223025981748228627773663304762653038526268520209216814995423981531185520574179038962142002966337397990986234933080870365378849414172196903413647560724551956111024444679783650380420961033564883181120274890784170752244976489958137422064500980108115967235910530505727223281069570607378529952797819258977449569249904841571218419182525581849138798151177423956439749876841433092879424348222607797627181323543743453928151769484094947735725472951652347647345495836708782370852073317927490560127004334361413293915222269942703303551278523141462735119702660633210138814444304741587247323014962837413427586520967253700471939369013405897039431282081534786596369471823759480336934720797440707800205807844475194637197787302733622397169282166617612482458355103174799916698087518291066919963206214034649405845402719630781728564296186662853914966413006680401784621988733673026098522562456248137903490289536263966151224600255202119840050052538145368038611005206023952632158292381489794588647207174571604139644956954187649538290684452037850529680977688546337103294836159617196346527488768198596268798287063307093070493963513513323860535034701937372148926644924259678779950029399357394917273685662512508569168993075020073596052328342338661317856851618576292182307999386866323458023407610869066242663806976618043706662391054984471776184627426184559112590883329332202439785499144278145343524738683836881990514110218032475536385415013370497656668757417849669042181007383817683335310496094649372565190977906700475264294557770091601511910512216264206294880748444562236597289963493682242316946108617853554263532425732404536039127871678110194474314409392415902167615804429360199760069551296547665402544901756818017919065489464454634238027022811489983045196659495107275102150523253159363340662350368637792088287091010982376168417132556886032041696819184613697828383789773405270790901169458359008613902179499308745092656458206760976351216668763883095237264086344688892779084435595808636633816214033696746163673384549178486005423293802041170955350848008077134627385890911779452274340384852736920308984857325395127234297860996661298961869763820907678579172453179372425654028427951542016642231983185378794527147574927964043716608131264870803666734064096515367071801505124597712115905163975901795077044699288585984379792890504997841466667995058718641479822361481112633004881936163007512781200398138752251430154238450716558297146378150485005334683571899778932749630651554043571527226937035765478228226168209651234557771937631872847807408459514525097579553748441924263868497397871337389092987742840637316932790264019948772077332132186869230830048131231283881235118480321947215089292916751520748304902376577270186545674313415145313256635000873619471471171469477656141195947065485689465353024665994898824914272367017861295706979547790244099756791243907353525958354962903336174364375798439060890948132297175122968771216578178682623651143132313776197625797193768517588926982693816921531632011869144788646654001211731433244182705891660006335323140933076929957160283126550283103697100071433921729302767577582823802957120636257436465850450118318737439799728519609564137035560117566537322034188924894312248004023072295071700450951652528759964144110057509269247325548857946121555030924320313815757925651155248902612602454430199878488975514923349978181119362329134563921739735845687498505880929530990357565572667366096597706878432819354492314789417362478796755887602735255389792166934926205620992065665988748805477049333249150416717086092544587403319124176605564168352842191312481281564392023815883657029216280855689482072350835292755192263317244544351111674631239482808903071408167884866537451308600353973591253631055062261364802644640406337619798731914019934567644810350153757546766614816318066715205774097423545651834726108412087701128014489024911522672770318411776824253539527972525224968181878289480740637816922268240708418714494334749915341141197714118184865087145584258326463913506128560689563337085380490146899352067673077383308611206221693115308562898734531132262323027426503622602243861580952373315603180434941097419917652663564883823174676201275101904710156514538390253094661464152161343474695026951591029212905579176015441172227164237501828000676576298814804464371421173101868500646984825946350219423194046346868969568567184218905493183650814185329888160363164369496407368429951266757209545557743840388952404219426805944892349017408035107402591387462391727888559885908643594040700601275338158199787506416108275475737733051293955288050045911303278332175185592761503663320714846936590008590215860826490323307593408670297413374478670027750255578502462349688872683548798287962869023178438594628044854378683286281725490747292410409045339954771144276782972796424223821261175108929001359383111617081294360717031610116666602491204343339631020010254044262171288111496608738446321753348319822213088447771905391518404174596175361698011807541112178599734504764503335998487940268575577434491111667281807528761868356645503322669123233239870448211864420284918066085850251535693450010803297164617185339862396435285346434066457736725798464349133932641718355613697933565334136454781397150617680923577413829405806317845991206044279071315307088505064751845063051920934592944216236065263323643954087019176180340533333997651292257611028227073135467908876221605239017029503493014184425611011418602614633141077960543180464862866603036974724626009605209021674309685589202249765869554757531747590993777604448745279018850525071547175625588667166938038134255353035772913279812955770161384093275422578116745605828387457121858824162033499501260035451834973676028035737100343101576754166603511412678765771317354873389157698736172602637671393676547746779564821683163161680561074671609369061964997666487612401433170270307174070968602915699700680809694333108172541692643738541921260615463694227947080862683966190747808768570683890051859080524991882700210335707468472734598924098001602713299170761650571012620185949673407147699018586764612692506697062347477519952980953717150323948134489445007121273948087937651468449542187551250508044238155137480542291110058279486063205833060611896030012261361345528251565355159455265334162125090101391396834207975904808794193032425564728018872934381308811679971288685890149136832241693705429291988312559836630764508492850543093961372601861183822803315107508801725405552936604463735893718456219270606115828165259161870338282693620781809217374986669723321683978805529709055304825536399892940983464895184976151168669420784376028934508781329843908166822628636203124290052252745366705335171347517103166672483812954105929126008389225356617916535727997619691871961299401514444473924491402145752224513702320211487108304724783932047077880803547450692199537880400222872919866894022938340054131936626672098833992251731713369290825690484943400508483764586188846808949028629531307573364115853292128955797502275154826128992527113703595306608296996423113030219437187510496047505330377783894216366605960276787451091177587852776526497478344416992717763698300168541264242976227514805941313477042313053726148743140595979376686893850866216064135935560671292411792896948255497098735855312841993115430457429703152090776560407681156662272810872693905796170543551323913678992019527334959009870768064554182818335491203283218725022972387189870126020282240735188774641520155859910864809890525846010622635833167214884148609682669490138259978918631515031962671442547416516330901178643640720717167093728123682021029457967607162731911340029399495871752444501028656221478434245112549906891958806060378480864487608630782634927775904047896243599221479102390760226711461641783474667363555271460420097218757214628984195135977160728351683244283398867508627464955580750037567009165207175184007107532222988105659981189273560802540945099461138929776402752529710365480862658217096283808135697252258568801011802256381709445631351861777180750624288543259906680338625224333098473916276793000284762252766411604919239637519172849270638349034167413645061318663674849299205507578824960376286724746127952536334347202895965448945816811766924585390312434657797883653843339190673528008235406049645073457589419989479627937826643163594638325907468347777709543052240814678193446446587980252509858882131570631925339376687306411215731168193918018907446841974776814581694821824380405037409250634298302269241358890875850379676825799111483847551206492652293330960412438318022382172589196915097848050629109957081763019585142248464595659921577688762455829648208089794322763655558012456946696200957858609556961731719440612268311317992308042285258389432675833547176052481717427290503856118280379200374536663945558553123071661487577975449524451046136492998020443044476255558725781373135701801885053499637446599644763763566539310899010705298763665896310037313633856603698488617383819071552631673320174923459610154633227597776522243422942576607267272495559485051189085998254477095260125653089168366826857404088574954652781158807372623484810848308029444395316579939385432541377130997584277660275217475711064648241142788243570424198525468010270187517319625079157524815465207462483165011125592365721777680890912361151768301087221220377300540038768650664400412656656685422974256487334847492519644305101435793762133424403151833679087241102596356688173514743474950430056384323338529072703112889883856697421893329224521447524900411558262677136907158763351303111681341742411867036705726169147091879620892262007137181342314036332541427491790165912764521444354312715020007876299707161734779414837376998431667010477169230274169696435833057190336605474735433707579093970914115648679850259963846629764024839539504252640148044775869364394811382480428259477284521108347296253104327861454596118663322375764972633996741074870798165180912953389554882824391990754020106426963376380382983547237061442315205376835843061001857582119267229716728233571912800345685112823406136140009206007207927732237202631804950914988409924271287309406440179290448220032548965027605902379503051398834578504560436053008025733821646763642589920235945249331042074172073368975098321194041906255470417695435775311225834757938129075522903802296758168199361728130754233705505426807033669338486077690171104615977858788429087144697398302775248297134567645497010502258305822237942294940623637654938442186682363353230581722639828238538255955190781617322596405891747804994438325392706586134995695207601531105716982792351803869605175093537351466696365997910975206049761558756241132754892625069260771413491062639614550500411959327504034905208180844065513908927962108597197535762133314888185128656035356517294638425339286443415287812401603756883038528060612709659299848791626821085143041500945167778223095971512992277578714794109923915222694526439871427624083899985678026741449784534875478118314411897821922531843037749185008278753956554574611265050142711478317982763584574691345332414586949338878574778549967748848442466586837511084459770033044082996540735595149718420527232986876214982069717214389158371106605157253178550401077619871980488819844325016514687662904866508861763455073671455035162971444890156880487095637009005077853313522182597500943523166445354607978797493092533951623362690049266129222719614270257898828794575585365440353755485434290870810804683632538239325252856312321904160698578254102677068434590421719802074344633985453709045202710037755166294258749448516492042833647706847679908943436949778345422754109686092718761854280498902071853555702247070524516751714526951025478952092455452519296903560295420837435364817078628456602842257326232410978996803205152985832104479100443848591682851391251302757168564546649239091538474522531884457466040457045521442812049094864754379289733859702913490499850842642123968783339187860979670427001077697297533629915685548454698212336748096498578309985022971584452793124276058885580632125602555916288064370964811968950444768482503190279683454891314912610223420523772522783748897946955520443703454504121605939885273700075392847365864839876945750945153921658966037761445972682078293067348274697658956264047966133796261871140206790421156082927431317727652713969082702199078812294935516310259396459597829336738036472763906402933290709901570883854896844890278444258188829154711389665127315590062893696759106501255440849546564081406462548964133366282607197340214623907034700489546886715823518201686967809432417973820079817375236878156371541046353466454197339516915781045962409234235109281641979063285583476180004557156391428746287171822963321335246918258867651712335368424381682300447702636974779392123741323992574454958764715029583464596016373157485144349432211696570864644534199963364199523100738048091002900992278686199334499045707081762310723564149286484491821491656009446514838581041250142618377916077392579239384146612646715017892176176565314355956403387662692753998397569604294982011949118653636141533399361732122912889568757366080074934990985166918846897351290151411911847435151419018967531464498559366181455792313924919277083325571735700231302860575160914264095822989998648456398075834512820587551108189809516348495475842806832592392736459586906263823006007199182936702642783626335331917552352693583579579137054228866055452359979760093246796228354613118649586932280961638926056694445454066728285103444622197958637572389129484032719264480845779722378133994069066825590650429713440965389290683016168317254786664104328569529910858143099652146621618870814770291574408858504499046061293728061727505179021406981132046052199958313772153673489620878028235871612106457415949130314093088531885946026099178219727883517627457408087293477646877215357382482258720959401381337235608602385440687180487474251665303332396558613753034775267199121698295887378113888799460335650437380545025946559638342176857005491244126057659665986093079159469934319843263895892752277820319058210179826401604755789141459317515848828642247046019883974860765715422404421750521313021827415039481479938904350419781666131875623666574093158018046977113058183936266005092144681570168828245630356337810609109360840701181731162004068924575728559410061451144480726071948432446256244042580524044130901000496056479940588893487126792458786121415365324037779454669973532063819399871539547394875018100515329960382002731418996403152069084259336931004215729861580965213695565796721319795584867245730542696322281582210363544598556771721706609970022202804207903297738210074349148045111061581964726744451408474289122652527766425620751707736875301368178359239774538561286909717237457228035801620832415718716120977935631282071062459510317214101781028257436113928832426948728873371316581557536910142326123835471130022378372473288021621797304062280797429051244214396387715554053417918483445298250698537161415688030128435355475659505398504994331047311409168321115729855268806735394255849020911319612473748602805899028835512114966016542965228919224976827915537535936898378439893978062878508945192799544459818892195472613576992611539999937654679680137915015501192574123344354418298340310781995991265423906022535739277062906679182724543722374126409524959962696261880618421468806200229723289487308815187353753740097483976947632826936154867717530435215793095334100494758912276009065417273221494736489252657777710267277936466963224262397818079974863031454466786465885483081053655970783837483336341687236841821091346105728183882829769679876017029106758780873599461183654710825457471155957460128805048667491532604070364700069579083647757284770246368752962810439562794085548575938562102930449902677897139221364983952208951990476151195691923477620154193169009386562908167970408013170573110315899221977511861373954102742996564959552383332728939598040254093125847717078743373351274618956992503905911901337998449288959422358283681257939778665291349080730701573285005885235177810675129852297647917262176483240291233633260538106334355309639435868033133291609670728449580128442005691363593073608370553607566400714778029566458109178258707712534165984968350880135540260455689818974273948110289243740193500865130481229523887681025710905239715892707601792841154827238050566565662819314294494593595250088996112838439399801621959223744646602620477664059814191077516769647315651055595891364499617362425112166184841705112284808542936162438233255776334735945431475809150007086005873799143312397783319030528460340286561217343917089421776411912278756449703066377937979024620017886101758503705962866586782109966070584938731563976720241038205822224819346593156080838806356672106648513433990595772814296921156550967723712157977985519999397252263781398129490527592871379609318226652199174481767180135212254123559493956581712278723468929269804267479850157082897840731818012663763335946625256553105415216966572619403821491904923286485329988263845465738029128993014078115437307464092134455941499300487456005122909243087723665898732287454228217842288502073243463603804160994683601573514317499228306810532618459818316931279084180777497906004626617859993456971134678508948191341831525165478869108805668262079787173029555087801022683548145959012339502711130078677582139395370346308067144836880593439577136132540383673981268350512000369223416227591912342249060379089286610640900420605923231977428302473560137511756511982952585354426165266516304522169432419081926848918175275818043141904366347522944471737064970338099042858638554024721370446129932885044807676678720254056111160851328451169547605220920803198987117158763218400705427271131002223834407608450316141596494939468938301413695949985217341683491435439276929044459050107910548075143985269905674845241780307057103438861085766452683318575399902144853690539974649273400322893857379154637865960865409078353655222950593865633977813566050153896097738288202117003201680678806249889549936218801959217428719179836929950127362071394860173263630815898646956027561298584017586073000698892719149616810943044149772893457366465853968559311896809145507794359083857220809135550371135509981190643775194065894106973541957394578264681954569064901930955069256084802135450481969188181233948104068852655782766796988474689570225690223819456023178843596260336348643784040500832407595556279633273906652281476531151679322082665159147687371665781193103781111831304590560296520644207162320893481191580504107562646945750683837412686242051890078684650186538509859720028012683074953301725030431769174757650379621498269985949628877644224303169028129649754054139562023831202645516426921160880760114798571549110699838457386110382358898032650713792732305048259417312971919133581936695862049648773884435097303414707866129760290678502026658491014001599432412546005725465835628590672197879972874805384729512367705290918031370637615405683564503606718313899696624188552472621268273037905582315368708161516969849545744883650073056029387930881654101768349732598677875493552755742159658004924652792834334508425584358834973080128899441625280180110544610588734049810100394364408927565315944126658554783251337229043518133413753329195447468721454499183071043010141905602627547310110828356044241477103786753359855043510922871773976306616191663955050522870876958203356493923204862654518303642180639626170040445831331100237603915821136711146652998664280901536220407019206146972972203721386856227369422357488750654041682980510254695933269637957350098677517264033962743164731580295048214003671981829021925840523221462737976623080950342669687331930634540277078984764573159336913717796650062910150764735880882273452506422835786146153870574307232372337241192216217654612841314816347430132743384114600082173835632063168641417763982157833620216959700488597995834357764966946414980795446288201985588123696189179220788531334682162107480026358184185310308537546898136215227066433209839398684075604502157085040835404987176256071334243636760796010902696952096995200647424880677510687832960552125571350720658435768998534170222069869883344436942174883705072863285487395440168705701293626476380393515269247300560659031215507380946187781452867818189113181558385445916019507844860050738104370361406935642487505029439163829548065792090957338465920203110469303262855507595670511058230947896472715821485740180281664606339393367406723249993407684525418097640538095381186567997735998536773553757316006693119664094490016930860577650956534492480895813895697870398791978259123278322116848270690762728169466942904531929007766875608969690220698151658814595588492638485565560584254337596816082964454289333565871574835040344434711418827742152107801753454376977595219434225507914553918486526895434744914353703993601321328454120178185487005433890954922799298962587533555813015570408485429269051760741234994089057996129274637557415567262259999517519953276777815006197861077841590665892987978659798649685404907923715053971766640997476819793784461120905338644227103209082352962657211958594681203348356727366759283946697522355303194465463654870732837678984031506413614448136629168747869672653313870843769789670528976628556020399477113612419058454026907674196397712307696626645804474043290556408461478308831949314771042640806450190715835913258197743100855572313685595816109977856517109872228520175006601720901235498676241517515640174391054018604763946917421292282890875008646059675159213905221001479558621761059221219376892759226888502354195645740602124257313249642493527297546405222901019712539746986527294685663379641038936903408417636380700480354474999537767644422796290656273196337251975567813755810801469333129291784988349298226824251156419782145297555764646375137140031333001401949556132364373567252549280361840551791872324066123890695379677838519795445025981667857506480521520698720428016318425301240164193773652638847492812308380925290874387819619530381685234726102012449136915688523736772957519265804396085432919944432367807713691015542271685140523830712699573782785769949201208264529554636292032255441189268147231072626892273537609453053391430567138422011301268772388965135502735883237416595891409080687123498744960027655880021130720197261984463044115661135115691950116189055536556061158223991668246700807999223313500958022863030521716323026395943148260554836552124946667360789846849942123988513195284969252629535092806431278742124336493884359110020601438061995439097822436859713962429889186150359035890539523040715842326388682504047454225293373048521328943111912489904194568029613446340773496693220866522241152086201600768904089094105018234692024757906224264511431366593947309363838853925573354100585405644248763544867820530158786214148370069866807521451520105154283359718018997302706468289986350380117202286122407789388295614816595446838026160534634571163667325743265795356235784285784010962863318191714303822076786246502029720651547981311670719725554675030215349919651616352119444477932398913232397255489424858012343764261165710354228507656741228984657371253090783601767706548378264143744184026892846747195058375461070708232160029991199280429078015260445228474902581604972086270875398567911391062239206560144505932797372816298820577276620624384804751947715968013515455617020597063204409540046604062151246750967410433091855558780020615335434673639070155001397475260057499924913237529863818146997469736916180571338324526289087139946334635221933457685550657980867713522436403957658428418119914841624393077515003446862754931383513389152302487223180243686051798459959525890902070101918908065080466628176110921505698794201091857210683573427318308865950655715095025525706807101525440073745383487301063737296849650916077433398513874451009751371844662181358388664865159509065638956572824333370220844955402829873375111543778357439774285234509523418416709660058397113386001294151070011702353365266187203709137404071370802362978765918041318241006530322859596883163811382258305991546849251313859978916938782943976829977053339908570176309574140682759925847276226872835105946800699147147819582477930268966348980396031108889240198783087326299632410997198593670694535554997217274649304398843310180134707571401162797096740049514802907387839551464292364510045568088798714832275346372182063716895962615359068697462125527285199844350412699264300916337785023620135135184048915493427419524885354283173706330749064607644366017365500198796017243044361159571065500486173513828340799434792222816115621756107508849850594797801179348968362045870178611383126476025440838619658363548112978561793341539835326419169012008337924847763979777048560833898343741820629361128744390754555892789534286251382437316332163732984596760568191798829218197867183462317860799122879392284253212406129723139494857338727078167122675869250453228013252875858718282271252931983881702429344808943609024325848399264660294561608765364794006194027438035826962209524573174991321359465839869267860941774851593508545084530068328614445103231481752117617279632509638704569231877320271332244009434129720392717168282731123953586269476978650402785162612091599053889128344953586300424249727545742851929641527371630072080217172299083465194086729126158263975580389399629298686594020327381482439242551574448754130842721878746134510966143606716633693287563955884425848455256876392703442698123108437043991091326580270993728587834165958087096702775801220934581194010225255146078560383447777931507757900069539626402475689225338203921651611960104043647106286825644327026936475026677993708053617127031377685817713939042246629150444459604135669004710046312907026839873211107725018818752265840990923615706656346206480389567875123745337946523429153287604332846531158370872675474612893186309770651637060852785580815764617396418493535570168886485231327452728065083317315249815824077236681887128649702774577475748697897893476926918335356569954154133498788836471710927835027452097334904168869772520797326405251772317983592351564485202236714611477570027885283184265491643144457006333357612728952392902666857878893505862287070059066937302891886576838161925444783576166061359544342106904867572132069837822195578647237117914370248563540862682205672784958550186380268199524361083127262253033534127089690185489462201407170497860659287549423226561768983654052783854523737888937379877040314180243610188963755265204937035525652460422857674190045791897699144721669982288215233735098238762648819815879477358802890989191402705816301781699287897984267203722682572779860246654843098237234055303697884399907659369201460513737700190094139652667771074388754195132762811762158461708097800108282604947787237441623407698731326296333908638405388232617127073315616301931013851486034667688170669546910569857317972208961965345615435631999453997609152858439459586632780798633812128126052120289196468549002665392143229604747417508545189625215082708520461865868522492958941789117460792909877736397242424701905176242915008467211877965125996244545778181508647442597794374672142065079429247284343658709749353718219091930718504922973798782570768584780505575355447333072713020911560676575886571384800197797949089161872336985212422392914881497936653957586694226610258217584143196707810527559484905260174948984208717149084740309791681630822350411809492231312147907012044990881118801064942203700419425964009639396685351484290809997503615655375568593561607961855165165011949045882113526838933334089542529383565597143351185952285803759038624497034044364012627030246825489814413204679972727061540394262268661098405592564720399794816902938295024030530677960491969751085555539864536411516094392114630796053785662592203815497207334275169015721817003675807192030592283783047118368483060463237239560796008305421850764262020215195104115653947435818508131523130476507033835194443220704650817367352620011135359201777815659098948175525704538091691209171328547048560246185605421875194462867902558681068760037075736411232462694546039984604031009514154742994319690300084687726279611964269437180436933902994653510724937022646421902791045178837025799756102517438692694200398201208987067680122842887789525521595766133894944405555697175724563235102207853040860949571521226510867523695734539486766637775737816820453516155017790399720843404210195934487883727663571421505597946904793014585853828940638202199613166279478036631492470802529619331384584572810436835429449700300802365370775752464593330476396604287189046452955060547589188403176784936680437605488221785475489188883085613731152046314640765678278818924065339890475516254728216430563149645016512801658269086981919458497936338459765009688127457514917690775109055132391866832578652763318064744729630279918805161763937199221345584233772947549667398747301290068204025123090181240985444030760215893263579038476252905547624618806525846100500876615961017837098262293295414746564147400359073061642551000037378146075684771615361116175468303621927824749474819323817579890149311087971671550834504491901956429799516746629248092402998318787554442045439253106308067174453431947768323011791069567768247100219774074950064121726576492459884461542382966036335586165535931263778493554414106750659018255711906993371412748236229999363906007725862879422508776605576558244883667978900680355437183362988347957011532274622249610078717878103472759633120978590869176676716702203022453465275986422071454621111541022596785568246986330009576684144774157277146094540862718117814295975538371363942464450200921517947973440052852609411379091585985379310602942279812528428242330129534412941353589118028267127874591210037180259782261795720872210796903772255116589679882340621293343274119111729722547930205139972204930440822309868566323694228477357482837080589111043827907651443790471964502738860238191255214843997513332813511435291239263734980720359507208795065800071905594302123713991508224944051248910699485715070031903503398959760188248327087044872773927616864290642979562205104110193629451750018147391316225448742468260528443449147438513199436933644237457272901431226713973345818057512797180143703585233766773314111125316717892511059036815432561368526877963543275760227450292254075225334584316630163726205767502915045220157800402461145935560286561044853636326289196940699178557993682211285144304133026176543809985110002811379065533719729012870149351779974437631384093504733787116174428113028068292983585803036125835841687304587135706793177201981530485014197408541332586414960242106787009365475669467732256701050811628908968147042275188977453832901480098906523423276767159619074003114134014140831930493356418272638800893865106386936164079177307890969297831774995922606620115704565862965813257883938276606271418159323803186224282778966519323502579007660772645347344069642701552706455169710493290677881072907545002567404381812334025736508674262012668437669118927571616359337106546658804195114082378899065393255936364180942288287192423753650948207528032172205092641441827543602954858553653227883762741068143034558923095609790720776868502920811213117149364924513165851629587774496959207735654205539982723305190575822771192252086763141358781443885814140338548440173022053072384414190504726810373159478485420552974142883807034327635748592969201844481810881159051742020014284669225757014452743250338028154488139492490322267227078941437095249359109175364883826168864241067615257416597262309906730531876244768619718657835928814663249520182174688208497703385070083438721506754457742507501423528216611468191470631766329534802361039996636294792595932036795766728653644832941160603200934652255892812666472866291512963278858289450211767854616497791405410773550502223029261408688785006724100840091660534469741709278279434519742680857749736339679867638658800437113106993634081286008297891235937957013706140807506746837170093890809605104984131165101381796653003782557418134776226306257978011356336657890402979785633104848707000199007285778208549468971581485349391360545772366340754101099223458040072554664769475767710274163172947198875331815968678166875671540176818718976187620149286207180841647433010520084147484373753284577681505414743213408957997125795773022965006223240597094254535151089169480694544118999135685530859495196024196881645156422418197754749409080784053984041891962450070797008900176252898961471291102543470339216757693968827071744236845950028189606872937903812875844270425302597609187431302077198705046198724933093494923821501723324712938041008195499225687533851055437310001825976006959788832192226983888421081911360920867102143429395885305812885721444616951667516100626451519821639301245163160991674382645469474636023380631318421300376277187445533390527485607551954955172238952110527831398163455410322128245487850027476030488768278712484680747624696648885775665026413592305393028463633058910778452170086119853474867760708870958224423608213066301138468845329816388894409425235925676354364834195332591988084247124974970570249962102895170375676326527839409948547006242193590935029083847005195768335588240944893552032507207316977369280539664851853645308308361461262802177375071930467316936381043798656643170561853987816873432929560797025479155563085594268843988781270695878567006655838310631296161633790959472428750698263579055148248083281658914557816027092237429312129862202935655226698434563525325775884947034511438429290190257331106079667349795827301644937826680886303128700049722330494746810294162650987539858149882850105829976520853278968480110005913532160397397343656621319748788223010094997566969936393151822592302082828190770112663400891855365039614860634154048667782032910790856620070509499390215609622533674838033114513700667480119229367300867594351785820760233593612499113953055066928570871683162081705142020773678805607711524391848458857893187074348707330511724496143832915905095874466410516248966678243610480281133095246649884327273397532631398590861455953521471994795536379686502350347787983215127903124006246537453039762511464641840479482220585128237233863520985923213702638754975220289388350228552046340659227738657016202281563395387547802695847082160289826963456408642498483907787218771595602623238774589809395908826171274889926050055675265177922964084062079297370142625353565449833955319676346074797213752494032696972066303802654182346730641164228032128294378895783170189298285299439001306083608134929381509605038106289367273133645105008295019238988935260043917468543820216915066713324784478032559025170077829062404656677816382188294331265291693598720840809406579440290008964973429986472674016710033363749185622190145063733807261217921905019778998579360077077089169983571608516018193451708152483996639639248230471995029663079959372835524681440699284636810885636715628183057454252740982588464327013806938246301838971066251285702063813624217270438324949853443759987203668911771500330876356108291410004352585537453398766103179599030237859575937336403764626446034524824246458932781901280155949289872857900642887512610660812868971934283883811903986075238469640365862613706637456198401194215054084388264756367157068485679875205501951583184192832461367235025500433317589766828004720599788051906953914719162018512233278426777354171542096303486144514380953542110166419196601031786612978197479059341839569957305172905607711535758036471525749762432422021069390178984461817322072765442314579141182477665185332383444635499963030592441679314564516717405309667787425622293982176427154401977795670895677229666580549901638271328923680701030645257445827332410234148764973157680359625607978386282569014570720348704877716672199424114534295145310624397581821925725229970584123601683171153320181720420600800540168351498589267002846432636331604987593506463075637086214652754025526956425536917057721245590862181454473288593043391342400357854097822380687471619939032077306382123430496288640442098418319500146727717791259702115658379030632902822907176450586974089568945902822201541386313225225027417941922597191034497162578284299379642800846469881150228893816228083263539311744786304257808527146081828635826804316436718545104521923753495572174708896447985540976970172169388190001026844931716264487683313648272560050995646797934012704077397778597796189828863905192900054238284316665387446971087754765157608458181628022951987038267393784030199519875530454398557715603461692128081380999758745576015182170536158245921366220233867418450856796295780952630922070597198566661368728162053672954660414951523099504269265005904829310609522586567456977858916681596791814046469887987581556024919612371034899474376180793040703113544287887095746081459502088194871522442965305806350672248875068896477985413351845441373494961171593380034698457760070487345763686058239946991266346728842857120167727106470529736767296457131687390250762033893624238012142090427666377923063042593010065402566552764025431806193328875951633170368870684757446143676640370031360267445319078917622133010337581774938644636418960240399409100673200917105078082892903802960201553486476395726863184186036010294118510430359977569376501984741658060332604970260684282597412693549811464702529341941500798790948251721851164501796772853399203576376457655764886333143676548661672744926452602934991824813748161223115982231200216673041931376671108159313619437812796676155830449218713992033287224074583904235693261611291260260087574638672670219625957978578517849510495179667597895887626332495013324422449419713305117142019144242207579197745989626685583048684018686320121275761951913314018441626303470137089671000051845235329984712566905681112434349281729084472347312104585735952749236694024525847835579906506846991418438526029161378832797839045966995494955639678929100941176580438533291257698995372172982018673424730216233292169869445651812157819985170931487406755604733349991738123406946105274502681375086349145520785007943683050772342831230600334178717869185692925466364063444460088554685523441728074814752823005067277121746818645132258805144701279959915980750045350986526769843303563370036805438572588238908892934963722084588019909778923097735239756641114902204565080937838357866716388661736935152877430015263543023085669215614166514095109889535952857496360505408703271453948631104249956787721873485490292306070824344130054418334773406290585739136835520729501157607007686395956423627626353872980552281524872085705237589267488768124724751635228731484800242335351794837234821948814358003136689442846338067840861060215786661188215943951690854097589787296381817998518437627592011660820136516844304608681029899052141554830222964657247795743166153848290722181646220070800494947679991158700981958387070665759731233469424647403664931484044684592751635696605490683356712909572615379922904150140632984000781803002240167349175238541880787975858906932424461582571598751087537083024317943392262548074810419247451432648485001112221630903392352979167091240459137702162339278508743905646289337906349212160041432780618508325386500720679154738571103189087385077318320772994184843200147635136157165620664918842902045747704712353667516656478135941791243598724479286978741157459474189216892237325078597874936471675672383766874102502900201027317243719539269625632106806529486319200708167202907974148960825561030119040291067988929545258159074475974124686634970880858969174098096932980283628405234021665946697454365125544312683410386516097636612156963392818622144386936126669765571082088540499219278689480813172926116206237893383764156805264389460577996577968836830199317368553755170875318408790370080900669226315434250455000148807456436570662133272769498016469008069475520762187158690609625135101411489684529538977817168567505685352584051259129791701929253397108784435902510725478358963880408618676036587665888043680178246721388081560063260039695814032686838389102183071321679851561868441106675175873849289007542744364456212462083143722140930289675477669955057978303777926973053988515470473471461555955488236840305745050997929146775643902601956150920714576833777489192879339985643937581021353949897226086445148134211010483764177994274910845322760048477253636938195180557706552086320440970569735254630729545294740878204703181877466693678030264549890509120794269830145263787030212640963244579175873695311376009963719016312222590262485484575183551556991689004997093449629453972310433307218955925132066349100791527727701248560083077519870841349263154251692195763054349011532618010391250039683181551218971404485141947172805020300558125180097906389604690277107387330864846631349727261612454727747224009121958874562763050041707466196470069905236662945519776063777545339658491320954820365905407680466678264970332623817031806291641602480416094119453938489267897862206982019995152478377548975842640367618500118732751103353524944506499790289053134110417711156172463291902054878534359336251376144976218261877748744576843381396054479959780272698064269572539453714426922906194012920628660666657962730335843442559246352735333483527861357037644177933652719932250437031879200893071794222854881330305137809175762607450497835346882293732453686604084571022644657210455058498772260376821138280279411724491429071269434524799828678981236415771327999864302587645295199065435213023791103955647155767116535529008233556913488347449085164454687577904167125140824546907556861050206825158457359378388667802999202403405266521260960171714668674795082596320235308207988165731088485174294332426806407539824819790717478287882159825179275522392688092236407424156224611020903107776484970444610743728049989976969113630769488806247578901321756031225329995714381284200911294789690081145616894657658262920190029551846277251880722418698332444895193593075931081179597860603983928924787804389156021112575478564505156942631050293461322728841113003919188528156696589958806892447166168153852840818110534814992565230038682928323147659015651269344514360224103450056345738429916802380807111372471513059383908798828723698807919782509464274268001724881282159119021432020878322869194307484077083351018852865983851595841309138593092124342883421341400121510952522188565595263644232706860235533675685422703291890946864581806390967690302569286890364266613404367776221724835615633383633679814230646377828566029631589266114690652960078646273949608052209639008206219223999352576646302238260639562197242036827504416225549574818802543180147927290552846495423522463052791438339302117811880389478507395898559965548027975726521437311047673010212734265052025655126065630013499931231798380369178534762024879316911235646993721352235484755768243552074962005266964013459707646912737181163956888109136233585177925164392186260632239615167127351481883587749844553685938314554948282396932059526535034169067334561419933033701607837688765332293694001149036509530961840702238146219191958695612837159209188265541433277169621411552697944504497601218438514813853140815641446851151966745025756124910661954359297584449334241842830902450817105740470078073669927354108797815613599010517474449763961844374345776240473682482446242719861553348982045360066562896941822048125073080704595790664600093440377853225788332133010657200864910624261955973699670859964219647820966194268789258203940205602193037609879013172533141399185585303682458673137333222811937916875239576668198424278336780514107065020089045901688521916237345088952954726145219987485939525599372222262875706329609081721097430872773217234851705346723027427403943405829297806583999317165356207337648482266672667578536118314203807879157895555322233378041981268361012002590107924429239758807755075382222281754972499345537915440227256270171385211023205345876243552768603931125624968548135742491212503271815206035478610909750910958338259997489134562784446059912545596279606846352168456367704017028310144202346072540011000589319695161013583163859254575206356193311499484707482789925661519051012741336309707213375297422756434984922281241082047393532070759458395935368523581270520386634226604169553220846251182549654168988126691869620626462851100952599342959554200156107897868519221916081610314502921224659736227967397380225198949555822021573974105020458726737516941502223810471173138657600982883934232182952982133811082434749874752803295501729765826174316808168124620634943217325264566516931995077541130067555233397183383955911520519967740184325094132492825526403840181035879013198120017681321687545923708858604306701798897613761767549064928050969054108271444737270777552338912617696550862927117607881211414997845996433355903309510684510581760107354672106501852144453502241204804877322557090137196722506034290924886933209270464806546181717232974519088813996777524742752344011207890870162550526248488939634147609391677206995334317236100513777692938410594328211336950322942648996990161107111073315746456916837747042811532071078269988433473758696608182038527629611961437632064867766163724590268004589475103991579923507246663881932869277465399384572520062666088172366202764689510788793626829278312229512015088408264384885972242562076157538437143142615901476815857159340992326769624398156657598615824952326909457541722897481127920452318973237310474303278169320180531614601134031919874362069231375128051400391088752539857192241465909119680197794836830206262072462532554175203293586041351991495862447524352635229478170455024362473823172783221504518287161061326342421788110407945337295483868246123711016746521344140758500988134023593117498365852881837565866597830693171928655063842665450099912092543842091617137942462226390250197833221854537776268575903999472238285028523262574071468066040918405519228793436204346458132329680678069677319836061115959848271264036169023963146694113124627081036355776169960057549138225843122901098044186371913241008452664888665984175344739966336681628285334012258762217492654836501990278368741549058323944361319485584616359428955953467365805474293836496078307972158696812044751854242343276249139018141697911649856664420825675695805800482192546563387218266472971981029091358810497545998241101984800693918402967849821452961066821226690954080212143949389816156092101094656295246229165320942201941266368998446616573137386053196199355250032581124004908849106414662234657863930958377161602565334517876418549421601333988407018871293521307606120548111584668365672530449458843785201411151269324350769720909778403374925252629670218276697042117547503421962043460826830732038096450137205573130507286706967902538542217082594714057450687891523770781865469891641487690702230000637629844733675652285556676110124252131998069585229583079724575962894902623017699172975603489718280953893984661485861720778531697830097912831320146813108293567093892305824865221239109073860600131096472756066452527014779905543788524869872626561202815121711072463146070023743071503619922103407675925897972420525775175772911057103963400469355138158028052287346600001011636974130675140636986932334531859841103167025849138806833960667065549926165082181072456779750625459958728897605116662214122286421383428739407986564424070398812393321332225174329865754620340228587550063693248945109149977725980116878563934584052817711489073909311649135378538843440867165430547579848008786746619047612892724488330665379330835000319936088368931318544145136566164159583300605991238174638454877049429996996246517269543238529540681254516110173281727481380828953628464831967615050047365448428314509752297098300514472259988011408288657195574345446564094424419580846807467437853721503449288870748723131754947989399309794503649303500011947213325330369610953888991686570413285226028040995422819513979428548503490094061128257959485137850951954289812701556765871346880543191804991234324646404713553043019741216808198103440806665155287970530709397899387316367369220984364621967885017392547461004610652045314685356187679418036297521448987234389357958127332130867511470738573159720876565626502496390065938799778948142580213480485310743581996363352959119754225554976750853931102795706143980921783030101341710078101134722533254327612883240447113733000153212333280098044745983655909994779586563028091047615647594258658858299062301358902868915014663332283580750914275774663184885679018711043104103944297693804297936028617123175871180764106443964140396705759023358575308487108474457866862425660161655312616199674331904688749642189947542362160810400666790291335412938560129984437140795288271504729326452023463311954735214021627760132469529450619134820314905277949891274709347976300179833591359880031622739212203997689760835868277973894802863560173027649239882901713793713605096930846084637858597206156336703431458203073819009995458815800738969110964317835486307697505809243694734352726612057634243820019082564107972287486596945159510143958413867976178222171127806142160807255969776202869935363187585777123971292420294253967112280517658525909738310223676615558493130441109144018250921222930774804891554032595387035719697011945700131556894795991350161779554614909717322524361349217606676895779955832734977685773278411313758576908839596343667097549006440397938369771024350930353053879134373417748625209591717100566637854784304108180234357596057053867289520136181912639581796181203923371037326038472778919184056588118079784567805558392231686006534624792756003502094910471047687364640308592813537221286872539796851694751276062441684470840350743738056290033858812759975717300119428350355877651814241869595862506885020101594429622107656476091772274557217522618417878493052569961996803538094159081812709199710584702626478069527684109850801721230178036236446537510087378139704981329667084180728709800575766333410997449060314925026349968058069811980433892347976149867555401441408186083451906159969323937015498872614714564752425824743156000739666293561267790993162650724101877130233061375342642633770408368099726259042810033146385272101698452068169075928264422630735946948963344849243190000186754259999678100619941730786232362280690107675683887310898023338168617266516601465654225070248373704907878469549225421246726711604701436397708384604073006212372580385635807502533982780293953027764761698553573746175572124212917668599721156840408045039925352647919048695239200099593304707033522006943598559455708265845681138703308249642076126910192363748482608877007450906111686813646637893224935244076658431226143394588548068581503339466357796440003723215661572750541782342686981530878914219664389582644182799530850188522860109794981782978215953501637292645746122761043061849716289876697025980476209873984098631669179805260977982076525650933360376748398111338754136265822655948462302585184209979036039168141126625423733024994413686930575514772559779636894959710948794421629853836343418124683506069013234039023228605598204364657347623967568941167418827789044211660422111899013513800225252354096888419942756536228010523078296224995003541154577291307248805259693458846100190181425483325373468798863168275322288538122482588009465558783077352974337396413057074481653471316708156139464716249034182448075679748694994982953223903361941623297314673587580687350103410569206650964821129491988315433532811756592847886381942521060997997656400966439581907173260318455826133449454179546081367366616641681685473585498188166469335511522326460093213945322187454550961642430280561259092756343874708005560373785940500143080297869727898129920201796637325179993031654747797523354898975462354791252531366593622109766116132487228165105299867535378378633391172735569062396281977973197050490518424020619422780867076353221952402872108354057475240887510253560822034382359503620369629669618558500648582200397223783115619036087455539670474002948207269131983620338916361101300599556175945016336485330505176869808261578162317772805062356040795459322752583111982504932822481970815475015811066803986849839823452616380560627921041990409108574899433096530264806848127771026370012045983333087835648265893512159968027911864043424809332043733925365183252628742102472241918985301740453371536928674569641868900927881945276546506520985156351155439683023864705092610302854927092843026036404060134363287491718328449475101961724064659605528329622821074629503824042221415697635392112446624797118084358273713673461207780708861814498165996116921385111175369048622614245561813405345477654725930152358462768504267943384126520314557352405070585159352401015577547845595808186159777524652995925863044516013035341256630434293363763885428248872712818157478349961723758102518385912823492708252234683373573132010075311107606896462442300642051952829899315533616571262643839839189517874588560918050456969036853115172510394780187948118295196570998103125385468786769777197153445401450804055135796058352709532112995481407343083228696971143891117783841025095846522748885600042227305088347552424286402159838837747046693963448736761141402753498227888388915986389033728255084660140192082064233261639805988650432399184881095118586246506536330092750101932727874538023834672474578640910415506778078005315253083457400156400365595426879745045129701064758460264405543513482261572144075728679293303121162944691841809092437601095502379500138434035014191810009129664453022514539426916043799549666960723920506752392087399526281295617687568058494261215126622014122441877464921434779555283054256545220624155679575654608660556152261429964042667010726158784557858731589988042058849027669500703306459648921876335779330724022622486464797388497998844774612356827126334335256103933476235495067062397425909116463866049724753258314398331617195749121468972641138130386246370837493915449017706998681266350589456139059501382250607789954004728255247825862352341063954369772932286410987328283741111511688889516973483620817091147974475580628934232388385672625789324797638022615594605214003558541250960277642039222096029161011661045307346529007612124636497903865797756221728640336042856150968980057772977379626098154783994741599716180102488541651305692677427481635251608548320773283302558764725654339211879090225193402458679531364594441662831898334827470459909587406638925300126082640494529012947258830765225963178266549393829260617937474126072888979865270879694324876582670944192205136331360105990394152099745830175497910098060385355710023145960434574868771893569410810178827776365193722011735352324920303104885716091237521137286615851540118461000915747027285860097176156501518444080750428113932358696107668214060118339665791432685063590352983324744673049701347829802652866421604199351563889959560874007873822043168268105559092984341083991726265350385791380822625400276395988757861865165087829768401224628037800299331127450465824632346104531305281353447937365716515349096490454309278578058162828920313199000944302296699333497726243044119562956049905654169916551792364422928738000329212914278788716047782825622707516367938601720214961123518390500285533131680388150054246437574113954228306170602201977618721396705108185216462505641828548912631268684414526412429425494834604336988230498840936454754737730892780726539206786597170611946570802399811456850726644942635862173655325149740312620232750625486426435917811534527904469529587488314563529925238717256059817687847653795540136196892346794367491001440626632675316974049752458760703706453638933391978499399894016021140198375105231692637112027521540037909924937699869651632070452180055205026637327169988542645627956388551113444728588511379027661487616588487743868212549100145017088374172343249503119032541763570709186065101643607798389057313607995132824431488624901470790777234684890023869053698782505089612138562385283841810974729270696790182529963083385777646215982981026775165196305129186015216478276804700157478518085338197560561994816920354292964349221216344427141758716585050364733388495091485854054209848891973375892656355180357776767120062429883628003852065845701508385965095735267133131558753725193982921063972010243198510621490537496830460881220364121853987031019347335672367504859609163065369258197755421908012558213334883636765242304216315530518534328738749891395440935682776403536326417213383789595345625535786076281021550594312718064174134360202626243800096735512598652906383067461446842404162093492406999954335524730698099862971924030282791639912647939907549748948148451332251366511867666771527235887571913190905015238767183156005908355783933480946828804304523516971300924999186222021176120285283865025523015666375915728469482444562807396942435388524588471863091852757961744918705954317443576276043570108070691848083586010708211727423582647500004393048578485291652291019559452226989688046025330810173746424667633205908348618703520439197442151420861419496320410405460933576030294680105064899672332404870028981434730055391999375923451057720843725547631971192717774574104629783941087745392892887492743620590061499931317656216170787252853778845713753588241044608304048976705707592055401751745153606543505496328477003658889758084288562833843260859096077183162420101399788941873090945456735925478107996219910165286997759048854649521015583146975021699038859791704723435465194744062192459172728785697963570245140277718330404348015677928025427869532080982258465670356935602481531151479749345305907570559238116443388775843619684230653551854042444566218171222146050287304141851631828955306611613945636991149175145336781870825447729300043618336208760735055546898793768324189390744743608204871030373078277992648162303411950669926930099944258425992413471149076052333488478026387070679629595076856093138776009902078309506291866408069748391787987391575148446358933397442285205019509007313570567637079431974171251736654674032454966023877859856564695135476851798801051489544069358349662583926971797546256016261135941079497224316901626984401789716116354636832932562769722913618701174871107015497683270164274404147958772387881513914592191020118355301728258643404335451087192075711540487264239098288944090729581065933067908081768268916434491372613318057774828493722548064013657225741986139400765090358776116034568363275082801802010995345851576921336449323136514326623889528201754332466971893307328306212246622818945415827008084239192103781622095551743508142924376540277341160700589071787145596506657396189669836749431637963479686699008159284463126079459149860522860404574068052576498069782242929285431750786248755701257305663839737985722719718996437625306018995930120598822612954508137219538940595187380765298462159263266880127909823392720153286095476270785421136743072771943725177392245431316456321778129592303739871726787491169243601659525865793509152021718756862459038297788692930114402820609207419356997195879858044524541104446984518858572706291993997545970118232575173787055593034900662646462011043903432853790519572536132244985307579999352661451738830407316541487447501598000133736962161223390708242908574572814186733189282729445131462602012643079291193816060410160327750145314422468693704640482621700525705647118162652098450870067566319966721572072319091364027121983433027551482856622684069371815961041068033053637900683975886354557567686922246333362862907402183665269899984237300797183989423505733694943257512089213229185083965914478130237512900376779811176128363833591733540073561864925734137346756010650261428575392312246890151805486814553445935032377446391772146242094734770266508809983723965782190253266115803143954262175747156934815833164103162663633168485017178821317510932753308156318104243695564188194373002897538136082581150835902305785613873590013623135144652384322255944562914270107152254862642849857247014250167206345898781715121118525696953241154554756848042948088757836415482734882905600516079605984636141353028751956526270043564566060214892120498079802705216595383985931808554466870163461936927121910047423060099853710814650441231191749626729192016961495100107347468433507700366637080597690517748518570035515394272343851502164860364261185847121687735158903714303851306951764969679103119658362452360433681045463572355913048393428566118709638799742698373752646318990094677953368731165906415934879032649856799556693125701330848959562922839784995963282722055718281705424724988851058612978723834737142446806144734626235727439813625007180975944027949748399713307179950421631821434052961598249813595512281033249512859050217600413410295742293231505396115849216470803323045912272118649287029273912420406352305894678942175096551579787862221510464829951115659167323723435211488843263718595251236929417469642277636096185337716762247219891517401177556686565162159255935678018365622980785672466764696710106066227470682716313787245108823201938579963459528098627932280787758328200248583811806583163747697891473452371525885893945138636631354616363875915070170827023335755610236269398115861784551049359920554821907987857067894914053325918843795587818166421763293629511082899048361802224636801899355146525634827658696409074912367872552030363104809086732047333015392549674042352616549252693973644929891809660527969929774357845140122521718811425333530650036540307277695744316277305747325782495263615541443369991493205064644212664473139088131144788058442767601922979874834173287659308372359329732845013652165194354586632184228962868611965092962761519892558176217787057838317388463440066073592004189576037357030122880913321882349321175981918055419313025099967124568707467953048905135682869647736907765667513253825479499146817856176598704982299236742146930389585519535788873786564848818693650168148988978906367048348935725257978480201614655347189998605211549628462940621549991582232653232196723511597828234577029829539858041750947054755902058994960077718038967852471480924809801679653192114593130785188664010264705650992879268627870755190990196368583917234407881678349789472721441698032260025709177233997381162681021700442994807488180640780532365790301592637985738266743375136923419268043832525920142785614538369442948433112893380197331761609813330796753049138463468682682662848538464444878321635106028125465407923656462787971737129119305178709758401344475232053599675632229265799349238785707424007281014791709052280755482275678501672104940974438761807979323468744359916362280311558394427812131693786125838136224601138011604100808944638509368262955250650039214447589492952458545798117915350676002870203728855942406375735824227313626798560989258460812060556567079380177935551220806693863022367907142861275742513009134908991407230723715410391052487959616989979373545815803609845490411380102458725532050171137192984378771292560062665882531163204559850436352523824492730457340615430550966287051675534517513461603557152093394435360914967849135539168322708550648638112294537360411751550861083382895928396833525944187887644778642384932886876893892938339304083539852947489317639313369711950565769096815732603940302210198455623446741378129262637562992362689107223220234557727741871798546951947633454784789190809181707854356795554463705485902233167225776907902679450994074544275974225270540351394257927828156406780184395129364001496891242197183677954095136051547879689200190611853704804426612325306152260923167719940853454876675570711154269487598831227046704558027207840587534221574776480817318141585601484604534984935009763376792178356207071525640734088629148767207424947416169227120373596085098942741374795083490449868130434535211668333386247165901258678425973298117654305913521786462392209776134018368949121608325313218359270550192733675631276051312319991463457517017637794250063148214207936487433460309231300530567443029404949356034458788070522414987089349148553910506972782587389962023445802060418302332156994066303201235422609622555084843143377151013560807201948914419525319474110384824655378475653471680879293845001294188427651418362125677923143319174606794690146007505664721237593041704781533409690464844976202951403793671471762497790557747803334611971107092027291298019451565826202502936693530190600649188475955124590027775414578239282410022445153041934931157503986437859548049274906926874000772078188010599605063344943226042364636528497242635776507222510723056411053116758051152189357913802158381257975158290983866824776879247468689146040124950693852375880612254676592176509496797945091913693680060438235699250589869763261322194004766379178587029778239167641103184657953524740339095541586852353503763422305280969367229839092966785993035520421814834969298877685093637261096245724057057003869911406970629018655934411527867620838724024428425554277870977710932626133295588411454078055559932657323359539201816767116355844440442671596006397693601214019341086051200967572560107398696748267994807384800782620985254056278454147629571976778804239692292656959714987685695569164405285253429710665779129335889898225898238854401070753910149138060147198811045759953617664451750793683696075572407531986037690754844141747932886905069488765905767783237890927965611744368311897910148579849329866559022484956481819138802681821467244303486004500380199362046547025368196976211112322028472601641894867139750307414252941474578934277724505498191861432691593178012625788098698179684545720951416145099593574070433081495974142357688779588162714357870550891128371683162111152799923164807092639127105301153514209121373888404492433787750582785815346577868175236163853983893601176455508423204893009971567532797702087742880931128832560764570538643557352819706456604457934779694278607640196020602341452233629065421152678259036462423053023181266540106701568047173078741462573855177047000701651824120134636258819613073187906917116012255398352948418230721463501661057890557253499202744893994766667749903198578993105566920869178572956144128453944911217827065039059723071837032094632965742476755202076849454212883313709919895136116201970648206815295802395679559503439426088550599283813585979803884772262258222183797216680219714318533948390239164790417848036849279877505766559605718868625415723302424134570794627290851940725462769731311122533504503424810349135312313335210837699627629633098168710653723781624089038414543021204405983693180260418979365776327738893119349736918944774324032282706529674670090003579477580070973964096938562608204241651189181093191586421763282364322124493118836807966941401460390021055024390832674370226830065341447255926650000566656219173328729821359496360632589121102341876087288228372059288587034207405260598773662536865272856448271144449007659617029940949422843863556233560305036113358914317905728622912973344219709633041591719556623507872806626187907029112455530381668199748874551658244325416344604865638272987182788861967554765699881294744409729559261616536271910721442639069026859505364727208318328110319994797517125442107184556061980263331222496094636201684649920912853231715840260088055673918062555160326219201225987622777954032119196655576526076615145376728128973719959315749519753279929721003216608343151140225909363853192043823482389269446343064200187554654874471127805873209958338862659115253495362198607857642775742983423533834022951452395009629027290539817747192581682855471575585914204490809375116874611544334470929389500364109835683825092331734650450672461764058591933234964772543631602586716401826234272673503003970565292854727992030031590996260351239220398970651842742251704857252517235002074675855097118914721636355317640296646813174676864434792859577551630678938747463510743375425640255325838029735748383185257442344163435791820879475920361291692164928053463623021287009549940672649429782302931288742924412474467813897119680470622225154045609029267628797881448393904749467782354572694702127386828365467812361932494536978116292793540217425259178364670930547048257214332567689020836527845962928817484225924453895361384755691628028761291739334421818706722415712793226640069448549536146889160844283994887407528473713326086950202393913548969022677629255792088636568500909149817829670690636702378720309930085329360622552643305242453338383257364214054217684249168585314529086225963351283205882928721737391949566184058906215644518045425363064528176720635648810220836436986071007062396732642259256720150057386810537958860498132301777663457040455413752423005399759388249428535241308382573508002299733506798131238277076150902218071652136652834336540078180676802173091783880789594071133344198623055988207639855820322525971602375466900149017063326340574085527402150226741105113273198450443572692000913097232918774922572612171414248428558232800836406791833550546922928815470230485730177433554790811082886147168959106852799378631496689071940506996022855629122026621474394694023343499447345723037837458309849951996206420289184760090610950799532894864326789739398000197111910735721640072265623283475634820363235262886882804630730067309853147546235459281995593714691919168758540274635930897234029288126560269809663110765070992993043151142490703064805073826006648376793655681881036827247980904311552884783733317628401564201880376826523661344159848054565557626186679578536842846265969611262919196860448200548845891780371613475406553974459363607742051840325082640880949585333128674282761357661916416342234923081870962775158859940690426076584922160553825973317476727909957145188467807727549864964197309159974795253270727649748929372716118765036116261673610940002106155828021908161839807409832531930491456555729610714012615376501407123400277883160310391617894553878070240383675002328633072807793841785517382855112836830390403107213048449018707873745596382588727832834991346760134255208099159716428388046506099206146968666210189570301456796085293636097844115182440590647067936696130751149301615312931572228273479720969776222191253215907112245028016431718668109064051769598750522677325457617826484616436544134567434930173144186201492617197924552829559824336565177713106110087342777108802999713353196727984139823557916155552012394054849622154038715585756590232358020556345717457365897259820838998464773296896226399233053197078654592002764138153976984406561262341101970394844657890828661577353227388074201886244668366076557300752946839765651784165783076038210911734105079251629473575389921736319477000050845566646165763919622899610367288838609952988881330559060640948849409737984463184545096927492036061238492199659298314599343862173864867402149806408799173879757993431169910656402932325759588128143079040875436165674209606122884334930182802010579447727598326831663026713979899711669457761496563337227527581272035834584983050956847398795825941218205606168723363526663043553558486267495608722984551319788853213224913430153195695415661281806105503948943858349469632912252108457102932250557975896156366582472719866770161392517101708179665814229261658630643229747641779462324269500401542864227378725709831293522493117825578232697167831906450855993179858862646251419634942272827285310300719370248808266241725947705591985575501144779409327006676753231736370099741644306001891369726430474045036249703538168311804282031543740110690124358406257131306574926229503527106256174976672655784716490443580042940578004556641610178839714127732755122126710221262408271822052506063616475075920779215360390346841113734823002536969522193564701537348575137812065511558064016228123039317724338353599403257655437416270486547821369607523553954736893139129198955130780922075131890289219079790856890844667556673559535257479403222644661881478191838786848007216807639075201380011373868954958248054281512820120551234789580423931194822306506408930414852192937505409662498667042182162246359206070881538219676574845877937175614996287756748331127057565311239723631245682431804362845251088048823229738447427963811712324888173477310599071741122401541171143988660986375310602833376751777158349584447607556934439013163811679367703641859578674824637291149837223427164876719546250166610315463081235986274912674869161826439854599232101347948865288742866152529724027410038785210245913371566369290543405821519423443279913134698106102254123647564312754283892677873287208337100452649887808165866866194413299430837779344731411846867332516923520865796340557558639672025086905509614471445577108600461643300317917114586868913395063796289699132097361375171189755485944599412677407606417933286648031029184440112856878871936291653444681989087227241605559656059802624462891057483819441186707107485546719280142368884475329865876299525082073557197990255177500141477912572986963901272237541323393951176844677369753839248120542499117859021182652964586336986108030627946340317042266428329000593508880374034731210794253393162970485100502019307023616372936862698001966578683701814226873621653669380138884098300320014876169924849194417696723992713700473500682128210630354062401361010950213457962140590625212322572416255357008007084579754903663431859573008387046671039971100610801141208205618720364104522727366094395614512470990673126815507598505994824557449200123501352495666744195161631709886525322103028059194676957976704253517405782879273160398501691188937240529219095709725740111193901364522527453046840149870034039037938116698551016542421635002195403553597548640052585294760733475509256785100873362800942624478000769181960348788585764583917882240325598023681172456260401885695227829170136424415375582109172148268952266438032682573172757781985582561659544106028591603325763210864713454912283792209279835465659618127073276023355197014402834558681671084349025383803198377437571405742422552596023237151619881471115610970895186252768921578280748574637067512470384754730416716322997703791126513186849117754880845702989925645117053167720418885151582513325297014165843200826040510903443853864495906898546409902447039871371405726576258429158120771618215788919828495258101094649611094511361790820716704303774773530454299034652034740863364470703626719989091027274546627738820673649536234488274908714085711782998303720645593031498999971071849666360285585714399788842063839351784612607449534820623371230535686091379014885144376288471469555147404419681413422205901938096581108579990584780969873408919634049749408107457716320315370450627022161936262276776132009599853653915507105896256944109604745732986160927818735441977362086615817105612256346235565869790837680646247792118773302369808477799108594243861696859416040811969219162683757154976884024379034727618689560519475757691343502333563958104244851340519490881337756561416099630504430358384633004373053884951512814770750275225945865156527945358948525337909180045197195639392060584893451462141420396038251183696224250733328812011676640153710160697534816876555831856324182208533389138274534965983925011069469454497610094694778530360363468833095135560038058396661547215792193645671333370776625417055276143548777914437284345401789582668007563450826315622476948859921865518810999608580132311627361964585771705256640370023199988814661316589456393142217041228334758315326296422289104856611115561594967044812589164098938038518739842119168336559424591876064413996214755673547988977356171442177432821874927821743160657783030846660451305481151574445404972651416168737274901656232330917164557808902259752407238452673120030468845871959425411786489611245074649552483986344319010361639476197312788502579529699898513409941154982800231120075397765089789362232517122744641175402986969601830105205004988260136779050396059918726036241338545547902658278381432625679216958006191858783762575852873342602242276734620975614458985282727018066001947145417164014086852667405156626990714317758708830803037570976858075584816539690577794507846380650448030553503575977182873672804012662217495316397167282012850603463377081908395072399691373625890527703283404646103537116604927380631600837439473027361697452438354426672186942891732140360240999358473355335176083075028528262797381687092218127717726398283671884215907806871269537673386788941863608922256305921575876726711891957841900049594383079720627741548078080210165149662619406866714921304923554325323924232580258708037633609110419039517462145813522973572016368347326807020446355876017900665823937675456496924066799274793445347402942302581099055656904906305256879757041461703285079437152914145017542099914929261987810888736560480246931031356573499179555767817624007055300111198194673234770026710129910200221212560336818044095338162543357500839844839726920795158081854210834366611036139396760267863465691228899227853207252959774248571941075704757820607207047625580330717818914593877834781033351860246750441873654059170260464078468027941126927606633489874456205775587182030465875516624938690310649571230985175586304419884590237403124315262388932042416987890657065565357706484946118385390866639218239905856428145302550554445609876654346632105526319032142516169675052711603974469037914005576230845312286843761923034721051799876869688728146141474002221094288936345598116908549208714091906499719479112127599137147938722882491966320283051593587611790859532702237921784688214396972436741242442845152889124693825497031928538598285974532083649306332973788997662955871361209168006848463714554689719925959362924854082980734808006417587399727775294174331517422817893461854146661196373208777583724010679999063337288969831817328228594490063138922761481819254863069027546755753677896090658972487509330352587303124852353647258342047790288834553867075901985859764290067617015321302508765676130593843071758114408307678985327719313977056240705007735752463542416218554938084185355746695801874432680900673683308180105379624141973124847320522749641035214978046105310356752247886588976772979089754595507149548503223689715912358726435717895632225789166659324907817680680983764828448203697344752559773814041844433892882814152839710784053479725436024498637963091090830979893860659884274484056389201921");
+    SYMXX_EXPECT_EQ(s1.pow(3), s1 * s1 * s1);
+    SYMXX_EXPECT_EQ(s2.pow(3), s2 * s2 * s2);
+    SYMXX_EXPECT_EQ(s1.pow(256).to_string(), "41578799857258222810631634468083056117819978041549951634571929733493368801946827552949348259626291296080181769570991690799503620616466998406556584311886735573555618114585796829661508668015362693379645305202156886360171568071115718654053679975108748313677957126412204159030514101308709092214995441023462670695431450047957886616440704948019178106090797807794537527928498629260036425004475801070462087800441621327796523170611853665172115173015562667750988213546688224424906674074183733930577810305586997250481326169532612222150740261994488103462330217343248389969536724591839672517889492892056281569942749803207085455092831119274038652693240490556117326699756977458557056904213255779510915202855844883043490999221689137709122038247543062893244781509507417746285581481078921651558205382386903015422991693875115537304692273220359932352867083143270091586950378605821222994227771412721766565603859269783824560558823099131180801469788345400364135586264908943457372211054391767738982645319886845406495085145068843887044638369264147848910283103477702042957747447301214573893143637059911121057517324109409650652321978650140395458492455315062713836520353422659505546145515117137702301514789239799446131231523770595045177603504370379300632041053420111844754078711258502277806544745941009428781311177323260706794637451429963988155810398834309227064254464545392593423971003688726185957954133422135215949081993222768464246232546600999309159087943845877699710132589934613866201900049657620248202130567579165511861781664013673328774367683985042815369969892269801004909353744485224487046453704757805370583320622982673898512069379851434393054226180460062669044642782808055182205197663985922114448605860747773364915064412419220888119237771659875705570786179259792519214787232981116799650945890366013320013357848415977606423118733516528171251686318077706150640666635223718606443879610475707860292160621499381756730736041196906547425571425737308646855450076095710327742403685502446797533374730177580952111949865715761757116994241714094537107545756361956121535989193900736874372861250055829855276657094021203873760887222242449541799645736481189202756685829876806964494303829373281049790938102003709977109102430029729621400089578954329802726601030940610445914379828390021879501718327278317271073271282812283454924382426760580076182603934483531552187961183292053959349123643916745299312181555481756633905009153276736346563582363465526781734930573342022520729652137838199208428174657569341059392736631649468932251989242649952711615923041136900667194209295275308967311664443063291489327297160134374225463150682028129037297904809671387969495371718225361388123106709966253571665431414176981130061511506222984769319136584724374846940970338283635713914219567082152466644313678192285808703865119588583566299302702465496799091243564727436301109582668324975842466364645806571475193801631507028268192369054903582000894540980404752556246747122597978955205958291437764211495165454512627248985713706002227280187057864422907579160318946481746287911477143474603563572353071035017733317932653387299537641102353384913144696457928044950033301928798155143254229513980838115140284529935458680805675539322752766517885867653322148716767573272929502604794071787217112845645664495141989591975087941686809112262677379811422287733362451280525777656752434726830348206802267080251963388293351351097438392349788438420415920376490401283017989534105357349720184002830627563941054821729453821740960307707624634920088794291928880650492080939708196050884963242583546967262963417783655062268418413466455229441690415986331119399447630986502219335400848756777727246288815528777119175058598251735447996875297345786101249683356714425857505580991436447867788849590125466306537248506174797803579486650827929642778160037489804004352160574993675524394519785077388113500840360348014676962238443565675508683262721992247566977968005337192667816615266267894262420704149029527043631276860950537481492972376907288583095298996993441609512753499800589142678523003414262412563631635655474268462061864806150102451981036141807895555194285238653601427761170987712431133842198722166514897738839880182902241429604780852221217608385314441065026071405042652811396855974576499590294122760641393618676603795606378708032642659831444091130898447037698499529504181464597060958383904998221503684777087075871542368840825192968176072512812386457232047395973950953630442348138217278739187084939556861862848243955223838810706225740468714426897886558014163396392356329804887227431804720154242294553449757908768845012004914581657177704087235822093325763454541268574587579930294538206743955931801650692512297334522625481600907656270187110498045413651490075319124737957446099174032476904797869388522798016521517720061961871075149708831706127579250451471545351137456222433393652715997199888567578792547518038577226177606363469311571873128238353483595830817548190838279448484016860956160868608909782460566066849851635896919195258935049675066406679120721427924851383631269628931835664356300565124992142381751826219350842193807408055412718036897019574551196100739564666052140501172368815566214359514142906651938471385104746440136314763997715903814657521755597792930439181407540851699229484572008487864336423527365018793142274405084885178711330216139270041723307482844578967651104694254544597363625560685809999779920356572124115875561500859687432505201879497980219502188890158714107730512514318733164664713631449719442573858284685779597279107307962937653382807688258499054698121378698379404732666741724979098364928128903284362143952624733419368511639894862287859609865765397457226550746242860548777591739160901442751633583410750837042224790180371303100707475280893879944755021868083675380102831435726272830680428698425797251831651030634660405378534746787626987602762732274263511818831476429132499098557015901212039165909392213398101858562431976357418987229970496094153189742243958270718733606123215543454501922590778373927122064896593779291630477747218666909879204169920984991249757009889457329651321669390698473811478931037441935119878425884025280604059947565384511556502966431636934765125691101947368761036196457334274287754937016324165695448542236801083552268206488465875629398977520736723758943082499697367584685358835808183877479172474721598941435982926410509880631621556615977717786840411731005483817216543176518673191198618990618825779333030793523181447800052950510920692553910737210842066919816317000221839275849588351818164986925433187445660075355501856421157940205220941916331932600219440441271408316807808910693158149121415559382769734359862732445641346981905128348581890315322305886088471996502059730153536509026351286204261102594467955042809909753863802424304245696333123370832061172990588885906973259238103942582262587103227582900779436931677419044807060214205062410456999521147452221195351164341018958248847513531438792044506503890180864240917720867246586955831840375267011253597411322033325807086575742007156974065888471132630761163666335884004651510001346269235428520540970700556449313443330386778784424767934599690798150729893739333708461398448608944946824824380753122273409095564390521625761923635656341187371829457037729917530010610655865560004037510267714285697811669567525510479103086710433330910693681847219536857578852419446745672698314489117048187395740150194068448340104075185566820854714757407304510566417729943266404395886202371814515703786137859112638694092691282151279096041499011805621292110056572602366766561317853396753793594977404028299022397605794648670263297671587926135422769942872161472248662655749417482195422765906600928865397790784129244032751369704916581304381035125092376563839813454126056035444236249210637169488660913894501959600966631864635855114740051854364128213296000858025723872132150113728796357462543022422591878675594102171631295207626730545978077344596150943327020654615025542418999078806407941334763098854025334641007010982671125356642288267644706837576948365738575160250094290547660201264081726328630488972035442093327340715283234662633178483386742465402842653206226942252953385569865713718381047603028900086188259513765884098839960531973179320769998369123899039410075967809104147222195556931094275683320343626754197895223953916835764452604933494670120416833292821665517875462177684515991388234028589003629963903772660313841548989135354215017059569473763093426412326723724256745775214773043678190958944204876109235406027921415109799689183275844466527703716950081966610192915478289594075754875716948948223530243788871071699133138681548668338091154495580096342300742061890959456148553161163987640883774521842132487032792564265035193123126479813887935346157056947289910865751144055980141344776394260765861642489760540108450239274875409785744010985450979101772156652024871840356641242516984890964645658657284784748225199388327900510534764957277054799995406517897607532059592413283468533913343980350559142179465217627435528807723662064404667960468776420857420044230919195801555903752167386738493109664236095232084575779962984395387119551285906897810189754637834485905839485598351387456215213732889658396488818465482487889939450669442797778135556988258750694335395628793930881443719874636858895978647772149927336342780734093416656181125484583895241725377814822174617097809098526116099355541185784475056609692604380492310455837651787301417914219159831199764809393549699432625979673779850575375824699662194699456919040797076622886708787348701904507212563839202644770999205689097631099141764474578050054713740377418708711219814139789012359971155197062404363756355194732188091381639305080643275863676627088974062706493197464459397012559477969367014508653725413474848898689239572239378669552418026290595973407469641977593113945575255292065506958026032776065335163324554179701901675061022993152072709325679336169611404691525045645523733103986042247321251156492487194117748563324149137590638804347516213226797293940377853130810141416637526513532369482286855837925855112914123385782341248506654444803584110550644881288673569748828073883851752810044743114133898276691889373783353584897519389421007695751714525332985998301456473578138685581383301686662364045658430269184958383584022138478107263016290258470101465845865395399061813801813701819725359460903891623848726678638343845098952260803879897467695471558718253282552154581315385111490521680251667955579255383491958904239215253501296663089234730260137509181336525129040198099203383658520615276081802969150401622266923909563955571356184777540407028532817754429890919868312774998492478500497869862177545932538859742860337124501048370643959111903731390144315145905287273070946764138687593733170652998084986508812493610503983576493412979848023361092381921500977459358722228579618089407262050452712269857278209809469155583583538980412227100339462363852736693200999404497561438691778778719261427246196011769523727945457640411242028386686927945316813356834982286955461095456611522346258031604370912285203075879321473703346799042875650801959003963751557578696578595289922494485237498051315789981262846648083510293983772931733426828194046778166358564673782868203371201917017296039075026093206554681582935774137450390765431674107796541218589376713833857832685703325300612100311087115007782501314961584921891973529646216638471163998847868415865602170408936863510978281741867609142826931557548812478977804172966644892066534336550418150276595315217441920455784394320028646645572621272552227580513973927105893534999367780131088312864058458609611664138802215414665390324287900506547058031912582182078200559392837412011183816799299441448254105776515463078886306710444025056623522492755669992174404535015068117718836059464243221966301378585859207123497757575300920611445044648853263129386216812764648018567932002099898907407555666493049256856220684095645995362602720698003756939518107474013136440687404822934884641790360992544870602015505580635356788519907523938872085672963300217201466040005464006841640243439795838952313666889080594779335959881963228069165749254794120729206794247955582084665313892760900850850944738319385092587108828082565753966294777243783406445744165919915700418180598997331245085735339760300723603988536134785381108697086221190760459684670471591184875643789500683822924388387539273693689568291864753778021595896023259173230026166918930949756651833320834550158674492506358163881905059202641837926118164973182042491589752374289817941283824952988252327111830699783016059916945212896761739025301684669883528879881749793307665629853563871538745609217254775945111202453359074560565801762139182703572257274490804403096922647954376329260804652975119304944014821278004437953267525374811827625909919017904347843118379026903503237709195352929492412339850715232678358947198269233578343615060353332075528798711611558782783097504043224723235181228155108789355096484285468973986252990148296523104651544722067686126363727520041527813846752772932311857126839026801817241173263084506823615778105038034725703883590916095250008975858425677396869700309031000904419837664450686871875551877651911973998984528842078386520606517147393797155742370133949305600106539688196753561500212917155800984171744887633794982781990428247437318041567298770602087970089957518017473031858628579026984053369568265390605956899846706303245023708610879168809955018754854992457617603667862029729950047258638187769287980004391775045659495621899740136637963054336829874547215899616556892151757834861689540680964325064495424025123289764426994034197390759919537645391535486006203730563553468741042667134150245528430402179005684691402533005979605515064958774548439846731117489507197298590332224996024054765770625036390580411680930960783768166773269919472094257784001947784122340898826368643005697598708890197067264454164432690573030170431021890824945176877634508667880371697025008344045758509345191814507076730354448970166628420488879908449146322871522641357284427151060842326876476742089482099385861367762059008991632734617965292162695455851617627453424917820958937711958027678345342307380626413421702073607889437067478937940394382983224312516039720357190705514731752273871275749588282577859144460746820365465627355637553188185670391081162333710198580105902740988767015957617870833978224777113335254481066893443091511044456697014376521071936862111008837091373616703597605250166218400416901642483670503103011800847366617898480054963862640162616052854594437669436502380673065535420332035933310980937555049431623499124437073826770789320142907313550826824680243864914513041592690445713159939446938415798560401707665916690659185425728230812769036248347757005123207985049586500093549305752995570262280124531639640250513529709384631475998580161812052857431728411817853870352411014381203105744547748404991921666651985460928137640325104037856266851187772864531249646941095765509103763808262728953256213425116316121554623951185722846075650610405576428600837698749496585690761054216338029879339720600991314512994494663227707402525652096538029222440111359108533686516454457359264063032287743890699742772979885118278876790421318108706265795797796413673677381836129448569767009115804847023939430043782881456375553707013350653631126845673956214039640859303384947513900788631815797934869403096776811517504561065145149651570225507967877744656377100743960519905509252645763994968668972500956297289695174102540740167153285154108523106834975873026187662522314545193333852624634180240060086186913647198262024094139362420025829770334189163543539204221833524839963694220163053195754668764255956126664359149892986989923776958449127195460596687201896790707330627426495344240808739364438172719159255484122870679718168218432534123944040183822372823104190166498597731279642634673324837509160684193746066937945192019046185046450929428498956205133399665729312891589436824156625018930110705612167717471232884641044467742344159982438687450927671794460065787285693298906930577303680175667293800652122686114534483244221925249254152834750714569037193484158313599608963332306988546943324444128819542494574100413666378676890549323379467157815930100755096579437679914134876294160318305568683988768388156782501218521426399032571061572485393776892985994699342935696398003458862059209168653172829574071168842903670733979692106711455024722999223775593736777389281767407714453175432641381769640807193547832803198085588330134664254817079919835506186597767660788226913469006505639584218751514087663865000542394265611068289223877413993677735170135647100000205031599367481413512677706504409003255183649210100922730459981694517361375359163555562629027741240484832410925276941373028023439361893830498810615630601476999131971160301865677285863114568947918970202795976248124593199144785810813864479102554188049224185799985792513607452061719307831993870821617393842035344001963435497237034744535678595314238657629440895438605989604451171676958115063316255834101087298273904394923799009578995441592046293145872042377107774782235682877902380046548540717039637473166068656460439058731821538017779753583027521666744269395929320599749121737718503899096197469974294952253407553034456561733201862954466395924199760566911518941341305176691378205638269358706929197135384367363435999104405676402784302719917164054377390766338163895032623704719007581611537629106894340441587985499650860905300480939747631825002405594473799535232115841017335605806913716508846552299918119300544813050038135563063494477384871247339261853051561028601598173983697575939619318565040337760091264259509293959076196467294721004042573501864307379948060541179982204675870996314218270177893595098043939919323653901435327985298249195817490674393200427934587814680578375741802882321497850405717386202283077753568535597587786225405654151849540678818638043688494229558129674797269721906086328389896366017114573810941475469742366638294615758766370256546342496321752152576006489340642055090809180362342368124777057570344322384212235837231771228215877396020415257823714425479760242542951764404438910317754284743005966521346629469587843308240408110634460239846058014288186788553734445901678744697454069764190039692430781017891923190613870809050951779916459097838095716307179754933470218468863580568309514963699314596136395807346801438035641518259271912280023791575187824107135777222811275185170998846977217628466438367281569233478190983124205751973789167439307281868677412078051498756216089408636736933341066687021338987054503958934468971894767226243545040633094908549756679535769165580620886727584890924190503490566629582851858089550742035349195900355762530323353209814260183365195507535316118727403664540924516978423682997875539135641231933700545582946273111054082557527693421774325229800777160616220564574479271003826042119765396222320780933982090525828931428694758582654277758681393277414542622428921049237839563187408990749637361820351977481293348223349910580529258474314296579157080903425026278998358491623960799565880940990304449727741112637923617935571354630119306629089436462099979575719757388578892188457029491407286586193150569322883718874126138496141700054379650295249067984651523146971490105870611940078993737607741686425323324088319673396751794071398104479120526893166233058560718503400317723202726335943184157168302051783884547787593951067153562187899516459194200965918772616299218392479278625799355134214289447898822573512905520747596293169772701549712789675019316827875617059993342602298990865062178412664197034306779016329559523345953878083184209598628328577302270206515047107676884004783457819627194441032745520255764079813017811849476047842176398927193920710130286189309754639471875782884205618265197832468403939725216774231426871615599368234083469731609921248422377517903230827201323289641348649796557222585951652995569229335378604094477908467596389133947537876190976163325789899581190441315140008814650840301448350567885192235250534163687765843995510223383245849580396873402520528986207546594148418302623625130279378289831478602396644623665724126733861124435347611721547499807514940810523561128548016207522027970177411967380367508421049123951514451176962529059602815663109952124545282572276102888487399166179703492481988769151128575687945528063172584660967077863395228595309391718161494313421476966302501958343514995096831260503384235386716839718410490470825357664424423989696580910143349206394514265345417346086977415167922387150215792207595644008913911541827266575409331987588138623772887525535704261606891479346600478454045869801927226718943306901840693689027959192092270573091168328156485733399757311959331333343049421620574025838403160961960751533987178312579999620886621101813563946899789017021674402753897001260371475891725398539748160485306382739592360351300864205922662483806432287399808587305242115866658109187353406208422567654679837866998477154211008873946750613820175044687598640297714658161529355934081065287803705066291601092297638973816373676419069524373080473653667551676430797948384521934957536135451773624503967698816743767948369250532181340018135508760416959814808348033331291948736765557973917354850387015176875391034244766774006022204343019460159788933179547792904824913846439191384425607035734826505397691696190833410340247880515927220767295632977018483796874877267838305703677194098138795818882971206232155037831416047029399945877370917807173218430780379784785458124638095722051219619960946238358674771114015317880580556714329612093973820343301311358291937166620982222413902132725665676737603006671079149627232246580432461199995877913567430153865255913684252508725796234031691352970672525914745412241994932567693237879304577652047919112625889079370752208104293628900457848445105094703540456942527832409928330127620499929725141264172977407721940871087598348952477592728950715811300749913343491240711848146230472233379084476721118516610369683599717298811630196983045782289331254876152999193457474915003741556787580508087993111903638598643787053450030808002715771249484580845172501451741947448556593980755335508859466219528482291035693039826710981411706954945223640112301502625981225135345479707838386346759697949705917833466607875103850804974781759136977715944695596572188231233274302431981001985849854990053747925784432934246338679377063699715354343155064676377765446126326187146386298880028234907278862526829947593948048827754043763050921562895999742052856098566568430190879639707219824791303125564933544351940130373144314771701824618469722826287773336104278704252324631878280414240003591089427307957887838896507823647785635781006818632274879492957506461779397128328162589956423949303716629647082242665209100633387527274767941677184483160754663075495025253663881762377511172919031519331696021334306519702177323497512823901338436304416840811557073529314627862431284323169615729521308325155815583756098812798875890036060636844512314174458291122086914061172056214323919798433765709940710357292216659272954895236047700497325939891240086190203254525572231806779626271044264223799877705137234675731162470616780945222972819593875871002757078135147840308889984269149082229148946479456835340398149044554602959582074098739726149525599736059905074832501383761582663378144857210254617178862865760543245431035020562571714921129241305386243498497010265736380986313304210113499909567588062375667316722626999712593585279752278652427855729193437669628268309393045364981596719525638719419216507798978811227406348997633131367870897971809992696624631896333148845284717795093559370672926130816337133079085645607531891694907873812532724869968517249231466298399319038703684097125423985669659275190336227701005833659180512466020243583655690690396965207462050393586721200505340245880031630712843883071633155456808110086978673215795446304699152343804834557528386634659067255376267143829868850351609902600339917660850458944380538098536220345341356904047679418376901335269957391772995524726259575232243581916552024420723196667863949328088352182931081506894961561134403710625261607310276726879657048910018465716920197046519457042956705630906874138013140259453527025188017490760432772960429782476858041204844197282511018497471873627453380721677721686062403089122808088286150436013290717567478937746078878031430872146611397710262129894837050716128918616888567735832186262464594696160977415000499562341547428400966508707969736449082812581874735185256668140369190174728849381117892083368842010387690371617067218387303309103654237116718275265140690861166660746233010595667295995078828733581596398370380927404579046694397359873153352642275042682548110161919454470892126953742770842465679957474052871752719206333391044106849423529100829970445049844881625971924870996090668397954005111980880810710031136853926678806801980072133001932930751032823048314515115461922922868884199933151620398616945265203829556454890083772571990330079289048139655920164958415002823203471269252281247394723592216707024814281861427484925264197657214073542451801116378449817911532940220678593838724017071368807533597454326662382442351174973475799943883964284592789831532296533777872294279589892845075483731109963453170946650173304347866289935853953618760214870153514473408567990082679603434729074286991065673711167664245185145703678317715269441904187336147563253754112330819021045175557935133321066150671581565503474988984283873968625035821474992442926383410152642426228464611985726695060865909047638789891682596583217706722748359202864754650118435968372772952511011362273575311055999411425891683392115517104487538342082160645569642705062062907249891248851675158092883963957149785633423841406752873235470456566949050265017335976930814035568872681279266817539762628609367479718962771119598121856627213292848663512857904930928098496197247229099380173619212482355485081456179684180985627792525663016153050200474005747894551119178240362163656632659432683877105256657497360687114236178625947619972402790580834340659507801354099788573571272501573369053325642259995241515649535911304958701267703809150200824270329689611526853555474129335150467120566949726989426862647051246398728749370931293928808950547741022072623419414808534891274567651423138950536318004146608570058585919892848685100288928231230456445535682315583199201698891037822557343344077192654202542317435233495216435078110304549173589840976340143632760725286026174295334051980707988574011206874952463543361628556206772802026859989721092836127724194210095124436640274217953438299911554933932234348406753717797897629382694099961395636301360665215458252823789201649610367855527864668362059127880519640231084534041281282654197553436543011695413765379321245814584496363422918655257370426928619728844423432787543414715045289683885353515335029120952673815423476230674469279449071351547309687170136017887582459525806964880201110375572719079401173856830726679045140049089831944682200076084811316080763111251486279003105133579087160731437716371049035437645480039792702499501723901174582280676618951243667869422603505654821427530706416247464947508994228940043485197951035537394056641842905716193626881964744960041425759213439034484714741628759899028456297066917561010344959285084553818359568854297548906127752446867770493223481970886211922560986460424228531364327813748436067314570358776813967170893869323077509452932783826742782688423637513918649314791811659619163193308609008237513417291233913120362720631108629366501863585340387911754874643453012966458060475012630629669797765452232819680285234073579103180885775114253655622722019392412259578361565543384223502145847889530200172269756803548995555276528127282763356705804462857767110472099713464037140082343015389174474630465520943000558316077404751300860346481243982373015585671230554540681446546615897244906430123673442302573738884535676707674812000725558410181465199424655139409043799375229308565189034034376834750442898213010329705205229443872289252407571892655238220258298020058738538779258027181599431300218953730519122420866624308592238368473705824539087947259258654614510699242071566483381051126113410679622207438857146131961250856290523191904007528975642386863517877712696631716617213011872651883131155332367666155483437426995933798423253456831661350706340546574534019777289904014422898663210711941504495494907215060542136092755993208277030949182555784681146218512709660497681102862639341512963677680254950752368626970581789298879862768552888016385733222368107882467829065202528155337356099704853714633185523916777667026515270412388459437473921788960298529326217506754114302350492275234608284190667867230705446306170745190529344816141096803850890247712438171870442202122540253180600691354158240716116222455296295245845446922794989262991049907939196312516865361146413487414391704289736445269173897672002378988294895133072862367612825832022011940700627088051278901882074003671733124809764349031064853002251472676568329723654877585625407459916077423664323151438215042045200481689666183179118253793929452615612660753529559632439138712645019666661048169277272073198277206953834129138623453665899844293350970577742193169755611280128734636136449838804641188960440866515665614304085714001284694068016538553014394151834018933160909663110648558812154296489813315687504297957184068254668237951414718354312992649111094444633125943393128827102588880217542964887719284186504984995528501445894779971499116174057325642575959387025457244557880241274715702432956911131118557632807312344624743017579569630419810864390642442299256886845717741182349226300606884065080169152228239330685476720313194720754740441879699633820045685059504588167828287570881880192172092479522612865993478852784099278056778414326516773347873664453173494276054922115556812589886084846526097927639565184735210669440068220775757647611285768950300412053030965928158408897278484553308918287821140251021395877464144673986114789988344463708922008604896966687971745614002154545167641248763791165776624048236998245971923347816319335538479826869613482335798894647483705633236104496208506596191025561150073595038331322483404302104967647170721026013601754089935054215403999546764341042907784636659574420430102882863377768863293203040475192700096255541897173045364791710436468728493156020215924101928708198800231968343081598134784304812814354137273102678483195293270154523600892959661802972701201358223150531454163901739826082134545326739755591294134495925250556759690922521066253391092768189539432475754991595420574019427835145188098862643754244250253090395503388953024833054153549340550528676519042969209918100096915988761031152885628347205977694171386411350427631429392781736970483805928598613569494977904589050149765368708176101444188335152355897873313806056122970493421834904688170632138687365055060499092875189430841899076631002964875162656992635822568181241984795600271030232097305800357428564205932396038733292245777523450006545048413572936753615363222593488351841640452356636863693646209948218209472408634209143835340811879371516149238274298768655676799282202430351292113889809012384083192587131717717302328691913333143831454619098012929692914339541734791994173288936133521674993615084202096488292829716637874470815504266430047439902164434577753544725871456817606362964375344472692502905813211160875605653256630643622428736524319101139588839396143920977052341042515931571189565150064874302365529529579939990954334527390454701058434817750046476758513907589160424774537670543642109683552895153601907517681411199583289311545887648214362192858099610787156302006623696145366841307595830578770017050988226710282315664413934533017409813564094184196009417498972616357890450869134400735339976546834136007338203425070113390610289526146695548672486855433034210878818515836056894518421126906866276458567324542243759372078793755736621594323520350302091585999857504009787498777011603121434701280506003552295486804741467403398142193912266222808391186775915983969835580677264542622238664249049642153302953885368765773974200340855390044800456611795777276087306399213505268278072572277554237475285113777520656880830237954723917513723572807480369980393414199437920386067836179642350755140732293409946170546129597564397400796180787389188584558679096578028630932048197777182963887956634210716124366525427106407301885476280976650667507753788895640236543267277039708511063098372450472162136564588041163128750831357496998468457971141264278359387354395419223271441717494821599196468635660087807026042890967372767492642089048738321060365681881026694678605239968592576776195341689036022706895289182213239618487971900664047537455613947262007958322914243963542548537374646545379057599747811575380917053669232792456063192180326139346605221981510949841137360480526736402701341255412086932397299263815495642320226842956819546364365741716475264190579615146184610643588422764707393816775697709605462746219861180534941681754893985899152574561273715587660039889781454976544134608866658937564449043761053380705583282156470778394632235537723263522319850714696592086692446963370224695539774748438419527526688225696121155104040077107607305889396622893441838757448813617122892320404424087947023894376026563986896815379969793724354853487463440767726789331471192821188751105932563714830348778600302944946985925467618999155383143037190348182061942365604986821542758067507958320039882811142321134078578217990969047666522077752554976701816022856745500464489724822565252541618403821114969767086794821684341193850349246978040340750278010688647536364133491261928373726844818079337217825508703888934394193160272455746293002089707554926172437163845918015200026274090424600918484571823525939521375191516753291692740883159552561239633209453497748802916356324217629819294670508323759025435877078065765102303897586880425501121822390804937485219716397453519564277894690982631567285177717302803602807961251179831029359443821559938485774083102526228263510099406614629007627083706289497577830109452606969327859327794829519406574687371061846458205719969325858860472931328126061855022465154216653305242018341660982136183681751886776912775227676691939402951817582298516027313615712922088874968833401472911260365048663710339097418883113407301215373435643431029479345860727695432596668465799409648039677703430634991170829073501151467059667823876333090262825988867358062827070079016074044011922753380531591347241113758702380445004478854999386630287381118269829850115112379120398553903907338112553958849141731550692023809013001465449992209946170642634202303525627505068009827345807567837253185644290064918696720885850655231424831403746778802943021709270713289224169186450795309797721040687220257537471850893099046981184400109121895676301564795630135246784415482403307248764314388951486755483159685741754174268500608661442047301205969949575013886250737864450582934071693555935341235083946124911139721756481277326888574449945945563934525284158536655645744621987309886568846299217168349147530718196473335788021137513562381518159618859596375297446188337877702020358679159835901023462734363002744415106597379367235874546926114437610653889908315612255509278557532820469720908514785284727051341624452588582972172237283981114716621099664692687448149650425950578932908802607124426648639126603055962168410847082367870038000908264701571336783595416802357315010742448347282278489213445869800223920262555929561268740859024640783925051942967542202859010310452430119348287258025954892916792123928860999247946154479155429865896438858894664700119537815240026311954306504393429875166519858938425451962020823155473620940616395883106316822086544698184157865566186951842199487657366380562364632930565123081646300617412956256103654012989541644951089981385615199622591406378498470187164395949233916744764290089297263452289693530828696907752830909834759700703794997652774716401664205145944129844513056652254124631525923655848611804693826252154346507343463649132628942097501522986256082022779890726503515690927541155898291102600130024425852475833101903574748986918793238810186546526231824231193917304925201039662199793720926893264518299640890772452834205320510833497964515371676152013182896613527270118021577764528057719447455169272419780454677425064647058902911443844966747201933463383588340102836300410900670650424137211611273334909347308366991634061331243870026023710615793361551893318618065857409646205621547247088930994926901773535419185845634988226379087687343685717237369605408632969101984483361881139389181108803807436055718766381039932515276296422587031408295883314338104655032492523011874965017730026643561096813036707977382144262588028094164118911603343357312779073371833526227784324122899584568675001275200545609763710239004297282624841381976223760419547026780880511170854257428729893536923863341430806378726894975354969181098012819936192390655051170410305958723227844567711531063192069284579784425262147529666391271809398406239536198168521781906280746883636315371145240114144601609957276265815260752209399391486373009662677953423382936448022290232712518099046489589500033555386788178028989942209482035481863608579155889296612940630328841387824943763531104668710583331101605426444098361072100626007166928907458962705531820419748362023067088223762775094173666128373744440272944866494648316533834635997121553207259038883917931878211974829634660161571312454938207890005405210499223977491232178043747722924603238236023509528415253240951861705195400038679750562902574131969261678794573699772283662883240897280336386247572148513001872472906585707510499060355273632084207990310539118970614244830002658350872942281294398127204912317417572273700543483513660141277045757559995422396220231083098349776642690254027197524004784275604579031650744366826790915588364770436294457661868895109860618414468418385408765714264388216192207356774873253039527521013555406985725740044279760298990610263558488222895816057737070420704971327754619308698137133708669942277043520312502179323787512474019257217247796890124311706499476191123655521713259819587352677251931014512976581538643957952658101371026377449036926883271022899160046691140497496583871485026772025347221189661264209097171354185413208219770797574023222456870697849791556167013554577621203144720921684938510119505402286200313217885845936940525595384999109919046727857983360801860047372659718778374780862837643976309978313671533606742092070995304849950827238700554185495109316150960635387409514257434534792927695814430882404285415485287005179707233913911043195103884024916381923854519114791908360423092589752916036362870962364333032941107874087397213912441779698914163971161935954474892986577139047415155094438579166464433173218067331451424363912137821650959043268542439620942990706078104827868016969820336834748641544121067759559937001913922867174169000337344758673084094322828691653857614070769297004804157976435419078008629304250696588025787957923580473631624047191980631039322498035492550193830385964334655153671415546928570395637647333491852764968285780792844421604207917326748755999962897545260906148175008149129848734191930677897807599715225496970491270756009152959434870667717310014222953725200507346596719155902795856472437146302443309714894411735683530019939717027689415251806559603069516303350706634498779456307941616912050728843920592398496062175150900168038529333476695896701506033062066768120850718939508698686920382486637265348009142369414472079325315745967807942804908015521559648550012270312644126869744013909011958350420993457894652587155649468347728977610048998050165662851204566324750399528731764530993828244046932531507263487523321768412887938266721139709294827521987918097418945312470620652490992828698791378255471444063531275994868905590471517950180327194125335323072983103636752668518808367053817007055741019048602524687152745855216544216046417843309640862631370191807285433730260534794174721236474410847684815293709911901897698317186022180115471160461047756910774533976189747594391697355001691276615590534771249540147705916923017688792025582535293919461134452287659748040277387618778668483930076097917860175966965170201042141566985296397397793103557447059891808834200187137633544095111670066099997254506980105284318655521294670617885612101391807331254066252484778732470960450450719230326631694701976578377840330654529307807030829584453787148783548396198830408310618155616799074014613825788582699076467915312644667234955128683297115379625777889855229179786984503124791826139353161051122415492425767254661391887610694566913579507901233534442985548254841768938994839608139027395062962865433324296096490375026110099521927777617014356129174229551617453147602920190562585948248163664023031363337467728373454322661786241327899666070279822701231224556881378786505431007675298082319843317000116890423226774985577593093323424036130391366853834093909192199807993974346242684504579122584462153229566348148884172317994070407865515916747367188993366603185102352019517967750493635271632448839087613961875842622522778805676327743423018803351169315468872814611017440589084655721686832960403059197535362038267967565249944763205197371792689277030638689379234530080027221445243121007063054274296066625783757714316008956046336337098518680774197168979559565518495381688060810646277292828560947483199950264276817775701686515978391161546288252772432701336739936470324952295123279269160961189047085921326382779265571038563055586996435481739410441274373250093453243891652955747851822802873333848063678344315594910215627028238040052279646162280302461115513348070020829843282209378658222851179471990340281480079314227135012139797134484289082569330135434907316735308695418038390640278590763852082368659569795752545889847631373386824631351369673955506907241183198080414718053766373900377496338007706377561321601390808942899647925345326356581738742479566362569191516557597923498217362663439648000788953193618375057787479253495309781325456312452878422729293953166912088227300128272577198140359773908946997370467087676810596031354494679805820384368273325234380961109530033061483658574045236371260358285592135807633467408794717444728510313533317218959257016025304566682278955552999763687383662140341917566750035214907376108796645893068475786653604523369218332291183359528694247663489731487154812695142899266645229387148184052548396603865485061603619415664484670696512672531673883915803722874227472504927369037352708620530288541710875022779009488687322456785474346379775027930041665865495987305934898217877418603347951756373892923584892488152418015881310300420782567694102485027344391598575873669682782762422459162790036298546028617651376650035806990242604173765232766945956104017853604599941602545709776729158614221330690421167889166538995772866841313050613173955244256662035425852508797559357641515222871057496721534924029197361657801057301956701370257569104558155396684162229443310706858587875630018401694607356624546780109020785895111467332951830904444100035715099540881941007775283364457725114908281721521918861607793110880587691821095077609302673568031047590941963174548589766975039398107387276031928927089640807556889953122104927444529857697297245993230897390378387309004675525175740871588937387645678985901207726931348200042676121893656990698970772351168553155939514914191318181546023733712120703344745455779967350749406365637081113992202594533047076122102871752733134658493117995464443779830301325399756117784252581666050585558385602231314589831672230743793514309814888965649707511870583062415930571501783733676051727453217463978184336049761994696283122765936482935692533772482965089840577601898624452740064596914491065597632316100118155445688740646949412120429956847212460273098890837532295634655376498983462329982427359305271759771233025556799719670236811806209354718918076728036179969660940793284537404857450116284206479343500594042420943946289119230920441991864648910593450456935975892996052122494843291665985177459545504161642089626583519399321418675169405637606117351913564205210912552857324977555001980352112490180607731388623604244113603599106025710927143849365487318711139947348656083417840230739413394143385570823806575194498476942992800126612308825454515955973871313196442391445582462015748763913101256726089186000262727276940241001600318357407241532672269696709813014399514220327341581970937140711564417190791281375380444048554121288350054089974611423680521084510179928164564825490133658162039208134115693570943893901151980145679094533574927439747473155354761461934793423366809244841334786033379361074450604794961753203303832480681632199813774459944221067100773684212116178111262940730732429237231484788007356277551950618394164117092348986698627825753429092479321396946134328277582629429502782997581634271005223273342082689129696636120465210558459708285669944804856286006245145025427615575985138630686676542984108146552888993141140397538055324189790731942872570035992798018106618191114622513025709247036275743336207153949283808631272361100038360178302656687525313108466210506401954620276935376140239567732433508310569189180609192376591295818638052452433799682991784400700958000243909642297144038561176923007329980373291164737993121267740304407614612080489675802361934583488068905749862575570049463377907452110941353742648579412375228233101889405412771915629489016100666951098082449544611641153957812612994884284893074037012950803254237578636530589109534153069223203958108218857408700191426706974670205199917117399231865042138027867205217035198711929575458048561211903283924526904118622144899579773501012068864904567596976475244610111307743471883148863535839807695022597897606671511254775250724146241930457632151114888955323599451295081635441763488281715852531327359236093743689245581676568508435893438824791902706950276030748649325983683311818158119987489293213245849011057636012393563204786024938570481828849041832055659924642830667836538742593123035581623119335894123344894234683671139303737533572666539117736023690251386441098844834429889153336024804404947481359618639653111287937026582666597787061670993376309160623554795261495031084988838735378139830822122859096954388571504468110147380141354830797863248187805313523572869886665199719887024080938509349602955666035078314229150816329606081141283383162569899045106551571445987212216906221420735002427632236782033770868147243494635412324048905435313430710326830735191671298939079039689143685155517937766290205651315158797201931762691392404628322554088776713800061176599335923312563168900937729810595459805960276921342693279866711486487088586938131015899064730928952929204516199809336467196107428556494802912542299812676007818780802332850298498680907545430874587389337210093619301714688173808885716968669735955451269601363967365082059486562455558464607130462770710479764234501986951186321511831211602333694843608404838767411380805426577456341050326037959723270922082708326835824917686251023071922188765902128643565269080558852869945262186223026515368950174673131437973662384409267727966529008752916761533783931882081341933500310240473079190852984234602920798599755613978706995359241585865208016590708860850080176600140386965279749352611760274332987091958475773727369975808332055601086438898620186106711894141060824657110531202272970451612256542545949337495892176660099812994533422309603380315197890309360699221660377738686336513784591688063983889732699792427163041196691104017175677742493626489423906436477845198299479742253494072984190501272872345787791386306688570687578276391152331977128770137968337197436942482517927250897077476611941559550044724891618819250724978357568963106396528922091982130482481673044330147798934360357869174656815142717798619725767153603276991421299785328154034339613955316931992013875292219526288284057870485783166778356056127741226185650630861476126398710402606487018200550254898882815530852724914560997828542273046368710108137820445103511677389833528333774615819623386818628740717298536494682907957395546580698201604106927327775687515500702167640516494321093607658740555626087742500548055556109717233840752726818340367471889719504556658410094690598210623689999413499542711368918849790853169852433282466319944499702346029895927047230598728333347063067680497980164475737674848478236669942361253623342413435040898719242180195871336853643160547141406774016462136894219195337557699202434154826713382598621619241081842434517788073869353443815883512784162878996713976405574788540422292028138662106932224766422110629024647840989645949097635380440093760611619444908853992822103853961680759921357300659914522736132497333111676197806873536516710365477178603900218811204877383528320369378574121409810606883778737731729884761834210251749581639311246982680835097497038831351969041734909828566751205161402560396893154659392768898738083277903358001160804603760220234849538400861075988455010252397734145547675487244809468934183314542809298507501238898642588241890203074615054999971089211803676993786893986730337518218607663769671299672100976787439317641313130815000163861667828086380368183114403076461375294990075923700448296719110384342871305819750066907752286571133554556136275620044846878120490667026099062173756072848885894251105062198195467498192599318045561386468025711448675208671367306483628503719847778742752276249571395631686848264831036894606181038624215495527331826789006147255819687631795021301160309819207273830754454571919290813141745739488831945808531426216338455914553768909983238073872843752578087168930251735113374501342685823151466165226050706700906794961971385414390674577945957917727389608241633299346044564998233163204550685985483886607548738056318706337438288559717842731157220095794530163721364519498028096211245707668697082426902147077893377994457386056429847206971419237150889915072743078469156867939794917447735276784698362322176229418948423194165408506324792091631852127493689094767503517943702094946641404334981763192299997386681179888455337064393381552266650987744995088440036024429067253776701886163061788152111001629061842679572692661107350022451131564038401982617754286625078434870736807822153326861717024220909546032617851133608857825653766455237910369345138256283004829933378009683251093769873354153139758658806349535263406048273649879027961945003092228324266965235532190538247721044262487366580905567637142763335785189839272164360519481684193187902448768636863734949578565729009825575019768392248787681227124949080590091468791399220653766421764655417025096716637788317507453154997843255815504030723093154797333042000474883164059933396689708157182447594328886737416502114069918769075306448311805012848043359521460125343004724030843019227439758790112007830532064958803491115022204009320311574103306364852384694740516405318686628335243182959351176072196974442045806148815251003762415598485827846458278991401881461652138774535666299670483611397964040193016513319502332513644347052613688033312497661519749730166007378570043933143583938588838992589669055399513124225883269638179328380347087291184995432867548162743535590716650894089205647352232634166446504161783015107835426665115599769011271251371787736493937810272299988608639356821952000222860712301457213061312248003864652687678924504309826697669102006073312931600958191553439878754910463859339185224563617652567300686818392779130875465461461676107047761879471013380996147149779797450081059775134071618533941216259046736511321883105844714544814939370796476875055987790247158195991841361637042184788178687017108831627937635395107393883518553302851246754208069933534951523227491528798860212901576851811271709979677659452444037525133872562153694848324616738550122470949372517110352207675411484203679164300849735918553177243568129449051395578743952147657513929866358204652512165116918595143087522542152559464660493512907428447740567928890594299991793316086416148646719580451407500844524402920468221173871096727288426104854935688037383485162053457069881809999635777326483345004026610189719592162953694663406583358560699587754143749902662683216939474913154549217574033231088927243458771316345587302196827328117797254839600849381541060173291955098914188596445535299451390571456512344176937928066804993066268265723722925041272991885442774594944831281896792407400531609949898395161080574578861029919740280271209711828136085828859233947917261349199607475223838893344646853103552448771682355688229358569028139894001852981399847448612675170766656613748153528084804555781095784219823991093243852090955418293365688573326846519392299088330665187489052592061589079334291808640821495646918217524682399301408911243289392870411159910044563547630710037388444251324339418834154881717593871907442166662861363417925538385303121780053240524735393487821138107986190650332321700239855058073005640189768768349449559345709824881244576488737155604622434570159497606883545727707278429753972513365718938777364999498855259618527257768827439900379637363064247527466448024651357469633790006865692135098324547215560574194755338883261385911192016480173603176193554995431351917851126910931090455055128520518876469595881468232103442002495490338866289874290877314203153329816205057916225315063823937766508471806513685047634307091456645188825138529135386823697143987152601346791471983150676689539176745944921207527294077870207993109908182074489774064403475021408950627182880271223407779421943139417484904882229462023629893009387896510648504622466900337125383022999940712616027913229566750629695982355953184822032243120419428909643188973455283911900589464149476199210821849910390291586650120449269783405807952993458547306191243525018028750880533506471576616774642968407651608199296206227006347240642699710122867303305841194729053388408684117456240211252409936759724246678927915678133992146393201245845801843932612983087421241505555557921597558265122435275136672570626049693800485335682392189776401018339854554968527435109319946551088828221490876493149939985799319366936479170079600514219783589164695359636102779344309297593708540308148879817735498301100890830724381637021177988570174628211153051939527639946621393908785449763671836749391404583215917334695194419697272957171842147053556193204953434706173676012690468434024430974381967484623424421842614840522746796470582155452168342486212290258662643163716429643613381089518562528679105017858891860632847437760441342839677835704214878352858544277062374436541795274240734934941378458570696809776099299970202769672776716110806899676195691444991833109651420869033039668420064558399531442297368618289043516664140831934984183286674607690372602911978371621367388148618660549367053696481094922273896050585221831911200852658290636139729116094135685325370690297145591850632625680416249264785830195647587378731938509560823625474160410031667053276888449522300724318904417551693972685457542517406471198287060497676705479265354335938594155661205034844926927870427878842221517879490041463902206508200730773354390627464999924020003239118291054196455622674136452837342893824197322846714732524293071986455241135908282215919774134408289835102170576367994949474298581479359206831698477429248241941808313750321005842602786733088853025742319649092124259996601988716260114550641248205318988718938794503510948176643324900706957497139928226213220181425492920139296353206620551975843179860786147662911761985977700430185339472283041513684257274556050515941728351900885572186749747715971348867772673874083102686791614239245944545805570117187112144655245731513498012240537785903379998226620822378031283885990365566416285823996766916358442840494332097604327814244409815559785441178939985892918819775153259761732565491629123302491892024416997682038244846731338354656733627544564093332642046420372388229186749729883961321191516124474879278900423500612542969063982173475404811807829039735164840886647853828504995981470889073792764952711292979104694255545808536682697792222687752087600455100617605112393715448737485634813210364425206925273174335625116239736258862954564934399396119692892587673856726895971260405402729779147993293106509091076253648777304976835113975812772857749719300124596936847593049970063169261252118458532892738578895425084474214445509058195065041059305773813115022464037114241643943531667110181876358168710587844939841830513489753155360600168192227097122067460708923379812014759348883731307150040737271442458988184577148975617363268838743654518305175270288097815938313785116474659431803078041187122083462726835465950166493384933585601800377476625019311951046183423908273604592783858765251101082994324031758986509125376949134007589134417150940772107570442568442132362074489710567091402181251174933713823861010829319371322930648619872646319199173984769701563124151620163449157376462684096605421489433214258661796664470728130771819058722544542339123427950750744969981383386620866561779865187715065153357556346384344293614697700081108439789801729536997400374505374408167359117982111033249728661364467096117530391646366572304813118400548574024181552210603322674796107542124818701994897731625143445382235692896191707086319311799745567875966574869564551073087944189067851180681929276404513886467791908173620981937854799824931467303259776964563104056237942799588767211570165031191759733864483294218207674703278821215136206656433377619981157705598631145249466907670342532509205489494533152323530782562070662281222344723208459213736658368106825956188693905519338012286628881864597409446580652520974672240337817425928524576809524076305735055870267277661788120611494464733304676487523183857475842239602568724804619023928202268706469477317886551638339741761733713650490754556904486380046302881088477918513307856649446455169991201600401784479934486475918433564182208897215589019024822739110986322671510127661579192773904467702403219279614998496209904007556158202631581647930335858282220309811863515442647877688726807168327428813473564535242842419729673781890813461571662158474357639451618918331742419852169556903118181989231484252168323698275678662774679704597740591848770552170722673857297131065095390048258769023672513079614997350939786805390350200367175843588544112682819032785654351676650198987766395948991025431643876335211112440960904570792282582858498284505962187456114820288083130278111438837254012470939253631473912467601842845414146126100433144744853209488626319944761076945711168706974011490612605929221571225181320979769308597692919632741646410145766983892312848181660336554282372718182259622674879238300398400730967734433835543650718340778045408979236463839732833180197296987891170756214893024435022522643291593064525921050346907417299800547048735269469926408519794626448519594748182073029884385466171505683128726119064934935408872248132301685771112956727259366271353596666710719924473858722623437365813917343132130033476057478630270029844765401718237181287246758963028583606005975692790484149229579443660928744863138946133549224650676320905252757479208807530889866041855450482662253807269376679361763804330687471742681473837604115602386640554131887831535581826904351076093832976507694213079726918486297122264811673688782210227916375379946858563523394684209887168510294428930438015856211064347888758002971723992314511727282969603934453895065887059760909739340766758190509855231214985192863796680677029544375899981729580600019046384936022053920763645051659866560945371427717484858590549419945677992992312561024536016208047028185854967952177487293627376307117864829871613328489053671073124602366642105762927845402095336321499916637281448852149161606422304205365895470913962324603618627992476405542261267188979031408516766420909955064267628343445249150045645386270696088376831553656597478764674670348582775141225988861074632430459582774329929763284273272087046473401637129749419327437770539296822870021664120399101054376421318076613918347191963089640370335699668951324656558204985011055012927178971243749257801864472775674299999767697018138827624548561766647563238621187555546585779328681713364228835934570287878995783366996925910410536683808940329437645436103771905315419361382744040785048416707736108590981797468444408821421071601807355884471496833456453444999675308165648340776019330817862812958711049685289601501051377423559888139943926343165274112057759911862949583948585232553301249638653363850260955141181346125027983711602651132033987910183693806306073617978856906798242958873246324047750006966007099787711468622473699656972383514553574280058470872720138107262632230053512926014773827897884368586400836638425400795851079017541909327443538979791035139891012555257818685026261045096913442153181559214619914550110181717745823482272941978807505163408820970991222765741329821488950950677793637937640678150757344431600261263043649697809390940759256597801516754226667220927093106270976888970223496464732496591789956760638917103486485982741228329105101378794593542950657030303187788790576459519769685747658212790079197520388856610382375456277366319764968933106105935023512570586473632221856442144273999234615631573320367014514576792699263837750048534384689012856213981428394412461387934722370991196092919126150494457056328696194925050345362884962293849440529377489401743131949389302410083047532459492681765340148113917467294780944258257130925195229809274043685633334491173615644291529183497048420235467495603762370034449152371088444489204220469438388934111507809015201312597540476088797360459411434306376728324815085667818711664889321895507675828306233265994579536075930456017187321492632616270045918646669955588675709128722248577269527854908621810108834218678436661110446426107339229846387463990894850870112151633946217764769028870064896740427040335705826252813061500118342692635946856012378544458948434209422973671941368219791613107749321079483647106630921021777934618606098066820275372495535268722010078934249951332325280278934618922029307937419166222486061002730499045616645434140374469629447659355345454513134533928827760219571629980648792904789396935980319437028120937487395787440248779134166831878549692218762797429175416158519716363166187823714272743451870774296058719823999854905827640427846217770823202670441418876498346313095577921055648568596876406313908428199836037459026336832543365337951587859579307881130818098154649600886132656525210003319124293877958226282843852503720412192773329287582864825716043288739516739125820453507025367761154068168181982884873597751251889438818484344951423506020145042392265909356514889356278561952930447130356418983015594911710456900643105299414462929245288277665714725258219913412977475946549919153897375651530055069314748222993423277512104140736972143892892718155591351608437018529100076075318500864510703556275398102320324452898474825277597420917980943521721648726156077521579670359257281211621192296060318909582480056253147924641898963073524212150592789739671751513072862782938263230976365274261196287700884747166673511333723922095478699406929311306999147419800225965075066778109895451283030994221329274987910776162133388766432557898124205339738443244208293026133882400361504330810205783245221246550145375760858908100839321775041236622943472128631350473068484097833708740564795102890680704886605287597482727705952867098422904269502288881357598711146383630157917221076342308037181342103075602037237725221481117552688449430371333393483663546288516088070780279947857648150313607694551825683119404420170149321862827386119654957607654217877432976782841351225434305982160174995449499172431484541727977847275799102145802849754483461087507885792457615134320112204283313531538007923026238776895717398026942554559845563776423534970269747292404291814028738758610567183865785691055263080427877882505080141590368669767515188814999971065301454123447028710418474691949733464609469861406656138702372553391757387543755253315915898799495753200629413286297352733056081723926051949231584829864920460156951464914581639964500964765035033488531526623806411324845660703306367966960365048261723302828723233122564625784164568695804959000015359173336287505206214548883223647294820056270683073247582162085276955361604209731698689716474090159172550123107627769124973277489219764697574691698534331081298150081254156813885833343462848396893246226268977945541042751831660322289490729470856989021760949937216222673708725152764756789237354105668991853614262813315672298538581947644700461321360706126877295522379011951280259344678457382240282179634394067492172024341454164904612102469664394110211541876446435720197065410092636047389630549249301709354366943017640759169900320850716781792010020444669518337092476010543386087759185570133446932443639509223307105946009178998231595818889268406802116296594735157648326598464884854022702893739194773248781863914889749674581203103992802362704876795452108859516380881329936918090393477240124780949064427317833294099875704661801658808971929241109941527544324120070556889256990773980451389495574534549644784510396312853464068112196089930857375821574084942730482405209985240204791311186193109288367197348629537826856631788104382336503642500253227307975831044241194733233570049114744879759921510262217464573324208456243531072572312462314301821591086593948048285681018328414903916718395453241397584140681960548250600683531384837025901899364651134528570442530996738872533927222416027709211261662904864250790902401549963896800217681126593420146053398577322579476912314583044924481723155283783053217388954340169726979953508150325404596874658198405451646197679282084489924727840424384439497232255399102116260405257923243345552428704018662888235577702916969751691980772787363933776119222325944925235671360595697324815239742059355993389957934625071599031123634889064316044033554209065098407073594528436505439421848757167549486448810638155727298918800390470774177864818161514587854885051631893839379345764189510254580190914163240997442879148891913933749123799164620308179942056049831187217217979221484883723764337210162598388664136519253447962068279470581020973719117265710161583987189911328763855014625630265408623233067178531076686440239343448839433566314485282397828949775360153238579164421174026514419094352679727973343524511663908107210284470411079503711066589862364794000889301346465141425938659964410872291770844572899396933175849856065623726533806165596721432008739078503613648125222013922871757760594395088032181867776860660162505874472966827119806776705102421049577164386943886122707761328911974109482038309700777621460752010252941643715359137219215038695045115122139347800043404400633594572576728306542233802991356653472096370637355410654273490835474248365927470086325915473863882673377297883534162036173984925654140261511039816246789307831095088093253784151105848932657684808467081550423197896678687205635215464669198370481639041857341430849774445064792954290768581098462660545268718604088651110337961401080519831420326620267546235613336241629803802066808652969835081599101945119825988267971166642624798694321874091741802302994696380567076872198618487445826340617721202341861568521544287547862961559005873877481253109843266667103309321129590100539530425690534178713549617882319588116620707964688002413720846376332045534481338495701702487833417534104632002615701291819214277162841874715358812568831766843175063787113256314835505885839519248355022792854218814310031575136835585090431354735363272685979204028266640262147725147958630353425693249213891817048609026437155909075213090013413254215405924789810373450169620277446358808781088301660396442812600674143632093718416886090120603384588876417072023137828980813316004513979597011659037559963435134447086890643971611800942645813695397976536273747814003283252911993110791629293063464642748952577749680085946648285783589406878881886174053699019882132412320412224821124161647570703187632276937685662946399391200155217336083401380354759017253488324327443146764575335484749326492632422519050733977615610663461804418103132416474715665989942268095659152832850266713123202825797291909357902799872372001380038021164173811589381378957344328152174353938297221935067964028425853523831991299785877722368496341866732157596547216348117503868852823292938500789854479996984969116045102662960977456889669855676400881017438104005865304245926983663351998917774077840442470446729122251313183079837233861348290277890712026808867266058498884841579802637057313756373832522704070072034713326858152684075619905176430215170165723248965515266262146515051658120353775329722278241480240545290432737727031257768497607762646423939681231419127433732163663288522151630248266255403475837266957421651268518072016631260078735139499343123015794414797105896556368284021222401948951841760570068123720440590041904417272958195005042329599229747703403295200331501780552585571087685123872139993229786242263130911673736236869785558954392615459502698527769848926687050730191329772915476490700585215514339288685468479319176573089276952297161492496657426415426995648246912406530630894431909259580396159224430296013618453202190412608838038953359699215285964663466409216618687866624673324953653153780864080341017086421478470836104370973333593466367901821078888671849348470921517750086495862514868076739032491621545752662332070289172941344421440614317310104501881805832813816922860951422217574947741234886591625959663790405125865269321185007747566377721111370220297094395883715400941759945623323854393313913183875911301047443097671877477976876192551932787731746710794575993892863217823479025493156962521358861386137564769134480225754123445545169996932282019425879286359893603189681972523882903047936348187635169529061507134895329777282015114332406920068087414788763113966092077631424711115695438961942678473773247000679155495950939069453891187342778473280425150093004417203761216561081224405676056047393574544684835408866015660140213736061043119485064221543174154306657883473091446836176257681137578011454593677219743546334590099959004025831663547278867841159482178324607875711359414754623005017576896147081622726692929447181580127875007138154941252707665833290329708434674936985864458847615331784116298580721662806534963360929026005347849826081494844096646095839227710471611453976893199989924259146863571321758299099522823794587917871487950653260535979376938075483144750117462811394856242664178391205688194352149498179695419592471789080231955949388637984753207567470976296629592971971838770454121622415171863606479701929750360081537939565445103739054172347828875702893652934592136414151825367743394598735575194069602650163684754960196924322370906372118168670067620129257092779616937108835307344846279064836912091005494691294959207126540361907499546852004730165178016956443817209241736115790572927818747644105074068490260370215681987179731677346763819098947509530279012169015741766420997111677943322046472519297137785328460898678633414668222608207267679577384080197504685453879816320315383795029770594872161872823736174176850608897583695922090426502494469489787792455892373093179812343447076113945457742137278987260078530187652016563549376840747256694087465084089910766449269662495153116125851897804868178691701446375954053402184988725011727624410591959310354760153708911615472400822495978903527481275601924153932243489461393885896991349939990128995914826740938042219441224118610187338423863013783080030989410692218540914618080070726030851566104662547160786208179266315227793750854239495071352817478367577325891811995311729704351525841775885125754391186376347592698191321361885383311079427299558310360890479480862776092681940267355876860611726421255954329049377697619509078672384295084435829488235790539441855978620014275344856173569295902797532542405717337543639647526224162617763559093443698919791935400429767194843967614966978594996104266301906803311086839294428059768578248522637071496586857811501852851204125742740915548653476708609032495245794713228846207481960702295749819168785468515473375989732846648350972513978068681749009731289195616122789870267416964278011803105875695466127685450940700995181367310735259309501237377842494203580763304686949137892139478677167711238516588395688372739770641074608221499559261366048517819508152600993129461338302339608035399664414156809130160513321524705945970256662675130322907126752824315935512766591034179731267902527621565770676585745033774771955387127299022721115726745823309792952112640837407150217995996003967519552638990836701510327507533133105831110452421616098324471074147031036282587150679438176497944336767475467194640321159452382975308166165197663080428659750123222905436454781509069744933655934000479976026909702254774865521906903827374560798931883334752402037820855220531892881716179752096647117265821138866169348944972375823330683621887998172236185602336197609283295917327647282351494255434174140554580236683317482760978372327356052063349860285507650363092717622715796142651547201858401224911761411633220558358753831689551330718908985982630978162174522744064688942892127094937582536858575730265657447037360178000207068469440036205042472058269651466540677779234135609575061742405944454933795769476526986580765426969934543785397823714400673444501813883429130851737251351867321228556615770941320810830688079554000878743241537983228273704875012884971482702919240564820438148559300453038646784251640926763027361458648096477428720938004347562193339609705565089515685010852259817573202679944464965511343087339383926056158316891801090074831662088978993214441657649536832179814780163596084259615174303223595862195480111835563550204123176366919623009240638521176754936106803528350207062143877555299368109096731945281937848994034984245957392136862931958230361107367173046647132015081785790980486105141179485041906364999660105047070679697041219001128087104555748634034256233117126641464904055463178528801653800857660673307437637429077401208500671928945514853234376570509961871433246566969415828708128549608543489417128052042184735083684359591013002857596130847535338129697080176184429064657334340485896507504821248799887969044003342416733564569919668427126527158719583494070916112586037500826489437919078906570088519532583617488991652726609273490390351174439571809491849079940994092973892775856019904163880811147765864928078512149812491531308685077550167001783589862225683557875886407551671578453027188201485964094607276435136533149965707845483291397520440218314064062162151170605909099539685992007409998028734447241725174175681589108284738607136179449215464565921169606278703962478915503948799623101848729606363063459355159465071291091130448539943327096396230101074723765441321071361452038313114138369569130099391403702450858163578693800888851103997495515945679800370948270581402112456978751700357717628065537516839886930685698123584469743235632267529115472761921064992117236183866516211642598692932561560081393586808028778886722179540512271502780054033558563157313634662382201026703119742780586875219802123908767408948384475375874225747522919732716964297779238405591227358904042828857599469822393239751629389726612822396991066137237113490612853082486323523483156482384764252129448942094923337790004917604539409643236436424438598745936452807461349552380464719543211125845491957813562248216900858692807149618529933963318392674949852479713959927638126040938278954702079822176978629707627980729191229538957770716638142476197529486717934942811995086720883641496749657314513454805149101455990461420497282687176742205648774487658182694350450921697190280666662193778849527323275238311552888374373578701030859804060684427251120312896502906558537339455041996008074298496668558874247931337646339971462860882631830816325746253343058338986003295057896915105395549560663491784264375311676929864204733531805755756008806444437232071822750008308876144138681974398510272810955836733798490679525856413570639732856663024325558900608194659410348972257198641883119472789920186234416596524763725387503025155585684996512552063848991058865055199202265326719973850636355519918697247654338785234641002737800271523757871983688993430981306964281738906450698757239172722713602450361403235601486122427262259676109497943602153309700508879083314068575366610946891913205907144319446426362339771559660675358073620460097554711481929191993397953480468837261682367230699755817921395569883127080803723131718057803339706633828671866509439359793729663910763437945609995635960600183598392842107834760136995542446805809797302968625336127150682067151804340792896658581025499656180609283777867703736128729141168754864569393196665387966177596081740898660478347140659122904734530486414986621784065222943935421424096647214656145086994923200708121564500928937799495163580737745874795164284737279883551937028480720017940920982923039052436836975673857769673559058216353923876048454111510860964954107030225940906119154840977674546652493618325540162239320121817338230718306255050938728153439554956041905094640032346577102702313858815486873081020080360151140545388928976057472852147435821219580429695192351648258225409582201912005340160904222039827119082086537810804835356772388038644354114679991171035636172656541143718627549569278533253034296621649084093184793729362863683891783073029036728725459465444779187605316215637236918933862105446422505966841517703533050940165662752841082472651820343938249062932221720577611018194543152352381511564957649823638870872615340107044187770093267568682102189731113450868878536401288675153532851393629388989667944301838197867422951205718681515125117975177755617742698387950864553686604098230933740736752660292878051757225508718583151516158481347152075092363701670189178650031576416826450426768807922148059118346163611028246244089257379900081197512187850096679027041109085518646672147411701848839173628325546093086352048475409524078679133034226269588638499394092917119573693078648838532647421914518722479243376092089958451244241501978136967144386237810135427584422333978508544287893555926181502239766302577557242619161693048923720346423973318180485706917478796878481507556202685709030157891562542312866968814076600646614612798428742602823385317609538347513465399713172642875406455401844069069289396044805241431115521713596088112977307901157368842779440141081193996280213930270204805011351242210297161343035885777886732136074773822716118582902328959590191141280476232522524010872254067093781971628642411780287204469157622227309641512970095318217164468574684330588450481089597345897865755443636194397193311281061967710458698608205879064913674321798804795272896492265436111837940770887597316461619514971997658090914587178365989563781982762572877933938305815809855961022243999918886796760884739813951647000413656990963920898457512096841550061307083215104867146445451259440020768518478275811248467558604569944460761321068311196258128072338554926693371322247663601200751008222606246292980143131070943229157758185248088471655381367711471363291512054263553671845418842353310861666700240473466521682445294562417244507486797381858352081175070772390618688818226800498023832194907212282500181378496108710795778101953933217082622767927342286721714789909132810389398107121049489386268687754391738711092089747953533980843119275271320079741693701370747547307375841722628965641524595710192291149832268537382416394196421716213367103715212528636403891228452235806052897546616057505881030584549279786169169114882064506186766175521192585031383883720415524760608195198320689028939884508961417194028673283654101287240740386298530921533058869337268804975602762368512496526620715602150279016711600326405932051380763855396853268523596675653054999449720089275549341359865894688132866814300079669002886660384116423095987606728077093257419339290024885030205249320909161884474384840973464407544495005595628365854536069379144160901986322498607696829620531738642648940827461819650739982749068841816101021717019617236869657318331020104104406366618490376080902379023261413259108029541466178033043726145191567928762329589365522112578972373502229615424256850164417776231413406254694150543775389430942230988879403775470830331602440787575050915164766802701954652721208856464620421331231926033812564181678396408370206707573134051089144717526614345885828360390285635644638117584579131143016691427778380604370541185537699874455372963518332588003311968606930061232999692310665189623467712599599177213160514341910649353368740966991625969685381173735118571599865004658092395854274548009276045653712694432461870988868768993023718896930428128610881299631172853131845186615294577190022599635112005915162757147288803270277158734053841637084321941891057990776738661529172562614694957745346250878684528794957656492700987211813834205383132149166071441395777426082102950982013125613661425236675518415081371754251056182463318728592982346717652843670238323026683646286032451557218140532649348562512499814380990257875925662728003852487596257028012185302050497820682187427094243113517132849385036675644652355032616016708274726064960312402901436974216101891012875458267392621226444806061004444770989744715067290038410750958456850696574737288872327810159775525051679645140954265730703005296237218139105129437658040811417120469204079709293203317523008060941890679704442450484145847070275358278687208716928723862099683776983769248500414380475989948195498713913190821633278668442333071561958018214651711549881482608832843420124836747417674630721078244647236111612636539145065127204007043498201705532865653664306111945768593605052238024292018620935525545686261331194146241901635383846254585564567472540875828330252604184204582574574584655297632200932024747657360654732190858287461711358085627102952359144186738388778969457339305392559697683602320790934990080704606946076402828383934218948123556374970661902522038374763843915308069346951582990012405152238638716595140130764429841236695089093891015893368541763617138495995988207122584939413600222518280996406954525418429155435432833450674203861705663060446501412170386908244781633617876461459865039445233128036439410432744154470509877600163239798709587339998483349685094100679383847083014079966752052293823853625805083649241673199619191290374074862480429916617068852984912228744182023276106149734894291881046332760872111740575771461567979264632106235051383804585523453691934326671125984514457957209909822286224571045656297222376709677745471115267378877318568391804234622560941801828798631648364391546963048160140346503821976863566723892929566203264594880358208136943325922701152808911168569562920594867819008808183710488300822746325652189568228887370276409319770255582279103438901969077804613213480386558334047786791498739687893455406118070788149317236711758862486719438956667961537573302033073914563828052356311312454900253519146832301423961674518248747826476877719477383864824695823579893366551422996179318748230757390690474916580130034350137048782907837927462584979374365031738069179534163185823240098328082165856084843230799982180124865226800319774993584169472783828864895188772239670786768359978667411413342547824849666064393373934424108605444021682822554034476406681098935268592108315409358688512755783479211000272373004505056307179985353377515483534265455322809777790170709180292682439866793414050849929758813100809522174994901324468682243028128600014603398274504361833853755921391210060658744686083847780991363142837939206574067506118081005911658932771986079328660680296273785447324604982875796824883346268362880552286328626912141045036053649333061195512095979199828384987121881160082373576062302848971113754502209721647782277886994812711280507093898256833996916492899381712683724576423378060620807667504373263405101732226112607031147191509063847219521686547849139574084124357265737413453851804085214683102130539923010929005815117990428345457347311489417845411127067332390398345756996559992653925054905684067952974321783668020519834598449360634198483614625982048186985786583197130123255788578189347302487724898456204753461732864996319619983347736908688752307592612137103800021826058067005992658246903011939171428492150001486615466585296556680454060974739805850845583523047359082932004817623963089383212574669700865174658094205154280572611409643131062193941598844065308660665641865163180958352645388894584926611726691567628507552521650553343058617816136475798679908238985051599171460727481350567947740142417551223751332631606899651708771814833750577029547384499040485237362739810792315391809094775893561170532737577037447462653081868091226259126987268478425286258849425027750767103054577499451861126599554390712248178802526208062671657614783232398412350501900482541263479098579464905181728922106037601932757621352515503591519534159937323659462351432860709766039892385435250398446716954620063597722612950438745431665639362463777120020285413078328532899312917141308993759524506732694923681294959364465426636340513550778844786064457816194010160238734819778318664203535365441434283940753120547456637173676047702875289926526947705411276776529763101397860066299317179073387211140537940183025042385392966970949013913709290188784119823852762837739018729803993730150207752626745046446990750942793116529235361830854105291049807594295545576658348321710973919296457152379499436036004033872775595361163139122749401659630744497815835165298117251015487962257524312141319013517901115176188834123387615236299444632437639213657602728991518176961365719030996137215956042085192093637617856818513165260545268307172544406679449799446600862368684345498805942543658399498124486103674854275226261627794956386088280869227623106928753548549899275781360972926154911623870349814947217286299779626808728457665427995064377002573342259840696032306042313950420490908939321549998864411446912555447026558651391357664256671358506352974013794610461589660906210555023924272616973924091658015147796676870494197320090719312373559329089476965248958743328271050501102195963683538805042194533253346325495403657124904180106196232634050415435841457223198207362683773286327605434280943207052987367976649546596718802572332011293447078211586996882302817353312923730214355009173514278260576483361575134737778583531071655357484955487373109969464058189478085641374371918928115516946776362487706746088535879618296401835360759601347195892848761109188664557421959508049438733649229944496567079909657801424859580505265008497697714728020174772423767840426116151057697459438685231046343549125851305387417633811433536585058329049709292157710495393099287641568300370968720414219069088604770458438379896481512402227330633690495439067634175143997320427583582849668015554177258394969612051760981778278476953118231646538341841045708643046710393732996848378790892454685728936617131993256816544484043149244500796248402479036916349370115188597598272480463359245002487309468837908921967770345652674473667018344120939648580053900323390965203885200941837173899159108131082493377405893940821508385457391095860873894028778035431164358408276857383543763498697865732617748859315885741147209216588720437732003532543650301498626018959009794193382046819964802183948370546793289723264762268128287463323175090243526320737244031642517147927186043397955884202849616085948668108418872510150284043700690249719595967504125056038280879009484601308805684437705591508867946132450290594909609271005574844512685080652228175929359292208471536913190487836916749213093380568583816377716223277204577350433522058859654740031344355465274629347301165751704762495674444785615724260826516326536252506927645771901890527173634548019719452117814202814906878883005130665671522088251221256414727280079999111932423029835877362769904358133213967751453853641232326890592296546027086619391271371845254174756826041931888218167434938853482981007743490405958860402914675347390910894338911237984951627053288595899738984759293961652259273077654102070696165166264886113619283203539657369209009855445997076073278501233064400978460043331754192424830165070292064104535926966100599204959003466256020271024236760636229501084103003942278318606831811178904764984479195107586804445607567652594988111257426348241174552912875772250359121176409247408008374049361314774588835212722249486095331471892060609206411134943005292343358630622915401505504587903166003441183435678061049731696066566471601720186508797091343293156485311935935847338440130068090811139903266513369415277097022288794424310288287132757681029112472579792840715368971266371956966631560990052100487390534267566040993698569714494621569980034025958673465597373553545847037291163379635832196588875848036894003383234226477389303181548950773524841183432622029720775311641087021715573248228052878676726129470033857772594257073160443473791228060526665914815598465077146389383871108783179044629659775897213490870193059182161978320627401910203461150663006016953554997536394003686158435110846885121748894945437374811698939252157138374201216552022154225993330195219883199381453695470241883910999755693417691237057425277516602001241448177693484253377873161168045763141805562160948164341406008989840221938150420418018036134611651039844564845025227835880463213318233434298095387681875983098787591893491532490690035943817965511656500704040733052846380653489814080699632965576990991309244500485811384186674970503070276322139586321647400137354259082035202898195558051477245410412921169973569946551783739771576593719207311970054659148327894512405152236645781571519819043453289543871067556115205120623072909205174841815798112636005887822016858678330459127990201261096271322502252637072092565234155185562349589037831506208150543556183121008314661433114691042982502760323155579613322460905455217931971341802268309060197402057426974677093284327010276248615912768417612063587499399979953541614902141135463001281155556944472095556108991309430429716841615578276239966847137884843330746086441746949098369863386743732426542379564816223563099531739659621008150911843886939495181575551539793420734011567218706047713250590829925345448596637236040234171382999457855503536278175786581987608483609985396869154308711520005766067946204014236782244238309596473697108178954931394293394683218844864958990694289880199197817732130149663581401592659733306619539863170928996455942349188441261877221731402715581040277603298824840564168058174406978529873106654188104488511307403890143046157228746234285755497951655542959353014116008351606116874567410012563121505692645238020666677047393758338081618776492288060805921802805116858917605822759481714472398675330085584241854535534565878862119336079931355775875269757006517960794309158797537356902457982156755300095442738402271996656322803874490526990652143422427431872318138658312103481321096275374693102791463759384429385442777904393276770712237573225648474591794672310156192383146875310367713378161720585552484511232230288686929647940229935497853181643011843534526724282888986857753508056922739359270424321957211445154786789730831028371877360697802309441213091194755705559721409950513167605243567349552788469524251563337399790080030247466323861871594492916264031128413988092802454974044980920905434699997721113158660096155112877421829072793283417553191528798345750583228083466036193324524836020725575349213583418313092869035245783625432762402278476250923822290101194369509088921274713748936032463719188179859942850204477727098699963632509424958413899899153398560551684058136351489907278642101577090251665368190172192219010123016781324054484084223582236131617352993778276200436193418680195329857779334147645744657642482294431265851125875524025937167950150549688595681256449261011906560097208774436500167451500996919947365206523263979269382539603235543970557516995121788494877838967140597787455241426550026499280086200574814217266100266482721431083593339764438633755311651454759005639469050253294857250062409013386727612678186531536823074943305390447434577700319962460215530284587795514889174298136452494796506383774410968337920414770783682276937405972805348708337507376701841958706928251336722560641726328603901007037862470043837879188250388207532769404967719216054137383046599616145104687429623897210838351974882475143129530096737052305242563764387854087881473985551890529147802171546858032877021845249492123912221021475148065464166895211874271387006323960753766777843382559718247631972256459889033146011027622593792591270638407630893255320138252172313889219559180170118187530711260149804722681753037234958543744244372311030518124536445349832976474816218719863502043768868913173448431796761618380995187709977901327954372230953206843485084891142647037874395643436479607916895579631384776240418829878340443612231265867954485627601050378742188281854154444469030571312813503696283751259898810336518503554602422011510058524421998295560280447948102793103999515409636277090184941676122877145951347816526675607561266478864140320792972034694618064282952406598926711833690642316785080865081540650371555908765889769848520356617259739730023580035021872507586457111458026767176223513007245692389028826481657649535941304358575394167705841349415316185179867018166691148761519471376553475134877426793554158614141150865460241112765491247957685580392154018238534450011190298537816591772864777033401259325534232887961310165503731460508791078458396808575387876747262487209956688882343806640067921787063440353425832784971828027092906783669978787154328891965965659330994625782642634570540683449968775497611009313024428030894405478992320727496913569012918829927684467084728411367035992483815105660381445276844431567549293963025687870480731951281643444498808900146416011416956611375006795364426296792970111861568667896706894987870280534968833767082480339516625262971440602998091971673458135629199402241302626932900763090040692422523505105422085401894090413525714608822046283176028861340251475892725673432987247699331657020777910394647920818768295501250053011761552204606158682035220689306282894809968463962286632459817338720382144829176718614703682295221052272917984567081461848735481565076998974007706969414916432014903996101513061255583222504876425484194796244806769653604406754769404628657303537949944004210801761647537095826665735220893175544405659382117601406695790784969820926244504926071316062831651162698237916839462039592336153173092999479470620391485463978540146718826929449641313608125120988319601161951117794299271513831813509574357936443986355178023209505204132352044473703515632696031719489433267461470875066839915554418700049860201924488009827135048049024331736912382405073848241207598821809815170889102583401018445522085179134787139818320244893463395604365551878655375299518077946599972988810345655234303811951968970799292709863509478591504371014967654512907018758216575689047880395114572921803759907926000932681255132443814108851163063959455738823525663748565053866699896176571599422961753404641506475789525497076479312874060300840510286362532945331499582366408359792356237638136583554001284116199161231395984473066961806829163025642101952502260906779723391512125721953457316629176292828952560310804700289782548509257061511928756658639115527131928791541455813039456353978683908767011414323041579190349300374432167646397883224943030263294265625094626733490763052128459598795020420636961458334836350533531896508004793161269306179869729964898967835030187616934457511512536570040474363384893706907592842131053276221786087321479052443881919936639757196809383476718705816984495374899676434828368389673387005535442774186078645860284550569922385544357500344656469673203362959152348458508255153253608999315412192415984343986410710330051042804807739600445915428913690472097946667385392001185945379812956096325139610616053642518368110994037987263140791940431926801288372702466019825602009703821375011620930614624652179741431008230015669220801163651641510145694366362694085214657234598240723754560367699528174213975603253490159287318869281242759203989704953363021616943597039470028401908069702159605232256856616102011499672346409337280454568040213667237549536951046038294657199517249773190523078032767217766415411961981130630942694249845756597011897762540617068883938098562991784437710632382130555194320849979419337733812569300307661411779109246337215286507900955510972778232868419980355401148300485167195469183651517147633917201400714524444065336614750617445035368189184985206777183133951761125220935119510115334824464558576589700992190426073636686353666787681480401331439130250900631861641062221873118564541376823668465333157054424191522160433934582510625678848767851116250083626383181654207836582999666025711952524511405488960331447633439700770768277752011305894454397774178539804436377551048045142859157653666269779426824897284817315751534307143084592509390824099648225654097436200434333091306001551778608104393499536594134436202341050457003402733839940933369533508769366550774468285722612271974965524218118156278879668669328004407073827047131414406093119347799825977295422549514603661074571967416814564533225553393376622766731058410695542321054621901005935245056488151237272198809285682216496258899900108029689109688347280055743096187123612980809303026776590127396005664930707249323376267641455181610793100489987677379199098284551266349813962271203578177847561220204569472260617374815022438763642779815991508418958249147993341761145807297085083861883341650273738821902665367598554088514819873504026189890098282615781899501493178246750734766173551755575717627605342312212251206884459105128841683874225703635169506197563401439282672778801280081714152426861316133621087898860924926518767208637105054623686682211444825079447874208093200832472409294913830192646563876827458572957698102770846141714363144816955883927720129691126020889963905561419709233868082219493742667115873812728036182966645227466300033860749027248076702475107906852975972820823143039807021831237566478305943911167900245120396273908085035384639013549356801705815429497986692346370435523738825351615394914333928644259961038660041298526559588524685910671644199750345482416026293700704956164120882940915521045500075435837089735780757653502641245637162032750862609962182982517339832268268962124776937874997604097663100899048162185082000817414264836186580436917138340330357899120006621270450958879914718268463308623821402625102972692055012046748900184807517013830578452386194786354336924605596323680943037190389284621904242403622198325110796050139311510565927354810910301883659023428950314888112910875473460671568746556751105975939386924871874811495796020238022590117700676347428523105105296850024105152480674713727809801518321186220285345366635842046019796612045373079326777848898062966637478707717678594130514897851155484144477415751126465007316983565046758068663086365291010896408465978669992195104940356987411138206260530457014835492502729260228304795824925024826785103208201599764526034315857546949510442645431456832101879743931969374642366650426606663243349560725229245799053352406184197149393655415614407725252521544893093787117885231772625673971539250028322508085950925164959587511776148002714477181660690856534606750201129091407323631299544124631648786852100603060964945492184333731349190276193274899272294740912176828746528235084544594903151879674852135353394693933470557866945215037341112408266026145764898258662567293656599884127271118434513885551538081894669547312879774233859250450309585452762520508839334952137334428397475509250497344130052594947476809616330652800125598547874847744813422840379424327988551192502076106479596053252302816500882212862452717854645294227241239856859411921921237896771754402239022363000023313263951320865099554144767567809015380047132011667783219466915910381930747908969493299988276640440715757568756506081442697375597542231101106925594452229838681233832674950398423694128012219803107143606395412047058696737045863681328635914884086665264337556973242963901025827810929525018001019875152344477401952222222248143615719189813392814039337685261324517803068990421791019167332663386498722419791772652507383971020529044811433472272606542425376301627143111037684599850740823832549519450890529544844389943467732976140943457173926763846162212132460538922562583412120394636066294279395115442353289326574084837304654675003994265817219685884177457701360792494249942402014993722401654063050636292046395432294216002325232160098574082108161400077730563889951170542587129771597851393103367324798756412754459165170608878982232299422399571964266373568672309131603524558335744947544725314148058068913151672713879228799585861551056956983154763224205961361929481318271384345599002318199608921465701784715125113629951459204076394601487655398590914552214921152957974073312217032738365785914401981942287835202353441218325493413845074305899604334614801681403405045807035487272213656876699243718121534238104383813294546752844199565912335906022394136631407533648993677691412955552166037984777131338739036448752235256881607317457158655485789587198913119913319634337200983718115474201735515762214771396499670920868592794163682913285768489092479555142117616789208400377989036045929898050049726613148638148768086290972399716598778206363389490955250965143795711940408188394635934626278866175342705165610917688311434829281724347695836475731159737090836424995241813733909065325312179444222381893868956697134013074836408818732912187751977241327309793143149799913286075058199390163920866812271804536519813788581239779064015613603290804218556858262663285854461411597778437260317774431450867696150061651305354261287538612160308574636237414907555625576987857153445968599130683162665429951150647341979646430205473565567936011839497927064304401335826769802038496374147917252014918958210954763347671081521433783243864677138341476608628209126947782885849373816458873800776567923876576797507604630505795500647407012851739434186742944840620838128758962675868566528621938346036995320480257987941669663994215240313293224134068545606798568099484637361777658315810570833857686993930469495808341919075306548659238560324206341988429402894212168478464836110925637013379498596466930363546685910341917853636077054433445986028914718240196030467931563084615099709700193525967471968587453639665181694052700146104216455066888552365385916383623731742932507385719747220530272312752553266413246267152934674292504858714576580052625215303881970078398705084244263972999476610941841057448107229986288546034724725122836744391622354136193376973932962658816780811888229198346869356945342506515436034581892855916971787257189558683594033204933164668352607551909626568203600029570709220478432510191985704153072551843048757618618097681082340150400076151012326716591032922694670186756708935848398589804201800953998569310298846365696904108097318086900956786878255632178759529246861213771992147613833234367236475293204959085833289303022502905233254322917731884282083574734261629575965148611314280592838748175610662562442013488173369934657661888488932949595076718485173090300806014766563993397179310035170688335021148623503292868587591404683046118964729473471550625370865336474132803259186477412250807755831988173851517184940821762245908644027687590979044475454695811409467530506147478598499376534805133849315106562737557859275580702077558947045808192925938456191635432086729718151167994033367153878676412290971538228335291744764407601477437805503808924626128886140497942971079967715986783564845235108290188958974497743083943494410832643978390312467044275439157237147348241658439194940711838996745768342636649471059362310701172833442387773330951805105402179210117050040701704860113220860197994501561260578732687446700789508845280540834965360058659945002920079415899436868527947676031163010153822982121281187520772936632794367046482766858453005490067017512688851264934317050304025699604480813392647405098593820734362854277880316316344208526533505277705860264044437685679340045614610874623007874370462287632325007133499776465249441200699281379374407769408947093154133374895584084684560004089644633250484495590231546120589140764587745416962823857259150307351791905734049137443131099012350961864308296160167026335707274091576316614632210215410931774831856680767308284852615536530598122385225873910040233772667144063133768558952027838982291962394033305935852944485447967183126070149999772431992466051520791715932517627705942504317757893736989168154770434658719997801410844235528529898228243608108747438812970660714181302794297548514098717959844663458362292726533285176781146121800598253995846219003962633464139001161221007810581481779516610152003148902843389718636329971087578023590462837113781118705600400325122635063290656719930551412583003571336001947023062819564612449630504213435731298003563004531589053919550396206126632659207699032584238198232454936095105626887666592744299704114320726938268308267396529185225830545107228583200093124476187632396233307238589769142889560468510732773689360340175953372718155181024090065220730130303997302234343569242132203763958679386982482669826215215507783760113644267766562148879835745654786593953642809324466514722704473560205334392711100314560739995170528902399992979572507568899809455324371586514268127715834488693656316835711982325397170864189034124886417917573078442503346204376354266147600229143105664838742085079865074148986672446725126976088880261347497026911121585115840361798999702991627952180057204407487575205465468737359789814069972859216668850206181946695396208037901688910423633255461291261661170190011372513745125037163645350872970305523602521316046170457359378304127599269726113762141150895999793757759886678999877254805898953749106715079457178890946143435039053055105019938685811460975294074553954674486425762019957313936186902793748828196686150750995691102906714931312806224033442023035226283937803412237718059768549505728925881679577336730658573224629677203604841927114942858077253054213108840780363077850276576927328406242772179423364547383636889844856822470218299794726670095985639403742952302348621976135301412805824045095794825423225053091213517426512142162295340500405381138279587488779272221483697598906283385673119621438466475032291479163587860780227963014354742387518435359932188635779696602078996847352162534251537701777718828380902846202598295301191487391499591562782328147817295000732291348929542960204809527992930965720239208715413401654901968801336573650058993516542435662756651624457828949425148871174771293873414723508495596876492736357093370945439761604053287295628020837963718158623688022878180519283983783134696396319122625787711028824311737752196424930715040351722056579273985539621593187765367036541203099327762861024781673604440669416326236248856197853403555120658108513737947935092989772039032147509238318531425265098485612133292246452321108328816495188250835323816396282313804589108001742687282843546112699948580880644431729976101037275614498178653223113780290649949909170319678451385492260371650653577907055787800763883334116516800901532790564248086068431582887223274041759593046607862845375802857561891445804224810575852788605572931335364549742563232386254218400514403058802543300984636665748999071054769842870599969147529676207150687399464699868762092792218547384707388033135324754815512540368473665529024536462027799998508399388633761177508550439500150051965358694393939186602599731333130908015254176884684912116876048791104118523962325394547461251146333090362579891608242577172683732650640081584609046754019206873118334151029377419884100459815468950158465098740031915767541227057876576350585837610040749772957823687002750343151256583763124798581331424184191275802589244173266335552485240573440137635644751101946488907195394490782076829799222943703971276996481939033692863091177248849495961471594410295736727016939675497058207701996362689486504499527947452209670047597643381773774901156460428400899973395773146781700820840646756082701722318346079794442579668481448866540880523535148233586942633197548392408084812939029898022124027091594596530771629637494743503698682944925508978025800053086517712208199642700254634025568716039071991647712296697432281805049753149816379491082994312150762936127310033235801464986163581789345193059565917208982487558479556129827094185252952122903873507438528632768645121638872990668263699128652125347758027174474408725944260058593699701798660752550381571493994571803683943920837033710999999671447618102940688135158799556730321396744906995466525422390960782081775155871461154373099862611191489060944576650821113473844347362205910219594441058319483444724099131346263465489975870527616140897238510429019661871662703544404743155220687642785565809377879084813822028386743837351806704919156667897577515614889701238830734490913174261814586778177511474257339787946733525034256894602629676209228692908627485441371916095289133229481913969170829106615498940228930177748493877162810845243078405668149843216721153855967732487058746397592761719486247364551648084034945247952807937590927021027311435856714715257542712340390544479438543496637030255531773959309486607318817385733561442204556604073026721533767012520934082802981154674929578206634505844780023774413265227853993271643661011469550564115788140676805681165065568511270769594823883185200764270874211390485324620598620088034919579971168310781836336478764069052389006586279926370450194306324060877699522017998267707678056469219120996916294869675341077236141158224363956179762930354321524224135085939662240647342935107577942424581793938479771019461634782333200793153759118202428231942529426021229664235976940349831862648386400450911149770772973144297720112355313095400737957633034963952855008074809608141108907832549129882939282474455116500105584259233431743223907959641536935378168541793799244882498257296070225376899596751174395456234822519926331507967961847786714460232950338772298295882583813213586216205638826431964429492413880334414940832936833663116433595514452085511287183675329944070076312025339490423359159574034195042521232964228970916503704396332526239262682132132059037076335967281825247503728395501876196418218143906958008841430790988504620064917033368723330693335784353730734199906807879604998455393937682384114053955695934126282750692185736327503116219683956646001719596777778725863997712659568510016677273340463043344925403554063004760488019228397517856531421820551360277758606882116761636832885807632395838126226174794891040625785200526693387022378478709531781714986384919338453816828070200068994567707262537342043835124251355859334359224240941821686982527544057348269139795723101260522306351286833900795197205093212666454644762913060964730329118552762727846280600202919394754714250629926432914642524282212020422437505875191235355557017879341729860983549440682121588850792697798686735542959313790311678653833742991807017380456282742331254531586763451667783176659018486032688090923871891319780409962287172992060551417227667093758892331123352465031760170709522424002340003743661105804924732018337819187684721969624334041511610015536651123077038604682516400834638910653821906897488148394944143846295358859989610898871566932244694753960072029992970341483442142970644929514460743449947835237112859919336759899221552848399620653393311035293218230605035187905084507908845430790230908187295342436435190774408150014103085838619018298533911496226127530479213044496513441162612162431377768643790637976509931678271102307929097197659542101973775555243864354141400597223284569945059120359271963335939128581253156023476948868265764084405972326061063256091514656808253770998047943695080957461867381908090929909154400601705587619843279764109012026757097233335525614108679284950284509994898774529098534660558029295788232382788545915274423246809704631508147414664411042758083428042176664194053863549575199387859260831397826153892240531319962550682396791016776953211041138901099425694518192255223871285524633696408139892774239918120983364967870801973935372007672496608086356445881733566488022716430695295421238980056320906082384377136134885841828357193347648805021730777303492373134783331205265417665170617383383386730863443941491752312994337647241230166143583080863807184109987085798038702503906911294034057801361173345233236605834918649430028126121372181567569950419464576515789639274196745123779548456397593550961172621768804898887346506122117553217580896528660377598659941004992407073227270190884524853433332329612821252680045196698866112283551920464469890453456991001991927312831315442327550409840601816135104543883820890034200232587547993295996023494454569872259652586250479535983678752720017853027254024574543836373480460321369082864621167952892904649208829436533006608968842898730784522369690659086972471598749893247800037441820071477600378569160260485189288675821076036130254076750592796735253742253330609120904569699557242901015034286666193384842308745363620810490138365084009238767373369202017234166056249114073593350400467695632532522069412249056866603494179544021217949271783789469487591731021854609428880756019231090745549821303203349690322990960277155133664248524756250006478553586496475041659331772711279515650202736823612909314938384753255068398637370658603797282676584175620874937431166259479635888493339991187701576558342167985576221307142576535307812070352809807217049473261877008855615862036667762946001662123312873729367310673775010189253869920832248735593695634901639915871391168702444719171202146003478088404620386109740368341384648732015859589019587193859773015573573150588960005568338486275933398002844681039184450656189929741512984922959346167097096541581104024666215920447111564393710213009915500491411481295384657891028664614191683585993929388244049804146188445784389376822066866234722649632297734566420966837677227683849690389641486294645785861831867099676162789952240513157929524735302355807295744836274717949615282950212607984438242828057033043859302343878103205311239891301144336794761100752958190097651804895394584150013250959835524701875228235964434639709136300838993418104493623882966512831611874869823818734344936074681651457692806745783013770571147624388385196867061548831200947051685044505956889722280037428290038669430336500828788885913420540566048522268574709342168262137948007171478950807988728584127351388115492492472633755538110194664219155202704748798120676217850972551203777146843861957955717917835999852897365621424717780055106193902547467423536992960603860602077088887706778498004356485716896762471407407384542858219616348040537315933933425084122581380855665791686869068546776371911701457389040147625425276868801105204639936773758931178118662984315208815887175141024718426198327681069574899130043267434011067225037653351213025816290838714917899152694715660168696157797613246596500624196387331526154960575865583574779268385683157007115463089930971496670543817842628820008817952258537706417179325000405598392101554349831750810177783348985923594292914867814484641670364434087182254605929730172123792696719565242109783117032911959956014382232784689134830439157817602767706894608372134651899659093878690913494216028700105361353960261290517186843581713197017120582276985227293955364883350154913024653361019335864812070620365728113223656225845211549429306721514683291604313282740711166237152916064660838102847615927030259514258807962638170915210915334179477777720074336944672944419626181769265683496203302627070664231358056093334801952285272409889947191599501760376601099766391094472944176852619064508043046367150200305420997040529388682839576238353624173760265535753498117954178540030980938657565899217027756953721685855779645622244491668934609897029903991557932284835229112583974881004264239035759675352321758620592639409440285848699421833463127856259573294019377831394901213641066430490233680994953964297307829068055568770216378454113081428900655544862828920662624816339910079983933043385656132944527827372072667722917610487253243785647276406687215873491432944065517248798928453297505656168807956663283200067064256740742875020879781256881595830397114274324194468492502006790439918722456256963879163571391300750975523613713181917150803699516119220430994321048430808729523371913387089542920507949835521626291222769426565084708860553871372008819057471769815926347082823330019357608116402948865949098196160107093322972081583211550246624341925663343313374097762050346248514994185284708641253831777028211767643238165832981916616698651180592003901351181132113161940434187547302099900623630888004516233925735680274789210385523099819620117097551868120133230592144794442909367906250867725108589831751348437115114502419044428205151082697493706407607506796080055326658890202309904559586502249904063476335063674008814063734300156773411256846548412745213541819342626790118877536032882499486177502482584241686547963545187505299549743737642045745070426496372646075155904380518723337060134996738998586575261695422478563109507967625945050361216809835427286165698102631816734342100515210988621297356677020840249130153939770075474889220192071788295850254800593142196803944629182097115526265216394602148465110597207250720925505267110268348595487190944052520755187830954821819303111361158743816048431861474775715667566687738368496235912474072208201348850269696895340955253617510969482095357147556193519530029729832418973807654746353357956792198365510609519999704020240858267408981442627903477509358251195388473945822293436293774228817693979334403236344199534883686597498921773108670513856538127805165698341155334941803683007635467229944138772399922966277408759263627424935421400297085684444096859430998364196576680565998394428096854233214915025469464933653296300767153927796873920270554572215812812577043088429362095664390411409608247244878468868731812728401399813233780302731490447394195567791679899248900117181102064035492026168579412186805187400976523187936099997724629581088818448744658267661163876722447060304839642182481812459606889867568569464212904669722786800919899485611943398081283495358625835489509898912288731979976977428417443111185127682536568759907878363581624164048737683698311526072074596233736253422563470451067136951773667237179332532939800499913199528353168149638156391645593631083039200583199338376117020718455081687363092339174879063962841907664708521078223846981921136647496966673335249615963905895501784503871741836480660448883873809783748987681263573729174822821503005853583226967806620288116461898396567219885584240211424299644230139515828285227125605558924758402992430768881470707574698094175873039252407881540314648954717107032948143216736556255761792436266328218397925686393948443194820644331578645577673304309923312209678694359851598655205364688937955581580964697056932260799218677941804656286311162822181285660579319482797317352210461273484389973813682125781413264503003585269916483332455964319705741480819630582157763961643352095128134336895327454170866532040362994873714696272215116839129119133075871611097360889079926593338326483789654277093445335115013525915784952955834875441492740751650001480749760684752823529794672580371934218480641169227990484232572297342864260144941185757483470092345794794272660086942128456038163264963577379290384330236104832157469734264002615537000341042999073269527764957402715664657484058642016238945008087999579322759621763258521689207343805455562518943153279290873362319369080000520399884707141325738393355814103485466298143417572504492565260576196192552223293095079841082564446097327718411042078248464174219838392330806264107136628979790835730878775990350625787325851720174403275384505233951915089978392117336985557749254634157827418865926571201731122775154416934909378873141102849900027370175167695793531936664953336524010545905178151141968149482772865675557158088010345225925774656577434659792144375699778775579066111355039448874933211025588172192701710978941034929857272659084990769047821338410778051079293119611502673217156232885908212402388248577067779260753909462292498207075507712165083179991437830860818357528605952397187300469049626032975361275665779502325300008466345545013206218940719162677551586117650787419254079317022406343793216496500239573755862444136732227409080551337849074526935768528358699843420138995667184632389323942377782471693222517660360324598889887529246383085546611937471688392152435410927457100265840315970708756038364537573853727458152458545683255200041672662042268346944435694967278905622428969752416331202521026904847455442669538797743144090403161914631755390831556643423574378877952900950575177113728866707556903730380176730025783378748496581523187793296345860327283626877909290405435440753163092138970114844896586898665251009720405024339345165313644676185382140885297781546678019392142604645423348974807660303698777018435851642119077110540625333509812764737158266060049799373142672094888734522523043889248098202602948744019415011969802488224517793897704031410649983558220917526670062193864690042760404325026788809012765968327858125001614994444228271416313607896727031421676631697444334215558803137187018386185264458474879350987404005312002782462949192135134745260511649719085695610822282351806056968680119178641712899500952887410991274554306194029658331204486122717322048395919601061830309332311915367036565324455085091867161229300484470687939846168302063918485056596216460550867090994381292017579040148341536037125663417663236525634892463838895743212070270659700996071558276282617529077145706446458796799539814558700188256863964010423720275392627051904539439663956288024764926546419935972612877838873860807211374801671743339729742054906685047047767356693631417729400843102370617729829778667037333207273432862561247603953047326178365606007855734875058023438984898848054442397946717848541121278547380330769084831861982042191398804203792051667026657977606785943472889104966073864995109796183106252149565421009069479811045607420181393755984622242325633946699399572963140519989388262095639213528377866926733028216988902222087211904255030753481869993727979788510106849526524226335166432129827262155670564510557126155348762057119607448628057606962086453886766277172961950992570485698075690408554386129747539060603026543592987735610570719525771952376696998061796860823633027923291838334268043884625779067027945442035064571295184458857353042367695921995730411482697205167696663516569894932491641170187484429103167573881356782022342540547990154174668248130049153374057317024364743299378767846932699133428331132298228105599254961977056922159726560220058171147874780967661864173303941084191234075904615337836478969981826977444646769762610431107568787651912263878862715804071525283112598155473902337354360728662192863461660160045652777063675383873965176259217674330091962370011070966810357526740617928653439732006306918758098472882339382705986367632616727485343529138559770332498185262127089731421591495611865573862745391827486973149547579610506102769193513277848496217991910920585551817532511798898094955748968450153498319266662229098671890973036378130670326422414097466686303920336852508492889142088217072147419338428911505922966474130094919074841390641289389972966510037914506459988359912532088988577109901629840480491457718093579859935741375855696369257329607498801643943754504474652706217758976751309487527690554453198263427135359266120412020249212779731007872757929076260154981739628351416403651805918217866474545288653020273056548024547806513226073302940611677733137604450066952165138009273337495421665855150222915750668495421479160314973850167801987228537959442189242229260521113956538598076899370992781158387793645429592560015161205432662007236679629355802777496965159254298185018810373917574999576909042417230576262004627643682271360173313146848030932228108528030650256982966179762380987010612234785693484684939541321556360478634970274338786182736762597944856243249862986464030852413893043348534582703610823564084892055774152629556345668593978257834297254349099341443141417851029322681320529862167333646894479346307016729950876588466569149085628707236419394330775809063782273434311274861324243063089851559492681412380652336831075464321710266297357078320055250630909711585267360995036984755762104924704449237825040045554259434673205189444124437806362479592906582705193231575502617304353119829133246761787339830013705300777297284134043285995670179010755829912034898970251001242875715885812631424077075019495989784753298746450848611164743990789620279644198435667068643346095224078763586846626262657956493723079683403816540932200889605710232870492285043035107767159323078671344146863123341770096657636648743334475971087465954958031280321310880274527799965497135288832315635849906103412429912940522278537652239817106738185030435299165611447899569013852217276054120859808617517677425956329590293080440143079509269379584898909219207644192322307737369758124825309820424473955563763983549630012134998510823595996416404406867405137898669895978171379078481773035073028498159557728420797114845885660330884776319836334758924951760774926064869740875256683296167873467980759074625386394262443829061694454810988368368423418681670705008544595011546185538016449000284681285064098861139100201771879720004114216787988983783396337046856061130876442207299258514503819610105357941688211654928028977248844298779214750939467691818538845293675647596791800744709496548868680364979498904677934533217766476268152540750396730134488657264979948619073232486421828074897130260178616642134711245295377876040808390178303233414542454819946483148803048258988750689962261275458601794198902554340800429941262489630220097106144115118616341958348897508186892930321890080174599368618283703858352649993798360289511685156463094704731323308817449981965683095058832716720254581674375180029502766732718237128065238837610334553575360693453684082585397364177643056310162857947310677180457107399990030658294355098476315796281914108533213097744552479007021865824173654097942695379127104821174278252562118578002571961878472816434982827377048504075274362240142019290332595645873090277867159647661141109772970481030116861036679708754230670484992143287692625213021622515097948156709790483726246849600223458988663278994735909271683249163750740492397340785862547611969442860133744035679106328035185645199807530358241147953203305798528747304952500022606952399611384048766237453298718984117130221092546367514782447673369615774941812399915628402343094562001026307976308045524833313308372864719036010175603060137375133464468091613290077981425608237166647915218081644675652402665227148317215216628303622508374910669128691426450114718364214201991899413996416669924727212984264457354176642911832749815923539052507900557637416648909041152583593182600606429498685534557509462918384411003126279394593488945885546191964852036609728017607644727057651924834566234487958537669521193076598616250360218836929673774658776442420182292118698816042047218081842244614371115334502702068885713547736242129372121341647933448308786836487574831623321950828255738002691923542067376386899749174904145152028388561401568419245286070929118318864807262100667509583357527102167745763732561521200216357087155977508121143257805420421040762053776603466975104798303767473668155305313163060762155932425215596780242820974104303658665581483200003349546449275328505364586257056906082391068775273395191661575215246031301383008290447694240203235959946927801532771972313267998760332738704555489656350573004648501095429932825868780883281848831548864252117020267041301499158470315175045759901659217941352362859775849443487053119777501391838378962883691539695111731292307409289330499655238857810399133076707064191483501315817498984932629659502710573418382765898007360692632249207487368522585745755323445423495357026933958123208350957916805625974552616364934710311589913281736771903058211809535844645483377096915506630338514676995241182760323789899478405757048849792785309921731660338726638916714704149583049929063265408397545870284467118202009645181031167978380455143362906775791784805606155730219698893994244760880660807428760558453145727868373122010030146064344153245412746221989836609465134506223754405531943093787345477925715791754602845212447376905236644757856192696400043716437471874178575223025981748228627773663304762653038526268520209216814995423981531185520574179038962142002966337397990986234933080870365378849414172196903413647560724551956111024444679783650380420961033564883181120274890784170752244976489958137422064500980108115967235910530505727223281069570607378529952797819258977449569249904841571218419182525581849138798151177423956439749876841433092879424348222607797627181323543743453928151769484094947735725472951652347647345495836708782370852073317927490560127004334361413293915222269942703303551278523141462735119702660633210138814444304741587247323014962837413427586520967253700471939369013405897039431282081534786596369471823759480336934720797440707800205807844475194637197787302733622397169282166617612482458355103174799916698087518291066919963206214034649405845402719630781728564296186662853914966413006680401784621988733673026098522562456248137903490289536263966151224600255202119840050052538145368038611005206023952632158292381489794588647207174571604139644956954187649538290684452037850529680977688546337103294836159617196346527488768198596268798287063307093070493963513513323860535034701937372148926644924259678779950029399357394917273685662512508569168993075020073596052328342338661317856851618576292182307999386866323458023407610869066242663806976618043706662391054984471776184627426184559112590883329332202439785499144278145343524738683836881990514110218032475536385415013370497656668757417849669042181007383817683335310496094649372565190977906700475264294557770091601511910512216264206294880748444562236597289963493682242316946108617853554263532425732404536039127871678110194474314409392415902167615804429360199760069551296547665402544901756818017919065489464454634238027022811489983045196659495107275102150523253159363340662350368637792088287091010982376168417132556886032041696819184613697828383789773405270790901169458359008613902179499308745092656458206760976351216668763883095237264086344688892779084435595808636633816214033696746163673384549178486005423293802041170955350848008077134627385890911779452274340384852736920308984857325395127234297860996661298961869763820907678579172453179372425654028427951542016642231983185378794527147574927964043716608131264870803666734064096515367071801505124597712115905163975901795077044699288585984379792890504997841466667995058718641479822361481112633004881936163007512781200398138752251430154238450716558297146378150485005334683571899778932749630651554043571527226937035765478228226168209651234557771937631872847807408459514525097579553748441924263868497397871337389092987742840637316932790264019948772077332132186869230830048131231283881235118480321947215089292916751520748304902376577270186545674313415145313256635000873619471471171469477656141195947065485689465353024665994898824914272367017861295706979547790244099756791243907353525958354962903336174364375798439060890948132297175122968771216578178682623651143132313776197625797193768517588926982693816921531632011869144788646654001211731433244182705891660006335323140933076929957160283126550283103697100071433921729302767577582823802957120636257436465850450118318737439799728519609564137035560117566537322034188924894312248004023072295071700450951652528759964144110057509269247325548857946121555030924320313815757925651155248902612602454430199878488975514923349978181119362329134563921739735845687498505880929530990357565572667366096597706878432819354492314789417362478796755887602735255389792166934926205620992065665988748805477049333249150416717086092544587403319124176605564168352842191312481281564392023815883657029216280855689482072350835292755192263317244544351111674631239482808903071408167884866537451308600353973591253631055062261364802644640406337619798731914019934567644810350153757546766614816318066715205774097423545651834726108412087701128014489024911522672770318411776824253539527972525224968181878289480740637816922268240708418714494334749915341141197714118184865087145584258326463913506128560689563337085380490146899352067673077383308611206221693115308562898734531132262323027426503622602243861580952373315603180434941097419917652663564883823174676201275101904710156514538390253094661464152161343474695026951591029212905579176015441172227164237501828000676576298814804464371421173101868500646984825946350219423194046346868969568567184218905493183650814185329888160363164369496407368429951266757209545557743840388952404219426805944892349017408035107402591387462391727888559885908643594040700601275338158199787506416108275475737733051293955288050045911303278332175185592761503663320714846936590008590215860826490323307593408670297413374478670027750255578502462349688872683548798287962869023178438594628044854378683286281725490747292410409045339954771144276782972796424223821261175108929001359383111617081294360717031610116666602491204343339631020010254044262171288111496608738446321753348319822213088447771905391518404174596175361698011807541112178599734504764503335998487940268575577434491111667281807528761868356645503322669123233239870448211864420284918066085850251535693450010803297164617185339862396435285346434066457736725798464349133932641718355613697933565334136454781397150617680923577413829405806317845991206044279071315307088505064751845063051920934592944216236065263323643954087019176180340533333997651292257611028227073135467908876221605239017029503493014184425611011418602614633141077960543180464862866603036974724626009605209021674309685589202249765869554757531747590993777604448745279018850525071547175625588667166938038134255353035772913279812955770161384093275422578116745605828387457121858824162033499501260035451834973676028035737100343101576754166603511412678765771317354873389157698736172602637671393676547746779564821683163161680561074671609369061964997666487612401433170270307174070968602915699700680809694333108172541692643738541921260615463694227947080862683966190747808768570683890051859080524991882700210335707468472734598924098001602713299170761650571012620185949673407147699018586764612692506697062347477519952980953717150323948134489445007121273948087937651468449542187551250508044238155137480542291110058279486063205833060611896030012261361345528251565355159455265334162125090101391396834207975904808794193032425564728018872934381308811679971288685890149136832241693705429291988312559836630764508492850543093961372601861183822803315107508801725405552936604463735893718456219270606115828165259161870338282693620781809217374986669723321683978805529709055304825536399892940983464895184976151168669420784376028934508781329843908166822628636203124290052252745366705335171347517103166672483812954105929126008389225356617916535727997619691871961299401514444473924491402145752224513702320211487108304724783932047077880803547450692199537880400222872919866894022938340054131936626672098833992251731713369290825690484943400508483764586188846808949028629531307573364115853292128955797502275154826128992527113703595306608296996423113030219437187510496047505330377783894216366605960276787451091177587852776526497478344416992717763698300168541264242976227514805941313477042313053726148743140595979376686893850866216064135935560671292411792896948255497098735855312841993115430457429703152090776560407681156662272810872693905796170543551323913678992019527334959009870768064554182818335491203283218725022972387189870126020282240735188774641520155859910864809890525846010622635833167214884148609682669490138259978918631515031962671442547416516330901178643640720717167093728123682021029457967607162731911340029399495871752444501028656221478434245112549906891958806060378480864487608630782634927775904047896243599221479102390760226711461641783474667363555271460420097218757214628984195135977160728351683244283398867508627464955580750037567009165207175184007107532222988105659981189273560802540945099461138929776402752529710365480862658217096283808135697252258568801011802256381709445631351861777180750624288543259906680338625224333098473916276793000284762252766411604919239637519172849270638349034167413645061318663674849299205507578824960376286724746127952536334347202895965448945816811766924585390312434657797883653843339190673528008235406049645073457589419989479627937826643163594638325907468347777709543052240814678193446446587980252509858882131570631925339376687306411215731168193918018907446841974776814581694821824380405037409250634298302269241358890875850379676825799111483847551206492652293330960412438318022382172589196915097848050629109957081763019585142248464595659921577688762455829648208089794322763655558012456946696200957858609556961731719440612268311317992308042285258389432675833547176052481717427290503856118280379200374536663945558553123071661487577975449524451046136492998020443044476255558725781373135701801885053499637446599644763763566539310899010705298763665896310037313633856603698488617383819071552631673320174923459610154633227597776522243422942576607267272495559485051189085998254477095260125653089168366826857404088574954652781158807372623484810848308029444395316579939385432541377130997584277660275217475711064648241142788243570424198525468010270187517319625079157524815465207462483165011125592365721777680890912361151768301087221220377300540038768650664400412656656685422974256487334847492519644305101435793762133424403151833679087241102596356688173514743474950430056384323338529072703112889883856697421893329224521447524900411558262677136907158763351303111681341742411867036705726169147091879620892262007137181342314036332541427491790165912764521444354312715020007876299707161734779414837376998431667010477169230274169696435833057190336605474735433707579093970914115648679850259963846629764024839539504252640148044775869364394811382480428259477284521108347296253104327861454596118663322375764972633996741074870798165180912953389554882824391990754020106426963376380382983547237061442315205376835843061001857582119267229716728233571912800345685112823406136140009206007207927732237202631804950914988409924271287309406440179290448220032548965027605902379503051398834578504560436053008025733821646763642589920235945249331042074172073368975098321194041906255470417695435775311225834757938129075522903802296758168199361728130754233705505426807033669338486077690171104615977858788429087144697398302775248297134567645497010502258305822237942294940623637654938442186682363353230581722639828238538255955190781617322596405891747804994438325392706586134995695207601531105716982792351803869605175093537351466696365997910975206049761558756241132754892625069260771413491062639614550500411959327504034905208180844065513908927962108597197535762133314888185128656035356517294638425339286443415287812401603756883038528060612709659299848791626821085143041500945167778223095971512992277578714794109923915222694526439871427624083899985678026741449784534875478118314411897821922531843037749185008278753956554574611265050142711478317982763584574691345332414586949338878574778549967748848442466586837511084459770033044082996540735595149718420527232986876214982069717214389158371106605157253178550401077619871980488819844325016514687662904866508861763455073671455035162971444890156880487095637009005077853313522182597500943523166445354607978797493092533951623362690049266129222719614270257898828794575585365440353755485434290870810804683632538239325252856312321904160698578254102677068434590421719802074344633985453709045202710037755166294258749448516492042833647706847679908943436949778345422754109686092718761854280498902071853555702247070524516751714526951025478952092455452519296903560295420837435364817078628456602842257326232410978996803205152985832104479100443848591682851391251302757168564546649239091538474522531884457466040457045521442812049094864754379289733859702913490499850842642123968783339187860979670427001077697297533629915685548454698212336748096498578309985022971584452793124276058885580632125602555916288064370964811968950444768482503190279683454891314912610223420523772522783748897946955520443703454504121605939885273700075392847365864839876945750945153921658966037761445972682078293067348274697658956264047966133796261871140206790421156082927431317727652713969082702199078812294935516310259396459597829336738036472763906402933290709901570883854896844890278444258188829154711389665127315590062893696759106501255440849546564081406462548964133366282607197340214623907034700489546886715823518201686967809432417973820079817375236878156371541046353466454197339516915781045962409234235109281641979063285583476180004557156391428746287171822963321335246918258867651712335368424381682300447702636974779392123741323992574454958764715029583464596016373157485144349432211696570864644534199963364199523100738048091002900992278686199334499045707081762310723564149286484491821491656009446514838581041250142618377916077392579239384146612646715017892176176565314355956403387662692753998397569604294982011949118653636141533399361732122912889568757366080074934990985166918846897351290151411911847435151419018967531464498559366181455792313924919277083325571735700231302860575160914264095822989998648456398075834512820587551108189809516348495475842806832592392736459586906263823006007199182936702642783626335331917552352693583579579137054228866055452359979760093246796228354613118649586932280961638926056694445454066728285103444622197958637572389129484032719264480845779722378133994069066825590650429713440965389290683016168317254786664104328569529910858143099652146621618870814770291574408858504499046061293728061727505179021406981132046052199958313772153673489620878028235871612106457415949130314093088531885946026099178219727883517627457408087293477646877215357382482258720959401381337235608602385440687180487474251665303332396558613753034775267199121698295887378113888799460335650437380545025946559638342176857005491244126057659665986093079159469934319843263895892752277820319058210179826401604755789141459317515848828642247046019883974860765715422404421750521313021827415039481479938904350419781666131875623666574093158018046977113058183936266005092144681570168828245630356337810609109360840701181731162004068924575728559410061451144480726071948432446256244042580524044130901000496056479940588893487126792458786121415365324037779454669973532063819399871539547394875018100515329960382002731418996403152069084259336931004215729861580965213695565796721319795584867245730542696322281582210363544598556771721706609970022202804207903297738210074349148045111061581964726744451408474289122652527766425620751707736875301368178359239774538561286909717237457228035801620832415718716120977935631282071062459510317214101781028257436113928832426948728873371316581557536910142326123835471130022378372473288021621797304062280797429051244214396387715554053417918483445298250698537161415688030128435355475659505398504994331047311409168321115729855268806735394255849020911319612473748602805899028835512114966016542965228919224976827915537535936898378439893978062878508945192799544459818892195472613576992611539999937654679680137915015501192574123344354418298340310781995991265423906022535739277062906679182724543722374126409524959962696261880618421468806200229723289487308815187353753740097483976947632826936154867717530435215793095334100494758912276009065417273221494736489252657777710267277936466963224262397818079974863031454466786465885483081053655970783837483336341687236841821091346105728183882829769679876017029106758780873599461183654710825457471155957460128805048667491532604070364700069579083647757284770246368752962810439562794085548575938562102930449902677897139221364983952208951990476151195691923477620154193169009386562908167970408013170573110315899221977511861373954102742996564959552383332728939598040254093125847717078743373351274618956992503905911901337998449288959422358283681257939778665291349080730701573285005885235177810675129852297647917262176483240291233633260538106334355309639435868033133291609670728449580128442005691363593073608370553607566400714778029566458109178258707712534165984968350880135540260455689818974273948110289243740193500865130481229523887681025710905239715892707601792841154827238050566565662819314294494593595250088996112838439399801621959223744646602620477664059814191077516769647315651055595891364499617362425112166184841705112284808542936162438233255776334735945431475809150007086005873799143312397783319030528460340286561217343917089421776411912278756449703066377937979024620017886101758503705962866586782109966070584938731563976720241038205822224819346593156080838806356672106648513433990595772814296921156550967723712157977985519999397252263781398129490527592871379609318226652199174481767180135212254123559493956581712278723468929269804267479850157082897840731818012663763335946625256553105415216966572619403821491904923286485329988263845465738029128993014078115437307464092134455941499300487456005122909243087723665898732287454228217842288502073243463603804160994683601573514317499228306810532618459818316931279084180777497906004626617859993456971134678508948191341831525165478869108805668262079787173029555087801022683548145959012339502711130078677582139395370346308067144836880593439577136132540383673981268350512000369223416227591912342249060379089286610640900420605923231977428302473560137511756511982952585354426165266516304522169432419081926848918175275818043141904366347522944471737064970338099042858638554024721370446129932885044807676678720254056111160851328451169547605220920803198987117158763218400705427271131002223834407608450316141596494939468938301413695949985217341683491435439276929044459050107910548075143985269905674845241780307057103438861085766452683318575399902144853690539974649273400322893857379154637865960865409078353655222950593865633977813566050153896097738288202117003201680678806249889549936218801959217428719179836929950127362071394860173263630815898646956027561298584017586073000698892719149616810943044149772893457366465853968559311896809145507794359083857220809135550371135509981190643775194065894106973541957394578264681954569064901930955069256084802135450481969188181233948104068852655782766796988474689570225690223819456023178843596260336348643784040500832407595556279633273906652281476531151679322082665159147687371665781193103781111831304590560296520644207162320893481191580504107562646945750683837412686242051890078684650186538509859720028012683074953301725030431769174757650379621498269985949628877644224303169028129649754054139562023831202645516426921160880760114798571549110699838457386110382358898032650713792732305048259417312971919133581936695862049648773884435097303414707866129760290678502026658491014001599432412546005725465835628590672197879972874805384729512367705290918031370637615405683564503606718313899696624188552472621268273037905582315368708161516969849545744883650073056029387930881654101768349732598677875493552755742159658004924652792834334508425584358834973080128899441625280180110544610588734049810100394364408927565315944126658554783251337229043518133413753329195447468721454499183071043010141905602627547310110828356044241477103786753359855043510922871773976306616191663955050522870876958203356493923204862654518303642180639626170040445831331100237603915821136711146652998664280901536220407019206146972972203721386856227369422357488750654041682980510254695933269637957350098677517264033962743164731580295048214003671981829021925840523221462737976623080950342669687331930634540277078984764573159336913717796650062910150764735880882273452506422835786146153870574307232372337241192216217654612841314816347430132743384114600082173835632063168641417763982157833620216959700488597995834357764966946414980795446288201985588123696189179220788531334682162107480026358184185310308537546898136215227066433209839398684075604502157085040835404987176256071334243636760796010902696952096995200647424880677510687832960552125571350720658435768998534170222069869883344436942174883705072863285487395440168705701293626476380393515269247300560659031215507380946187781452867818189113181558385445916019507844860050738104370361406935642487505029439163829548065792090957338465920203110469303262855507595670511058230947896472715821485740180281664606339393367406723249993407684525418097640538095381186567997735998536773553757316006693119664094490016930860577650956534492480895813895697870398791978259123278322116848270690762728169466942904531929007766875608969690220698151658814595588492638485565560584254337596816082964454289333565871574835040344434711418827742152107801753454376977595219434225507914553918486526895434744914353703993601321328454120178185487005433890954922799298962587533555813015570408485429269051760741234994089057996129274637557415567262259999517519953276777815006197861077841590665892987978659798649685404907923715053971766640997476819793784461120905338644227103209082352962657211958594681203348356727366759283946697522355303194465463654870732837678984031506413614448136629168747869672653313870843769789670528976628556020399477113612419058454026907674196397712307696626645804474043290556408461478308831949314771042640806450190715835913258197743100855572313685595816109977856517109872228520175006601720901235498676241517515640174391054018604763946917421292282890875008646059675159213905221001479558621761059221219376892759226888502354195645740602124257313249642493527297546405222901019712539746986527294685663379641038936903408417636380700480354474999537767644422796290656273196337251975567813755810801469333129291784988349298226824251156419782145297555764646375137140031333001401949556132364373567252549280361840551791872324066123890695379677838519795445025981667857506480521520698720428016318425301240164193773652638847492812308380925290874387819619530381685234726102012449136915688523736772957519265804396085432919944432367807713691015542271685140523830712699573782785769949201208264529554636292032255441189268147231072626892273537609453053391430567138422011301268772388965135502735883237416595891409080687123498744960027655880021130720197261984463044115661135115691950116189055536556061158223991668246700807999223313500958022863030521716323026395943148260554836552124946667360789846849942123988513195284969252629535092806431278742124336493884359110020601438061995439097822436859713962429889186150359035890539523040715842326388682504047454225293373048521328943111912489904194568029613446340773496693220866522241152086201600768904089094105018234692024757906224264511431366593947309363838853925573354100585405644248763544867820530158786214148370069866807521451520105154283359718018997302706468289986350380117202286122407789388295614816595446838026160534634571163667325743265795356235784285784010962863318191714303822076786246502029720651547981311670719725554675030215349919651616352119444477932398913232397255489424858012343764261165710354228507656741228984657371253090783601767706548378264143744184026892846747195058375461070708232160029991199280429078015260445228474902581604972086270875398567911391062239206560144505932797372816298820577276620624384804751947715968013515455617020597063204409540046604062151246750967410433091855558780020615335434673639070155001397475260057499924913237529863818146997469736916180571338324526289087139946334635221933457685550657980867713522436403957658428418119914841624393077515003446862754931383513389152302487223180243686051798459959525890902070101918908065080466628176110921505698794201091857210683573427318308865950655715095025525706807101525440073745383487301063737296849650916077433398513874451009751371844662181358388664865159509065638956572824333370220844955402829873375111543778357439774285234509523418416709660058397113386001294151070011702353365266187203709137404071370802362978765918041318241006530322859596883163811382258305991546849251313859978916938782943976829977053339908570176309574140682759925847276226872835105946800699147147819582477930268966348980396031108889240198783087326299632410997198593670694535554997217274649304398843310180134707571401162797096740049514802907387839551464292364510045568088798714832275346372182063716895962615359068697462125527285199844350412699264300916337785023620135135184048915493427419524885354283173706330749064607644366017365500198796017243044361159571065500486173513828340799434792222816115621756107508849850594797801179348968362045870178611383126476025440838619658363548112978561793341539835326419169012008337924847763979777048560833898343741820629361128744390754555892789534286251382437316332163732984596760568191798829218197867183462317860799122879392284253212406129723139494857338727078167122675869250453228013252875858718282271252931983881702429344808943609024325848399264660294561608765364794006194027438035826962209524573174991321359465839869267860941774851593508545084530068328614445103231481752117617279632509638704569231877320271332244009434129720392717168282731123953586269476978650402785162612091599053889128344953586300424249727545742851929641527371630072080217172299083465194086729126158263975580389399629298686594020327381482439242551574448754130842721878746134510966143606716633693287563955884425848455256876392703442698123108437043991091326580270993728587834165958087096702775801220934581194010225255146078560383447777931507757900069539626402475689225338203921651611960104043647106286825644327026936475026677993708053617127031377685817713939042246629150444459604135669004710046312907026839873211107725018818752265840990923615706656346206480389567875123745337946523429153287604332846531158370872675474612893186309770651637060852785580815764617396418493535570168886485231327452728065083317315249815824077236681887128649702774577475748697897893476926918335356569954154133498788836471710927835027452097334904168869772520797326405251772317983592351564485202236714611477570027885283184265491643144457006333357612728952392902666857878893505862287070059066937302891886576838161925444783576166061359544342106904867572132069837822195578647237117914370248563540862682205672784958550186380268199524361083127262253033534127089690185489462201407170497860659287549423226561768983654052783854523737888937379877040314180243610188963755265204937035525652460422857674190045791897699144721669982288215233735098238762648819815879477358802890989191402705816301781699287897984267203722682572779860246654843098237234055303697884399907659369201460513737700190094139652667771074388754195132762811762158461708097800108282604947787237441623407698731326296333908638405388232617127073315616301931013851486034667688170669546910569857317972208961965345615435631999453997609152858439459586632780798633812128126052120289196468549002665392143229604747417508545189625215082708520461865868522492958941789117460792909877736397242424701905176242915008467211877965125996244545778181508647442597794374672142065079429247284343658709749353718219091930718504922973798782570768584780505575355447333072713020911560676575886571384800197797949089161872336985212422392914881497936653957586694226610258217584143196707810527559484905260174948984208717149084740309791681630822350411809492231312147907012044990881118801064942203700419425964009639396685351484290809997503615655375568593561607961855165165011949045882113526838933334089542529383565597143351185952285803759038624497034044364012627030246825489814413204679972727061540394262268661098405592564720399794816902938295024030530677960491969751085555539864536411516094392114630796053785662592203815497207334275169015721817003675807192030592283783047118368483060463237239560796008305421850764262020215195104115653947435818508131523130476507033835194443220704650817367352620011135359201777815659098948175525704538091691209171328547048560246185605421875194462867902558681068760037075736411232462694546039984604031009514154742994319690300084687726279611964269437180436933902994653510724937022646421902791045178837025799756102517438692694200398201208987067680122842887789525521595766133894944405555697175724563235102207853040860949571521226510867523695734539486766637775737816820453516155017790399720843404210195934487883727663571421505597946904793014585853828940638202199613166279478036631492470802529619331384584572810436835429449700300802365370775752464593330476396604287189046452955060547589188403176784936680437605488221785475489188883085613731152046314640765678278818924065339890475516254728216430563149645016512801658269086981919458497936338459765009688127457514917690775109055132391866832578652763318064744729630279918805161763937199221345584233772947549667398747301290068204025123090181240985444030760215893263579038476252905547624618806525846100500876615961017837098262293295414746564147400359073061642551000037378146075684771615361116175468303621927824749474819323817579890149311087971671550834504491901956429799516746629248092402998318787554442045439253106308067174453431947768323011791069567768247100219774074950064121726576492459884461542382966036335586165535931263778493554414106750659018255711906993371412748236229999363906007725862879422508776605576558244883667978900680355437183362988347957011532274622249610078717878103472759633120978590869176676716702203022453465275986422071454621111541022596785568246986330009576684144774157277146094540862718117814295975538371363942464450200921517947973440052852609411379091585985379310602942279812528428242330129534412941353589118028267127874591210037180259782261795720872210796903772255116589679882340621293343274119111729722547930205139972204930440822309868566323694228477357482837080589111043827907651443790471964502738860238191255214843997513332813511435291239263734980720359507208795065800071905594302123713991508224944051248910699485715070031903503398959760188248327087044872773927616864290642979562205104110193629451750018147391316225448742468260528443449147438513199436933644237457272901431226713973345818057512797180143703585233766773314111125316717892511059036815432561368526877963543275760227450292254075225334584316630163726205767502915045220157800402461145935560286561044853636326289196940699178557993682211285144304133026176543809985110002811379065533719729012870149351779974437631384093504733787116174428113028068292983585803036125835841687304587135706793177201981530485014197408541332586414960242106787009365475669467732256701050811628908968147042275188977453832901480098906523423276767159619074003114134014140831930493356418272638800893865106386936164079177307890969297831774995922606620115704565862965813257883938276606271418159323803186224282778966519323502579007660772645347344069642701552706455169710493290677881072907545002567404381812334025736508674262012668437669118927571616359337106546658804195114082378899065393255936364180942288287192423753650948207528032172205092641441827543602954858553653227883762741068143034558923095609790720776868502920811213117149364924513165851629587774496959207735654205539982723305190575822771192252086763141358781443885814140338548440173022053072384414190504726810373159478485420552974142883807034327635748592969201844481810881159051742020014284669225757014452743250338028154488139492490322267227078941437095249359109175364883826168864241067615257416597262309906730531876244768619718657835928814663249520182174688208497703385070083438721506754457742507501423528216611468191470631766329534802361039996636294792595932036795766728653644832941160603200934652255892812666472866291512963278858289450211767854616497791405410773550502223029261408688785006724100840091660534469741709278279434519742680857749736339679867638658800437113106993634081286008297891235937957013706140807506746837170093890809605104984131165101381796653003782557418134776226306257978011356336657890402979785633104848707000199007285778208549468971581485349391360545772366340754101099223458040072554664769475767710274163172947198875331815968678166875671540176818718976187620149286207180841647433010520084147484373753284577681505414743213408957997125795773022965006223240597094254535151089169480694544118999135685530859495196024196881645156422418197754749409080784053984041891962450070797008900176252898961471291102543470339216757693968827071744236845950028189606872937903812875844270425302597609187431302077198705046198724933093494923821501723324712938041008195499225687533851055437310001825976006959788832192226983888421081911360920867102143429395885305812885721444616951667516100626451519821639301245163160991674382645469474636023380631318421300376277187445533390527485607551954955172238952110527831398163455410322128245487850027476030488768278712484680747624696648885775665026413592305393028463633058910778452170086119853474867760708870958224423608213066301138468845329816388894409425235925676354364834195332591988084247124974970570249962102895170375676326527839409948547006242193590935029083847005195768335588240944893552032507207316977369280539664851853645308308361461262802177375071930467316936381043798656643170561853987816873432929560797025479155563085594268843988781270695878567006655838310631296161633790959472428750698263579055148248083281658914557816027092237429312129862202935655226698434563525325775884947034511438429290190257331106079667349795827301644937826680886303128700049722330494746810294162650987539858149882850105829976520853278968480110005913532160397397343656621319748788223010094997566969936393151822592302082828190770112663400891855365039614860634154048667782032910790856620070509499390215609622533674838033114513700667480119229367300867594351785820760233593612499113953055066928570871683162081705142020773678805607711524391848458857893187074348707330511724496143832915905095874466410516248966678243610480281133095246649884327273397532631398590861455953521471994795536379686502350347787983215127903124006246537453039762511464641840479482220585128237233863520985923213702638754975220289388350228552046340659227738657016202281563395387547802695847082160289826963456408642498483907787218771595602623238774589809395908826171274889926050055675265177922964084062079297370142625353565449833955319676346074797213752494032696972066303802654182346730641164228032128294378895783170189298285299439001306083608134929381509605038106289367273133645105008295019238988935260043917468543820216915066713324784478032559025170077829062404656677816382188294331265291693598720840809406579440290008964973429986472674016710033363749185622190145063733807261217921905019778998579360077077089169983571608516018193451708152483996639639248230471995029663079959372835524681440699284636810885636715628183057454252740982588464327013806938246301838971066251285702063813624217270438324949853443759987203668911771500330876356108291410004352585537453398766103179599030237859575937336403764626446034524824246458932781901280155949289872857900642887512610660812868971934283883811903986075238469640365862613706637456198401194215054084388264756367157068485679875205501951583184192832461367235025500433317589766828004720599788051906953914719162018512233278426777354171542096303486144514380953542110166419196601031786612978197479059341839569957305172905607711535758036471525749762432422021069390178984461817322072765442314579141182477665185332383444635499963030592441679314564516717405309667787425622293982176427154401977795670895677229666580549901638271328923680701030645257445827332410234148764973157680359625607978386282569014570720348704877716672199424114534295145310624397581821925725229970584123601683171153320181720420600800540168351498589267002846432636331604987593506463075637086214652754025526956425536917057721245590862181454473288593043391342400357854097822380687471619939032077306382123430496288640442098418319500146727717791259702115658379030632902822907176450586974089568945902822201541386313225225027417941922597191034497162578284299379642800846469881150228893816228083263539311744786304257808527146081828635826804316436718545104521923753495572174708896447985540976970172169388190001026844931716264487683313648272560050995646797934012704077397778597796189828863905192900054238284316665387446971087754765157608458181628022951987038267393784030199519875530454398557715603461692128081380999758745576015182170536158245921366220233867418450856796295780952630922070597198566661368728162053672954660414951523099504269265005904829310609522586567456977858916681596791814046469887987581556024919612371034899474376180793040703113544287887095746081459502088194871522442965305806350672248875068896477985413351845441373494961171593380034698457760070487345763686058239946991266346728842857120167727106470529736767296457131687390250762033893624238012142090427666377923063042593010065402566552764025431806193328875951633170368870684757446143676640370031360267445319078917622133010337581774938644636418960240399409100673200917105078082892903802960201553486476395726863184186036010294118510430359977569376501984741658060332604970260684282597412693549811464702529341941500798790948251721851164501796772853399203576376457655764886333143676548661672744926452602934991824813748161223115982231200216673041931376671108159313619437812796676155830449218713992033287224074583904235693261611291260260087574638672670219625957978578517849510495179667597895887626332495013324422449419713305117142019144242207579197745989626685583048684018686320121275761951913314018441626303470137089671000051845235329984712566905681112434349281729084472347312104585735952749236694024525847835579906506846991418438526029161378832797839045966995494955639678929100941176580438533291257698995372172982018673424730216233292169869445651812157819985170931487406755604733349991738123406946105274502681375086349145520785007943683050772342831230600334178717869185692925466364063444460088554685523441728074814752823005067277121746818645132258805144701279959915980750045350986526769843303563370036805438572588238908892934963722084588019909778923097735239756641114902204565080937838357866716388661736935152877430015263543023085669215614166514095109889535952857496360505408703271453948631104249956787721873485490292306070824344130054418334773406290585739136835520729501157607007686395956423627626353872980552281524872085705237589267488768124724751635228731484800242335351794837234821948814358003136689442846338067840861060215786661188215943951690854097589787296381817998518437627592011660820136516844304608681029899052141554830222964657247795743166153848290722181646220070800494947679991158700981958387070665759731233469424647403664931484044684592751635696605490683356712909572615379922904150140632984000781803002240167349175238541880787975858906932424461582571598751087537083024317943392262548074810419247451432648485001112221630903392352979167091240459137702162339278508743905646289337906349212160041432780618508325386500720679154738571103189087385077318320772994184843200147635136157165620664918842902045747704712353667516656478135941791243598724479286978741157459474189216892237325078597874936471675672383766874102502900201027317243719539269625632106806529486319200708167202907974148960825561030119040291067988929545258159074475974124686634970880858969174098096932980283628405234021665946697454365125544312683410386516097636612156963392818622144386936126669765571082088540499219278689480813172926116206237893383764156805264389460577996577968836830199317368553755170875318408790370080900669226315434250455000148807456436570662133272769498016469008069475520762187158690609625135101411489684529538977817168567505685352584051259129791701929253397108784435902510725478358963880408618676036587665888043680178246721388081560063260039695814032686838389102183071321679851561868441106675175873849289007542744364456212462083143722140930289675477669955057978303777926973053988515470473471461555955488236840305745050997929146775643902601956150920714576833777489192879339985643937581021353949897226086445148134211010483764177994274910845322760048477253636938195180557706552086320440970569735254630729545294740878204703181877466693678030264549890509120794269830145263787030212640963244579175873695311376009963719016312222590262485484575183551556991689004997093449629453972310433307218955925132066349100791527727701248560083077519870841349263154251692195763054349011532618010391250039683181551218971404485141947172805020300558125180097906389604690277107387330864846631349727261612454727747224009121958874562763050041707466196470069905236662945519776063777545339658491320954820365905407680466678264970332623817031806291641602480416094119453938489267897862206982019995152478377548975842640367618500118732751103353524944506499790289053134110417711156172463291902054878534359336251376144976218261877748744576843381396054479959780272698064269572539453714426922906194012920628660666657962730335843442559246352735333483527861357037644177933652719932250437031879200893071794222854881330305137809175762607450497835346882293732453686604084571022644657210455058498772260376821138280279411724491429071269434524799828678981236415771327999864302587645295199065435213023791103955647155767116535529008233556913488347449085164454687577904167125140824546907556861050206825158457359378388667802999202403405266521260960171714668674795082596320235308207988165731088485174294332426806407539824819790717478287882159825179275522392688092236407424156224611020903107776484970444610743728049989976969113630769488806247578901321756031225329995714381284200911294789690081145616894657658262920190029551846277251880722418698332444895193593075931081179597860603983928924787804389156021112575478564505156942631050293461322728841113003919188528156696589958806892447166168153852840818110534814992565230038682928323147659015651269344514360224103450056345738429916802380807111372471513059383908798828723698807919782509464274268001724881282159119021432020878322869194307484077083351018852865983851595841309138593092124342883421341400121510952522188565595263644232706860235533675685422703291890946864581806390967690302569286890364266613404367776221724835615633383633679814230646377828566029631589266114690652960078646273949608052209639008206219223999352576646302238260639562197242036827504416225549574818802543180147927290552846495423522463052791438339302117811880389478507395898559965548027975726521437311047673010212734265052025655126065630013499931231798380369178534762024879316911235646993721352235484755768243552074962005266964013459707646912737181163956888109136233585177925164392186260632239615167127351481883587749844553685938314554948282396932059526535034169067334561419933033701607837688765332293694001149036509530961840702238146219191958695612837159209188265541433277169621411552697944504497601218438514813853140815641446851151966745025756124910661954359297584449334241842830902450817105740470078073669927354108797815613599010517474449763961844374345776240473682482446242719861553348982045360066562896941822048125073080704595790664600093440377853225788332133010657200864910624261955973699670859964219647820966194268789258203940205602193037609879013172533141399185585303682458673137333222811937916875239576668198424278336780514107065020089045901688521916237345088952954726145219987485939525599372222262875706329609081721097430872773217234851705346723027427403943405829297806583999317165356207337648482266672667578536118314203807879157895555322233378041981268361012002590107924429239758807755075382222281754972499345537915440227256270171385211023205345876243552768603931125624968548135742491212503271815206035478610909750910958338259997489134562784446059912545596279606846352168456367704017028310144202346072540011000589319695161013583163859254575206356193311499484707482789925661519051012741336309707213375297422756434984922281241082047393532070759458395935368523581270520386634226604169553220846251182549654168988126691869620626462851100952599342959554200156107897868519221916081610314502921224659736227967397380225198949555822021573974105020458726737516941502223810471173138657600982883934232182952982133811082434749874752803295501729765826174316808168124620634943217325264566516931995077541130067555233397183383955911520519967740184325094132492825526403840181035879013198120017681321687545923708858604306701798897613761767549064928050969054108271444737270777552338912617696550862927117607881211414997845996433355903309510684510581760107354672106501852144453502241204804877322557090137196722506034290924886933209270464806546181717232974519088813996777524742752344011207890870162550526248488939634147609391677206995334317236100513777692938410594328211336950322942648996990161107111073315746456916837747042811532071078269988433473758696608182038527629611961437632064867766163724590268004589475103991579923507246663881932869277465399384572520062666088172366202764689510788793626829278312229512015088408264384885972242562076157538437143142615901476815857159340992326769624398156657598615824952326909457541722897481127920452318973237310474303278169320180531614601134031919874362069231375128051400391088752539857192241465909119680197794836830206262072462532554175203293586041351991495862447524352635229478170455024362473823172783221504518287161061326342421788110407945337295483868246123711016746521344140758500988134023593117498365852881837565866597830693171928655063842665450099912092543842091617137942462226390250197833221854537776268575903999472238285028523262574071468066040918405519228793436204346458132329680678069677319836061115959848271264036169023963146694113124627081036355776169960057549138225843122901098044186371913241008452664888665984175344739966336681628285334012258762217492654836501990278368741549058323944361319485584616359428955953467365805474293836496078307972158696812044751854242343276249139018141697911649856664420825675695805800482192546563387218266472971981029091358810497545998241101984800693918402967849821452961066821226690954080212143949389816156092101094656295246229165320942201941266368998446616573137386053196199355250032581124004908849106414662234657863930958377161602565334517876418549421601333988407018871293521307606120548111584668365672530449458843785201411151269324350769720909778403374925252629670218276697042117547503421962043460826830732038096450137205573130507286706967902538542217082594714057450687891523770781865469891641487690702230000637629844733675652285556676110124252131998069585229583079724575962894902623017699172975603489718280953893984661485861720778531697830097912831320146813108293567093892305824865221239109073860600131096472756066452527014779905543788524869872626561202815121711072463146070023743071503619922103407675925897972420525775175772911057103963400469355138158028052287346600001011636974130675140636986932334531859841103167025849138806833960667065549926165082181072456779750625459958728897605116662214122286421383428739407986564424070398812393321332225174329865754620340228587550063693248945109149977725980116878563934584052817711489073909311649135378538843440867165430547579848008786746619047612892724488330665379330835000319936088368931318544145136566164159583300605991238174638454877049429996996246517269543238529540681254516110173281727481380828953628464831967615050047365448428314509752297098300514472259988011408288657195574345446564094424419580846807467437853721503449288870748723131754947989399309794503649303500011947213325330369610953888991686570413285226028040995422819513979428548503490094061128257959485137850951954289812701556765871346880543191804991234324646404713553043019741216808198103440806665155287970530709397899387316367369220984364621967885017392547461004610652045314685356187679418036297521448987234389357958127332130867511470738573159720876565626502496390065938799778948142580213480485310743581996363352959119754225554976750853931102795706143980921783030101341710078101134722533254327612883240447113733000153212333280098044745983655909994779586563028091047615647594258658858299062301358902868915014663332283580750914275774663184885679018711043104103944297693804297936028617123175871180764106443964140396705759023358575308487108474457866862425660161655312616199674331904688749642189947542362160810400666790291335412938560129984437140795288271504729326452023463311954735214021627760132469529450619134820314905277949891274709347976300179833591359880031622739212203997689760835868277973894802863560173027649239882901713793713605096930846084637858597206156336703431458203073819009995458815800738969110964317835486307697505809243694734352726612057634243820019082564107972287486596945159510143958413867976178222171127806142160807255969776202869935363187585777123971292420294253967112280517658525909738310223676615558493130441109144018250921222930774804891554032595387035719697011945700131556894795991350161779554614909717322524361349217606676895779955832734977685773278411313758576908839596343667097549006440397938369771024350930353053879134373417748625209591717100566637854784304108180234357596057053867289520136181912639581796181203923371037326038472778919184056588118079784567805558392231686006534624792756003502094910471047687364640308592813537221286872539796851694751276062441684470840350743738056290033858812759975717300119428350355877651814241869595862506885020101594429622107656476091772274557217522618417878493052569961996803538094159081812709199710584702626478069527684109850801721230178036236446537510087378139704981329667084180728709800575766333410997449060314925026349968058069811980433892347976149867555401441408186083451906159969323937015498872614714564752425824743156000739666293561267790993162650724101877130233061375342642633770408368099726259042810033146385272101698452068169075928264422630735946948963344849243190000186754259999678100619941730786232362280690107675683887310898023338168617266516601465654225070248373704907878469549225421246726711604701436397708384604073006212372580385635807502533982780293953027764761698553573746175572124212917668599721156840408045039925352647919048695239200099593304707033522006943598559455708265845681138703308249642076126910192363748482608877007450906111686813646637893224935244076658431226143394588548068581503339466357796440003723215661572750541782342686981530878914219664389582644182799530850188522860109794981782978215953501637292645746122761043061849716289876697025980476209873984098631669179805260977982076525650933360376748398111338754136265822655948462302585184209979036039168141126625423733024994413686930575514772559779636894959710948794421629853836343418124683506069013234039023228605598204364657347623967568941167418827789044211660422111899013513800225252354096888419942756536228010523078296224995003541154577291307248805259693458846100190181425483325373468798863168275322288538122482588009465558783077352974337396413057074481653471316708156139464716249034182448075679748694994982953223903361941623297314673587580687350103410569206650964821129491988315433532811756592847886381942521060997997656400966439581907173260318455826133449454179546081367366616641681685473585498188166469335511522326460093213945322187454550961642430280561259092756343874708005560373785940500143080297869727898129920201796637325179993031654747797523354898975462354791252531366593622109766116132487228165105299867535378378633391172735569062396281977973197050490518424020619422780867076353221952402872108354057475240887510253560822034382359503620369629669618558500648582200397223783115619036087455539670474002948207269131983620338916361101300599556175945016336485330505176869808261578162317772805062356040795459322752583111982504932822481970815475015811066803986849839823452616380560627921041990409108574899433096530264806848127771026370012045983333087835648265893512159968027911864043424809332043733925365183252628742102472241918985301740453371536928674569641868900927881945276546506520985156351155439683023864705092610302854927092843026036404060134363287491718328449475101961724064659605528329622821074629503824042221415697635392112446624797118084358273713673461207780708861814498165996116921385111175369048622614245561813405345477654725930152358462768504267943384126520314557352405070585159352401015577547845595808186159777524652995925863044516013035341256630434293363763885428248872712818157478349961723758102518385912823492708252234683373573132010075311107606896462442300642051952829899315533616571262643839839189517874588560918050456969036853115172510394780187948118295196570998103125385468786769777197153445401450804055135796058352709532112995481407343083228696971143891117783841025095846522748885600042227305088347552424286402159838837747046693963448736761141402753498227888388915986389033728255084660140192082064233261639805988650432399184881095118586246506536330092750101932727874538023834672474578640910415506778078005315253083457400156400365595426879745045129701064758460264405543513482261572144075728679293303121162944691841809092437601095502379500138434035014191810009129664453022514539426916043799549666960723920506752392087399526281295617687568058494261215126622014122441877464921434779555283054256545220624155679575654608660556152261429964042667010726158784557858731589988042058849027669500703306459648921876335779330724022622486464797388497998844774612356827126334335256103933476235495067062397425909116463866049724753258314398331617195749121468972641138130386246370837493915449017706998681266350589456139059501382250607789954004728255247825862352341063954369772932286410987328283741111511688889516973483620817091147974475580628934232388385672625789324797638022615594605214003558541250960277642039222096029161011661045307346529007612124636497903865797756221728640336042856150968980057772977379626098154783994741599716180102488541651305692677427481635251608548320773283302558764725654339211879090225193402458679531364594441662831898334827470459909587406638925300126082640494529012947258830765225963178266549393829260617937474126072888979865270879694324876582670944192205136331360105990394152099745830175497910098060385355710023145960434574868771893569410810178827776365193722011735352324920303104885716091237521137286615851540118461000915747027285860097176156501518444080750428113932358696107668214060118339665791432685063590352983324744673049701347829802652866421604199351563889959560874007873822043168268105559092984341083991726265350385791380822625400276395988757861865165087829768401224628037800299331127450465824632346104531305281353447937365716515349096490454309278578058162828920313199000944302296699333497726243044119562956049905654169916551792364422928738000329212914278788716047782825622707516367938601720214961123518390500285533131680388150054246437574113954228306170602201977618721396705108185216462505641828548912631268684414526412429425494834604336988230498840936454754737730892780726539206786597170611946570802399811456850726644942635862173655325149740312620232750625486426435917811534527904469529587488314563529925238717256059817687847653795540136196892346794367491001440626632675316974049752458760703706453638933391978499399894016021140198375105231692637112027521540037909924937699869651632070452180055205026637327169988542645627956388551113444728588511379027661487616588487743868212549100145017088374172343249503119032541763570709186065101643607798389057313607995132824431488624901470790777234684890023869053698782505089612138562385283841810974729270696790182529963083385777646215982981026775165196305129186015216478276804700157478518085338197560561994816920354292964349221216344427141758716585050364733388495091485854054209848891973375892656355180357776767120062429883628003852065845701508385965095735267133131558753725193982921063972010243198510621490537496830460881220364121853987031019347335672367504859609163065369258197755421908012558213334883636765242304216315530518534328738749891395440935682776403536326417213383789595345625535786076281021550594312718064174134360202626243800096735512598652906383067461446842404162093492406999954335524730698099862971924030282791639912647939907549748948148451332251366511867666771527235887571913190905015238767183156005908355783933480946828804304523516971300924999186222021176120285283865025523015666375915728469482444562807396942435388524588471863091852757961744918705954317443576276043570108070691848083586010708211727423582647500004393048578485291652291019559452226989688046025330810173746424667633205908348618703520439197442151420861419496320410405460933576030294680105064899672332404870028981434730055391999375923451057720843725547631971192717774574104629783941087745392892887492743620590061499931317656216170787252853778845713753588241044608304048976705707592055401751745153606543505496328477003658889758084288562833843260859096077183162420101399788941873090945456735925478107996219910165286997759048854649521015583146975021699038859791704723435465194744062192459172728785697963570245140277718330404348015677928025427869532080982258465670356935602481531151479749345305907570559238116443388775843619684230653551854042444566218171222146050287304141851631828955306611613945636991149175145336781870825447729300043618336208760735055546898793768324189390744743608204871030373078277992648162303411950669926930099944258425992413471149076052333488478026387070679629595076856093138776009902078309506291866408069748391787987391575148446358933397442285205019509007313570567637079431974171251736654674032454966023877859856564695135476851798801051489544069358349662583926971797546256016261135941079497224316901626984401789716116354636832932562769722913618701174871107015497683270164274404147958772387881513914592191020118355301728258643404335451087192075711540487264239098288944090729581065933067908081768268916434491372613318057774828493722548064013657225741986139400765090358776116034568363275082801802010995345851576921336449323136514326623889528201754332466971893307328306212246622818945415827008084239192103781622095551743508142924376540277341160700589071787145596506657396189669836749431637963479686699008159284463126079459149860522860404574068052576498069782242929285431750786248755701257305663839737985722719718996437625306018995930120598822612954508137219538940595187380765298462159263266880127909823392720153286095476270785421136743072771943725177392245431316456321778129592303739871726787491169243601659525865793509152021718756862459038297788692930114402820609207419356997195879858044524541104446984518858572706291993997545970118232575173787055593034900662646462011043903432853790519572536132244985307579999352661451738830407316541487447501598000133736962161223390708242908574572814186733189282729445131462602012643079291193816060410160327750145314422468693704640482621700525705647118162652098450870067566319966721572072319091364027121983433027551482856622684069371815961041068033053637900683975886354557567686922246333362862907402183665269899984237300797183989423505733694943257512089213229185083965914478130237512900376779811176128363833591733540073561864925734137346756010650261428575392312246890151805486814553445935032377446391772146242094734770266508809983723965782190253266115803143954262175747156934815833164103162663633168485017178821317510932753308156318104243695564188194373002897538136082581150835902305785613873590013623135144652384322255944562914270107152254862642849857247014250167206345898781715121118525696953241154554756848042948088757836415482734882905600516079605984636141353028751956526270043564566060214892120498079802705216595383985931808554466870163461936927121910047423060099853710814650441231191749626729192016961495100107347468433507700366637080597690517748518570035515394272343851502164860364261185847121687735158903714303851306951764969679103119658362452360433681045463572355913048393428566118709638799742698373752646318990094677953368731165906415934879032649856799556693125701330848959562922839784995963282722055718281705424724988851058612978723834737142446806144734626235727439813625007180975944027949748399713307179950421631821434052961598249813595512281033249512859050217600413410295742293231505396115849216470803323045912272118649287029273912420406352305894678942175096551579787862221510464829951115659167323723435211488843263718595251236929417469642277636096185337716762247219891517401177556686565162159255935678018365622980785672466764696710106066227470682716313787245108823201938579963459528098627932280787758328200248583811806583163747697891473452371525885893945138636631354616363875915070170827023335755610236269398115861784551049359920554821907987857067894914053325918843795587818166421763293629511082899048361802224636801899355146525634827658696409074912367872552030363104809086732047333015392549674042352616549252693973644929891809660527969929774357845140122521718811425333530650036540307277695744316277305747325782495263615541443369991493205064644212664473139088131144788058442767601922979874834173287659308372359329732845013652165194354586632184228962868611965092962761519892558176217787057838317388463440066073592004189576037357030122880913321882349321175981918055419313025099967124568707467953048905135682869647736907765667513253825479499146817856176598704982299236742146930389585519535788873786564848818693650168148988978906367048348935725257978480201614655347189998605211549628462940621549991582232653232196723511597828234577029829539858041750947054755902058994960077718038967852471480924809801679653192114593130785188664010264705650992879268627870755190990196368583917234407881678349789472721441698032260025709177233997381162681021700442994807488180640780532365790301592637985738266743375136923419268043832525920142785614538369442948433112893380197331761609813330796753049138463468682682662848538464444878321635106028125465407923656462787971737129119305178709758401344475232053599675632229265799349238785707424007281014791709052280755482275678501672104940974438761807979323468744359916362280311558394427812131693786125838136224601138011604100808944638509368262955250650039214447589492952458545798117915350676002870203728855942406375735824227313626798560989258460812060556567079380177935551220806693863022367907142861275742513009134908991407230723715410391052487959616989979373545815803609845490411380102458725532050171137192984378771292560062665882531163204559850436352523824492730457340615430550966287051675534517513461603557152093394435360914967849135539168322708550648638112294537360411751550861083382895928396833525944187887644778642384932886876893892938339304083539852947489317639313369711950565769096815732603940302210198455623446741378129262637562992362689107223220234557727741871798546951947633454784789190809181707854356795554463705485902233167225776907902679450994074544275974225270540351394257927828156406780184395129364001496891242197183677954095136051547879689200190611853704804426612325306152260923167719940853454876675570711154269487598831227046704558027207840587534221574776480817318141585601484604534984935009763376792178356207071525640734088629148767207424947416169227120373596085098942741374795083490449868130434535211668333386247165901258678425973298117654305913521786462392209776134018368949121608325313218359270550192733675631276051312319991463457517017637794250063148214207936487433460309231300530567443029404949356034458788070522414987089349148553910506972782587389962023445802060418302332156994066303201235422609622555084843143377151013560807201948914419525319474110384824655378475653471680879293845001294188427651418362125677923143319174606794690146007505664721237593041704781533409690464844976202951403793671471762497790557747803334611971107092027291298019451565826202502936693530190600649188475955124590027775414578239282410022445153041934931157503986437859548049274906926874000772078188010599605063344943226042364636528497242635776507222510723056411053116758051152189357913802158381257975158290983866824776879247468689146040124950693852375880612254676592176509496797945091913693680060438235699250589869763261322194004766379178587029778239167641103184657953524740339095541586852353503763422305280969367229839092966785993035520421814834969298877685093637261096245724057057003869911406970629018655934411527867620838724024428425554277870977710932626133295588411454078055559932657323359539201816767116355844440442671596006397693601214019341086051200967572560107398696748267994807384800782620985254056278454147629571976778804239692292656959714987685695569164405285253429710665779129335889898225898238854401070753910149138060147198811045759953617664451750793683696075572407531986037690754844141747932886905069488765905767783237890927965611744368311897910148579849329866559022484956481819138802681821467244303486004500380199362046547025368196976211112322028472601641894867139750307414252941474578934277724505498191861432691593178012625788098698179684545720951416145099593574070433081495974142357688779588162714357870550891128371683162111152799923164807092639127105301153514209121373888404492433787750582785815346577868175236163853983893601176455508423204893009971567532797702087742880931128832560764570538643557352819706456604457934779694278607640196020602341452233629065421152678259036462423053023181266540106701568047173078741462573855177047000701651824120134636258819613073187906917116012255398352948418230721463501661057890557253499202744893994766667749903198578993105566920869178572956144128453944911217827065039059723071837032094632965742476755202076849454212883313709919895136116201970648206815295802395679559503439426088550599283813585979803884772262258222183797216680219714318533948390239164790417848036849279877505766559605718868625415723302424134570794627290851940725462769731311122533504503424810349135312313335210837699627629633098168710653723781624089038414543021204405983693180260418979365776327738893119349736918944774324032282706529674670090003579477580070973964096938562608204241651189181093191586421763282364322124493118836807966941401460390021055024390832674370226830065341447255926650000566656219173328729821359496360632589121102341876087288228372059288587034207405260598773662536865272856448271144449007659617029940949422843863556233560305036113358914317905728622912973344219709633041591719556623507872806626187907029112455530381668199748874551658244325416344604865638272987182788861967554765699881294744409729559261616536271910721442639069026859505364727208318328110319994797517125442107184556061980263331222496094636201684649920912853231715840260088055673918062555160326219201225987622777954032119196655576526076615145376728128973719959315749519753279929721003216608343151140225909363853192043823482389269446343064200187554654874471127805873209958338862659115253495362198607857642775742983423533834022951452395009629027290539817747192581682855471575585914204490809375116874611544334470929389500364109835683825092331734650450672461764058591933234964772543631602586716401826234272673503003970565292854727992030031590996260351239220398970651842742251704857252517235002074675855097118914721636355317640296646813174676864434792859577551630678938747463510743375425640255325838029735748383185257442344163435791820879475920361291692164928053463623021287009549940672649429782302931288742924412474467813897119680470622225154045609029267628797881448393904749467782354572694702127386828365467812361932494536978116292793540217425259178364670930547048257214332567689020836527845962928817484225924453895361384755691628028761291739334421818706722415712793226640069448549536146889160844283994887407528473713326086950202393913548969022677629255792088636568500909149817829670690636702378720309930085329360622552643305242453338383257364214054217684249168585314529086225963351283205882928721737391949566184058906215644518045425363064528176720635648810220836436986071007062396732642259256720150057386810537958860498132301777663457040455413752423005399759388249428535241308382573508002299733506798131238277076150902218071652136652834336540078180676802173091783880789594071133344198623055988207639855820322525971602375466900149017063326340574085527402150226741105113273198450443572692000913097232918774922572612171414248428558232800836406791833550546922928815470230485730177433554790811082886147168959106852799378631496689071940506996022855629122026621474394694023343499447345723037837458309849951996206420289184760090610950799532894864326789739398000197111910735721640072265623283475634820363235262886882804630730067309853147546235459281995593714691919168758540274635930897234029288126560269809663110765070992993043151142490703064805073826006648376793655681881036827247980904311552884783733317628401564201880376826523661344159848054565557626186679578536842846265969611262919196860448200548845891780371613475406553974459363607742051840325082640880949585333128674282761357661916416342234923081870962775158859940690426076584922160553825973317476727909957145188467807727549864964197309159974795253270727649748929372716118765036116261673610940002106155828021908161839807409832531930491456555729610714012615376501407123400277883160310391617894553878070240383675002328633072807793841785517382855112836830390403107213048449018707873745596382588727832834991346760134255208099159716428388046506099206146968666210189570301456796085293636097844115182440590647067936696130751149301615312931572228273479720969776222191253215907112245028016431718668109064051769598750522677325457617826484616436544134567434930173144186201492617197924552829559824336565177713106110087342777108802999713353196727984139823557916155552012394054849622154038715585756590232358020556345717457365897259820838998464773296896226399233053197078654592002764138153976984406561262341101970394844657890828661577353227388074201886244668366076557300752946839765651784165783076038210911734105079251629473575389921736319477000050845566646165763919622899610367288838609952988881330559060640948849409737984463184545096927492036061238492199659298314599343862173864867402149806408799173879757993431169910656402932325759588128143079040875436165674209606122884334930182802010579447727598326831663026713979899711669457761496563337227527581272035834584983050956847398795825941218205606168723363526663043553558486267495608722984551319788853213224913430153195695415661281806105503948943858349469632912252108457102932250557975896156366582472719866770161392517101708179665814229261658630643229747641779462324269500401542864227378725709831293522493117825578232697167831906450855993179858862646251419634942272827285310300719370248808266241725947705591985575501144779409327006676753231736370099741644306001891369726430474045036249703538168311804282031543740110690124358406257131306574926229503527106256174976672655784716490443580042940578004556641610178839714127732755122126710221262408271822052506063616475075920779215360390346841113734823002536969522193564701537348575137812065511558064016228123039317724338353599403257655437416270486547821369607523553954736893139129198955130780922075131890289219079790856890844667556673559535257479403222644661881478191838786848007216807639075201380011373868954958248054281512820120551234789580423931194822306506408930414852192937505409662498667042182162246359206070881538219676574845877937175614996287756748331127057565311239723631245682431804362845251088048823229738447427963811712324888173477310599071741122401541171143988660986375310602833376751777158349584447607556934439013163811679367703641859578674824637291149837223427164876719546250166610315463081235986274912674869161826439854599232101347948865288742866152529724027410038785210245913371566369290543405821519423443279913134698106102254123647564312754283892677873287208337100452649887808165866866194413299430837779344731411846867332516923520865796340557558639672025086905509614471445577108600461643300317917114586868913395063796289699132097361375171189755485944599412677407606417933286648031029184440112856878871936291653444681989087227241605559656059802624462891057483819441186707107485546719280142368884475329865876299525082073557197990255177500141477912572986963901272237541323393951176844677369753839248120542499117859021182652964586336986108030627946340317042266428329000593508880374034731210794253393162970485100502019307023616372936862698001966578683701814226873621653669380138884098300320014876169924849194417696723992713700473500682128210630354062401361010950213457962140590625212322572416255357008007084579754903663431859573008387046671039971100610801141208205618720364104522727366094395614512470990673126815507598505994824557449200123501352495666744195161631709886525322103028059194676957976704253517405782879273160398501691188937240529219095709725740111193901364522527453046840149870034039037938116698551016542421635002195403553597548640052585294760733475509256785100873362800942624478000769181960348788585764583917882240325598023681172456260401885695227829170136424415375582109172148268952266438032682573172757781985582561659544106028591603325763210864713454912283792209279835465659618127073276023355197014402834558681671084349025383803198377437571405742422552596023237151619881471115610970895186252768921578280748574637067512470384754730416716322997703791126513186849117754880845702989925645117053167720418885151582513325297014165843200826040510903443853864495906898546409902447039871371405726576258429158120771618215788919828495258101094649611094511361790820716704303774773530454299034652034740863364470703626719989091027274546627738820673649536234488274908714085711782998303720645593031498999971071849666360285585714399788842063839351784612607449534820623371230535686091379014885144376288471469555147404419681413422205901938096581108579990584780969873408919634049749408107457716320315370450627022161936262276776132009599853653915507105896256944109604745732986160927818735441977362086615817105612256346235565869790837680646247792118773302369808477799108594243861696859416040811969219162683757154976884024379034727618689560519475757691343502333563958104244851340519490881337756561416099630504430358384633004373053884951512814770750275225945865156527945358948525337909180045197195639392060584893451462141420396038251183696224250733328812011676640153710160697534816876555831856324182208533389138274534965983925011069469454497610094694778530360363468833095135560038058396661547215792193645671333370776625417055276143548777914437284345401789582668007563450826315622476948859921865518810999608580132311627361964585771705256640370023199988814661316589456393142217041228334758315326296422289104856611115561594967044812589164098938038518739842119168336559424591876064413996214755673547988977356171442177432821874927821743160657783030846660451305481151574445404972651416168737274901656232330917164557808902259752407238452673120030468845871959425411786489611245074649552483986344319010361639476197312788502579529699898513409941154982800231120075397765089789362232517122744641175402986969601830105205004988260136779050396059918726036241338545547902658278381432625679216958006191858783762575852873342602242276734620975614458985282727018066001947145417164014086852667405156626990714317758708830803037570976858075584816539690577794507846380650448030553503575977182873672804012662217495316397167282012850603463377081908395072399691373625890527703283404646103537116604927380631600837439473027361697452438354426672186942891732140360240999358473355335176083075028528262797381687092218127717726398283671884215907806871269537673386788941863608922256305921575876726711891957841900049594383079720627741548078080210165149662619406866714921304923554325323924232580258708037633609110419039517462145813522973572016368347326807020446355876017900665823937675456496924066799274793445347402942302581099055656904906305256879757041461703285079437152914145017542099914929261987810888736560480246931031356573499179555767817624007055300111198194673234770026710129910200221212560336818044095338162543357500839844839726920795158081854210834366611036139396760267863465691228899227853207252959774248571941075704757820607207047625580330717818914593877834781033351860246750441873654059170260464078468027941126927606633489874456205775587182030465875516624938690310649571230985175586304419884590237403124315262388932042416987890657065565357706484946118385390866639218239905856428145302550554445609876654346632105526319032142516169675052711603974469037914005576230845312286843761923034721051799876869688728146141474002221094288936345598116908549208714091906499719479112127599137147938722882491966320283051593587611790859532702237921784688214396972436741242442845152889124693825497031928538598285974532083649306332973788997662955871361209168006848463714554689719925959362924854082980734808006417587399727775294174331517422817893461854146661196373208777583724010679999063337288969831817328228594490063138922761481819254863069027546755753677896090658972487509330352587303124852353647258342047790288834553867075901985859764290067617015321302508765676130593843071758114408307678985327719313977056240705007735752463542416218554938084185355746695801874432680900673683308180105379624141973124847320522749641035214978046105310356752247886588976772979089754595507149548503223689715912358726435717895632225789166659324907817680680983764828448203697344752559773814041844433892882814152839710784053479725436024498637963091090830979893860659884274484056389201921");
     SYMXX_EXPECT_EQ(
         ((s1 * s1) / s2).to_string(),
         "0");
@@ -33,6 +33,7 @@ namespace symxx::test
     SYMXX_EXPECT_EQ(s1 * s4, (Rational<int>{1, 1}));
     SYMXX_EXPECT_EQ(s1 / s2, (Rational<int>{1, 1}));
     SYMXX_EXPECT_EQ(s1 / s4, (Rational<int>{9, 1}));
+    SYMXX_EXPECT_EQ(s4.pow(-2), (Rational<int>{9, 1}));
     //Real
     Real<int> g2{1, 2, 2};//_/2
     Real<int> g3{1, 3, 2};//_/3
@@ -80,5 +81,14 @@ namespace symxx::test
     SYMXX_EXPECT_EQ(g2 / g3, (Real<int>{1, {2, 3}, 2}));
     SYMXX_EXPECT_EQ(g3 / g2, (Real<int>{1, {3, 2}, 2}));
     SYMXX_EXPECT_EQ(g3 / g3, 1);
+    
+    // perfect powers in Huge radicands are taken out exactly, without factoring the root
+    Huge p{"170141183460469231731687303715884105727"};
+    Real<Huge> h2{1, Rational<Huge>{p * p * 3}, Huge(2)};
+    SYMXX_EXPECT_EQ(h2.to_string(), p.to_string() + "_/3");
+    Real<Huge> h4{1, Rational<Huge>{p * p}, Huge(4)};
+    SYMXX_EXPECT_EQ(h4.to_string(), "_/" + p.to_string());
+    Real<Huge> h3{1, Rational<Huge>{Huge(72)}, Huge(2)};
+    SYMXX_EXPECT_EQ(h3.to_string(), "6_/2");
   }
 }
@@ -84,6 +84,22 @@ namespace symxx::test
     return num;
   }
   
+#if defined(SYMXX_ENABLE_HUGE)
+  huge_internal::digit_vector rand_digits(size_t n)
+  {
+    huge_internal::digit_vector ret(n);
+    for (auto &d: ret)
+    {
+      d = random_digit<digit>(0, SYMXX_HUGE_LOW_MASK);
+    }
+    if (n != 0)
+    {
+      ret.back() = random_digit<digit>(1, SYMXX_HUGE_LOW_MASK);
+    }
+    return ret;
+  }
+#endif
+  
   namespace test_internal
   {
     template<typename T, typename V = void>